@@ -120,6 +120,11 @@ namespace json
 {
 class Interface;
 }
+
+namespace native
+{
+class Interface;
+}
 } // namespace mesh
 
 namespace model
@@ -366,6 +371,12 @@ namespace json
 /// @see smtk::mesh::json::Interface
 typedef smtk::shared_ptr<smtk::mesh::json::Interface> InterfacePtr;
 } // namespace json
+
+namespace native
+{
+/// @see smtk::mesh::native::Interface
+typedef smtk::shared_ptr<smtk::mesh::native::Interface> InterfacePtr;
+} // namespace native
 } // namespace mesh
 
 namespace model
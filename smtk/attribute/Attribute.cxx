@@ -477,24 +477,19 @@ bool Attribute::removeExpungedEntities(const smtk::model::EntityRefs& expungedEn
   std::function<bool(smtk::attribute::ModelEntityItemPtr)> filter =
     [](smtk::attribute::ModelEntityItemPtr /*unused*/) { return true; };
   this->filterItems(modelEntityPtrs, filter, false);
+  smtk::common::UUIDs expungedIds;
+  for (const auto& expungedEnt : expungedEnts)
+  {
+    expungedIds.insert(expungedEnt.entity());
+  }
   for (std::set<smtk::attribute::ModelEntityItemPtr>::iterator iterator = modelEntityPtrs.begin();
        iterator != modelEntityPtrs.end();
        iterator++)
   {
     smtk::attribute::ModelEntityItemPtr MEItem = *iterator;
-    if (MEItem && MEItem->isValid())
+    if (MEItem && MEItem->isValid() && MEItem->removeValues(expungedIds))
     {
-      for (smtk::model::EntityRefs::const_iterator bit = expungedEnts.begin();
-           bit != expungedEnts.end();
-           ++bit)
-      {
-        std::ptrdiff_t idx = MEItem->find(*bit);
-        if (idx >= 0)
-        {
-          MEItem->removeValue(static_cast<std::size_t>(idx));
-          associationChanged = true;
-        }
-      }
+      associationChanged = true;
     }
   }
   if (this->associations())
@@ -854,34 +849,54 @@ void Attribute::forceDisassociate(smtk::resource::PersistentObjectPtr obj)
   */
 smtk::attribute::ItemPtr Attribute::find(const std::string& inName, SearchStyle style)
 {
-  // Lets see if we can find it in the attribute's items
-  for (auto& item : m_items)
+  return std::const_pointer_cast<Item>(static_cast<const Attribute*>(this)->find(inName, style));
+}
+
+smtk::attribute::ConstItemPtr Attribute::find(const std::string& inName, SearchStyle style) const
+{
+  // The definition indexes item names, so we can go directly to the item (or
+  // to the items whose children hold it) when our items match the definition.
+  std::shared_ptr<const Definition::ItemLookup> lookup;
+  if (m_definition && m_items.size() == m_definition->numberOfItemDefinitions())
   {
-    if (item->name() == inName)
-    {
-      return item;
-    }
+    lookup = m_definition->itemLookup();
   }
-
-  if (style == IMMEDIATE)
+  if (lookup)
   {
-    return nullptr; // its not amoung the attribute's items
+    auto position = lookup->positions.find(inName);
+    if (position != lookup->positions.end() && m_items[position->second]->name() == inName)
+    {
+      return m_items[position->second];
+    }
+    if (position != lookup->positions.end())
+    {
+      // Our items were built before the definition changed; fall back to
+      // searching them.
+      lookup.reset();
+    }
   }
-
-  // Lets check the children
-  for (auto& item : m_items)
+  if (lookup)
   {
-    ItemPtr result = item->find(inName, style);
-    if (result)
+    if (style == IMMEDIATE)
     {
-      return result;
+      return nullptr;
     }
+    auto candidates = lookup->descendants.find(inName);
+    if (candidates == lookup->descendants.end())
+    {
+      return nullptr;
+    }
+    for (int candidate : candidates->second)
+    {
+      ConstItemPtr result = static_cast<const Item&>(*m_items[candidate]).find(inName, style);
+      if (result)
+      {
+        return result;
+      }
+    }
+    return nullptr;
   }
-  return nullptr;
-}
 
-smtk::attribute::ConstItemPtr Attribute::find(const std::string& inName, SearchStyle style) const
-{
   // Lets see if we can find it in the attribute's items
   for (const auto& item : m_items)
   {
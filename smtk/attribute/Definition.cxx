@@ -11,11 +11,13 @@
 #include "smtk/attribute/Definition.h"
 
 #include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/GroupItemDefinition.h"
 #include "smtk/attribute/Item.h"
 #include "smtk/attribute/ItemDefinition.h"
 #include "smtk/attribute/ReferenceItem.h"
 #include "smtk/attribute/ReferenceItemDefinition.h"
 #include "smtk/attribute/Resource.h"
+#include "smtk/attribute/ValueItemDefinition.h"
 
 #include <algorithm>
 #include <cassert>
@@ -639,6 +641,7 @@ bool Definition::addItemDefinition(smtk::attribute::ItemDefinitionPtr cdef)
 
 void Definition::updateDerivedDefinitions()
 {
+  this->resetItemLookup();
   DefinitionPtr def = this->shared_from_this();
   if (def)
   {
@@ -684,6 +687,123 @@ int Definition::findItemPosition(const std::string& name) const
   return it->second + static_cast<int>(m_baseItemOffset);
 }
 
+namespace
+{
+// Visit the names of every item definition beneath \a itemDef.
+void visitDescendantNames(
+  const smtk::attribute::ConstItemDefinitionPtr& itemDef,
+  const std::function<void(const std::string&)>& visit)
+{
+  if (auto group = std::dynamic_pointer_cast<const GroupItemDefinition>(itemDef))
+  {
+    for (std::size_t i = 0; i < group->numberOfItemDefinitions(); ++i)
+    {
+      auto child = group->itemDefinition(static_cast<int>(i));
+      visit(child->name());
+      visitDescendantNames(child, visit);
+    }
+    return;
+  }
+
+  const std::map<std::string, smtk::attribute::ItemDefinitionPtr>* children = nullptr;
+  if (auto valueDef = std::dynamic_pointer_cast<const ValueItemDefinition>(itemDef))
+  {
+    children = &valueDef->childrenItemDefinitions();
+  }
+  else if (auto referenceDef = std::dynamic_pointer_cast<const ReferenceItemDefinition>(itemDef))
+  {
+    children = &referenceDef->childrenItemDefinitions();
+  }
+  if (children)
+  {
+    for (const auto& child : *children)
+    {
+      visit(child.first);
+      visitDescendantNames(child.second, visit);
+    }
+  }
+}
+
+// Return true if \a itemDef or any of its descendants may reference other
+// objects.
+bool holdsReferences(const smtk::attribute::ConstItemDefinitionPtr& itemDef)
+{
+  if (std::dynamic_pointer_cast<const ReferenceItemDefinition>(itemDef))
+  {
+    return true;
+  }
+  if (auto valueDef = std::dynamic_pointer_cast<const ValueItemDefinition>(itemDef))
+  {
+    if (valueDef->allowsExpressions())
+    {
+      return true;
+    }
+    for (const auto& child : valueDef->childrenItemDefinitions())
+    {
+      if (holdsReferences(child.second))
+      {
+        return true;
+      }
+    }
+  }
+  else if (auto group = std::dynamic_pointer_cast<const GroupItemDefinition>(itemDef))
+  {
+    for (std::size_t i = 0; i < group->numberOfItemDefinitions(); ++i)
+    {
+      if (holdsReferences(group->itemDefinition(static_cast<int>(i))))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+} // namespace
+
+std::shared_ptr<const Definition::ItemLookup> Definition::itemLookup() const
+{
+  std::shared_ptr<const ItemLookup> lookup = std::atomic_load(&m_itemLookup);
+  if (lookup)
+  {
+    return lookup;
+  }
+
+  auto table = std::make_shared<ItemLookup>();
+  table->references = false;
+  int numberOfItems = static_cast<int>(this->numberOfItemDefinitions());
+  for (int i = 0; i < numberOfItems; ++i)
+  {
+    smtk::attribute::ConstItemDefinitionPtr itemDef = this->itemDefinition(i);
+    if (!itemDef)
+    {
+      continue;
+    }
+    table->positions.emplace(itemDef->name(), i);
+    table->references = table->references || holdsReferences(itemDef);
+    visitDescendantNames(itemDef, [&table, i](const std::string& name) {
+      std::vector<int>& positions = table->descendants[name];
+      if (positions.empty() || positions.back() != i)
+      {
+        positions.push_back(i);
+      }
+    });
+  }
+
+  lookup = table;
+  std::atomic_store(&m_itemLookup, lookup);
+  return lookup;
+}
+
+void Definition::resetItemLookup()
+{
+  std::atomic_store(&m_itemLookup, std::shared_ptr<const ItemLookup>());
+}
+
+bool Definition::validityDependsOnReferences() const
+{
+  return this->associationRule() != nullptr || this->itemLookup()->references;
+}
+
 bool Definition::removeItemDefinition(ItemDefinitionPtr itemDef)
 {
   if (!itemDef || this->findItemPosition(itemDef->name()) < 0)
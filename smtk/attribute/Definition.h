@@ -30,8 +30,10 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace smtk
@@ -330,6 +332,35 @@ public:
 
   int findItemPosition(const std::string& name) const;
 
+  /// Tables used by Attribute::find() to locate items by name.
+  struct ItemLookup
+  {
+    // The position of each of the attribute's items, by name
+    std::unordered_map<std::string, int> positions;
+    // The positions of the attribute's items that have a descendant of
+    // a given name, in increasing order
+    std::unordered_map<std::string, std::vector<int>> descendants;
+    // True if any item may hold references to other objects (including
+    // expressions)
+    bool references;
+  };
+
+  // Description:
+  // Return the name lookup tables for attributes of this definition
+  // (including inherited items). They are built by
+  // attribute::Resource::finalizeDefinitions() (or on first use) and
+  // discarded when this definition or one of its bases gains or loses items.
+  // Changes beneath those items (such as children added to a group item
+  // definition) take effect when the definitions are next finalized.
+  std::shared_ptr<const ItemLookup> itemLookup() const;
+
+  // Description:
+  // Return true if the validity of this definition's attributes may depend
+  // on objects other than the attributes themselves; that is, if they may be
+  // associated with objects or have items that reference components,
+  // resources or expressions.
+  bool validityDependsOnReferences() const;
+
   const std::string& detailedDescription() const { return m_detailedDescription; }
   void setDetailedDescription(const std::string& text) { m_detailedDescription = text; }
 
@@ -413,6 +444,9 @@ protected:
   // definition's items have been changed
   void updateDerivedDefinitions();
 
+  // Discard the item lookup tables so they are rebuilt on next use
+  void resetItemLookup();
+
   ///\brief update the advance level information of the definition and its items.
   /// readLevelFromParent and writeLevelFromParent are the advance level information coming
   /// from the Definition's Base Definition.  The Definition's advance level member are set
@@ -438,6 +472,8 @@ protected:
   size_t m_prerequisiteUsageCount;
   std::vector<smtk::attribute::ItemDefinitionPtr> m_itemDefs;
   std::map<std::string, int> m_itemDefPositions;
+  // Access with std::atomic_load/atomic_store; see itemLookup()
+  mutable std::shared_ptr<const ItemLookup> m_itemLookup;
   //Is Unique indicates if more than one attribute of this type can be assigned to a
   // model entity - this constraint is implimented by using adding the definition itself
   // into its exclusion list
@@ -470,6 +506,7 @@ inline void Definition::resetItemOffset()
   {
     m_baseItemOffset = m_baseDefinition->numberOfItemDefinitions();
   }
+  this->resetItemLookup();
 }
 
 inline const double* Definition::notApplicableColor() const
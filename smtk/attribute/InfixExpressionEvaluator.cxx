@@ -16,9 +16,112 @@
 
 #include "smtk/common/InfixExpressionGrammar.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
+namespace
+{
+// The compiled expressions of InfixExpressionEvaluators' attributes, by
+// attribute id and element. An expression is recompiled when its text no
+// longer matches the text it was compiled from. Programs of attributes that
+// no longer exist are discarded as new attributes are added.
+struct CompiledExpressions : public smtk::resource::query::Cache
+{
+  struct Entry
+  {
+    std::string expression;
+    std::shared_ptr<const smtk::common::InfixExpressionProgram> program;
+    smtk::common::InfixExpressionError error = smtk::common::InfixExpressionError::ERROR_NONE;
+  };
+
+  const Entry& entry(
+    const smtk::attribute::ConstAttributePtr& att,
+    std::size_t element,
+    const std::string& expression)
+  {
+    // Compilation does not depend on a grammar's subsymbol visitor, so one
+    // grammar is shared by all expressions.
+    static const smtk::common::InfixExpressionGrammar grammar;
+
+    auto it = m_compiled.find(att->id());
+    if (it == m_compiled.end())
+    {
+      this->prune();
+      it = m_compiled.emplace(att->id(), Compiled()).first;
+      it->second.attribute = att;
+    }
+    else if (it->second.attribute.lock() != att)
+    { // The id now belongs to a different attribute.
+      it->second.attribute = att;
+      it->second.entries.clear();
+    }
+
+    std::vector<Entry>& entries = it->second.entries;
+    if (entries.size() <= element)
+    {
+      entries.resize(element + 1);
+    }
+
+    Entry& entry = entries[element];
+    if (!entry.program || entry.expression != expression)
+    {
+      auto program = std::make_shared<smtk::common::InfixExpressionProgram>();
+      entry.error = grammar.compile(expression, *program);
+      entry.expression = expression;
+      entry.program = program;
+    }
+    return entry;
+  }
+
+  // Remove the programs of attributes that have been destroyed. To amortize
+  // its cost, this only scans once the number of attributes has doubled
+  // since the previous scan.
+  void prune()
+  {
+    if (m_compiled.size() < m_pruneSize)
+    {
+      return;
+    }
+    for (auto it = m_compiled.begin(); it != m_compiled.end();)
+    {
+      if (it->second.attribute.expired())
+      {
+        it = m_compiled.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+    m_pruneSize = std::max<std::size_t>(16, 2 * m_compiled.size());
+  }
+
+  struct Compiled
+  {
+    std::weak_ptr<const smtk::attribute::Attribute> attribute;
+    std::vector<Entry> entries;
+  };
+
+  std::unordered_map<smtk::common::UUID, Compiled> m_compiled;
+  std::size_t m_pruneSize = 16;
+};
+
+bool isFinite(double value)
+{
+  return !std::isnan(value) && !std::isinf(value);
+}
+} // namespace
+
+struct smtk::attribute::InfixExpressionEvaluator::Memo
+  : public std::map<std::pair<std::string, std::size_t>, double>
+{
+};
+
 smtk::attribute::InfixExpressionEvaluator::InfixExpressionEvaluator(ConstAttributePtr att)
   : Evaluator(att)
 {
@@ -44,89 +147,237 @@ bool smtk::attribute::InfixExpressionEvaluator::evaluate(
     return false;
   }
 
-  smtk::common::InfixExpressionGrammar grammar;
+  // Referenced expressions are evaluated once for this element and reused
+  // wherever they appear in the expression tree.
+  Memo memo;
+  double evaluationResult;
+  if (!this->evaluate(evaluationResult, log, element, memo))
+  {
+    return false;
+  }
+
+  result = evaluationResult;
 
-  const std::string attSymbol = att->name();
-  SymbolDependencyStorage& ctxtStorage = attRes->queries().cache<SymbolDependencyStorage>();
+  if (evaluationMode == DependentEvaluationMode::EVALUATE_DEPENDENTS)
+  {
+    const std::string attSymbol = att->name();
+    SymbolDependencyStorage& ctxtStorage = attRes->queries().cache<SymbolDependencyStorage>();
 
-  // Collects symbols used by this expression.
+    // allDependentSymbols() returns dependents in a level-order traversal order,
+    // so these evaluators will run in an order in keeping with the dependency ordering.
+    for (const std::string& dependent : ctxtStorage.allDependentSymbols(attSymbol))
+    {
+      smtk::attribute::AttributePtr dependentAtt = attRes->findAttribute(dependent);
+      if (!att)
+        continue;
+
+      std::unique_ptr<smtk::attribute::Evaluator> dependentEvaluator =
+        attRes->createEvaluator(dependentAtt);
+      if (!dependentEvaluator)
+        continue;
+
+      ValueType dependentResult;
+      // evaluationMode is set to DO_NOT_EVALUATE_DEPENDENTS to prevent infinite recursion.
+      dependentEvaluator->evaluate(
+        dependentResult, log, element, DependentEvaluationMode::DO_NOT_EVALUATE_DEPENDENTS);
+    }
+  }
+
+  return true;
+}
+
+bool smtk::attribute::InfixExpressionEvaluator::evaluate(
+  std::vector<double>& results,
+  smtk::io::Logger& log,
+  const std::vector<std::size_t>& elements)
+{
+  results.assign(elements.size(), std::numeric_limits<double>::quiet_NaN());
+
+  smtk::attribute::ConstAttributePtr att = attribute().lock();
+  if (!att)
+  {
+    return false;
+  }
+
+  smtk::attribute::ResourcePtr attRes =
+    std::dynamic_pointer_cast<smtk::attribute::Resource>(att->resource());
+  if (!attRes)
+  {
+    return false;
+  }
+
+  smtk::attribute::ConstStringItemPtr expressionStringItem = att->findString("expression");
+  if (!expressionStringItem)
+  {
+    return false;
+  }
+
+  bool success = true;
+
+  // Groups the positions in |elements| by expression so that each group is
+  // evaluated by a single program.
+  std::map<std::string, std::vector<std::size_t>> groups;
+  for (std::size_t i = 0; i < elements.size(); ++i)
+  {
+    if (
+      elements[i] >= expressionStringItem->numberOfValues() ||
+      !expressionStringItem->isSet(elements[i]))
+    {
+      log.addRecord(
+        smtk::io::Logger::ERROR,
+        "Missing element " + std::to_string(elements[i] + 1) + " needed for evaluation.");
+      success = false;
+      continue;
+    }
+    groups[expressionStringItem->value(elements[i])].push_back(i);
+  }
+
+  Memo memo;
   std::unordered_set<std::string> symbolsUsed;
+  for (const auto& group : groups)
+  {
+    const std::vector<std::size_t>& positions = group.second;
+    std::shared_ptr<const smtk::common::InfixExpressionProgram> program =
+      this->program(elements[positions.front()], log);
+    if (!program)
+    {
+      success = false;
+      continue;
+    }
 
-  // Tells |grammar| to attempt to create an Evaluator and evaluate() child
-  // expressions.
-  smtk::common::SubsymbolVisitor childExpressionVisitor =
-    [&symbolsUsed, &ctxtStorage, attSymbol, attRes, &log, element](const std::string& symbol) {
-      // Are we attempting to reference ourself?
-      if (attSymbol == symbol)
+    // Gathers the values of each referenced expression for every element of
+    // the group, and marks the elements for which one could not be evaluated.
+    const std::vector<std::string>& symbols = program->symbols();
+    std::vector<std::vector<double>> symbolValues(
+      symbols.size(), std::vector<double>(positions.size(), 0.0));
+    std::vector<bool> failed(positions.size(), false);
+    for (std::size_t j = 0; j < positions.size(); ++j)
+    {
+      for (std::size_t k = 0; k < symbols.size(); ++k)
       {
-        log.addRecord(
-          smtk::io::Logger::ERROR, "Cannot write " + attSymbol + " in terms of itself.");
-        return std::pair<double, bool>(0.0, false);
+        std::pair<double, bool> value =
+          this->evaluateSymbol(symbols[k], elements[positions[j]], log, memo, symbolsUsed);
+        if (!value.second || !isFinite(value.first))
+        {
+          logError(smtk::common::InfixExpressionError::ERROR_SUBEVALUATION_FAILED, log);
+          failed[j] = true;
+          break;
+        }
+        symbolValues[k][j] = value.first;
       }
+    }
+
+    std::vector<const double*> columns;
+    columns.reserve(symbols.size());
+    for (const auto& values : symbolValues)
+    {
+      columns.push_back(values.data());
+    }
+    std::vector<double> groupResults(positions.size());
+    program->evaluate(positions.size(), columns, groupResults.data());
 
-      // Are we attempting to reference a dependent expression?
-      // If we can reach |symbol| from |attSymbol|, this would be a cycle.
-      if (ctxtStorage.isDependentOn(attSymbol, symbol))
+    for (std::size_t j = 0; j < positions.size(); ++j)
+    {
+      if (failed[j])
       {
-        log.addRecord(
-          smtk::io::Logger::ERROR,
-          "Cannot use " + symbol + " in expression " + attSymbol + " because the expression " +
-            symbol + " already uses " + attSymbol + ".");
-        return std::pair<double, bool>(0.0, false);
+        success = false;
       }
-
-      symbolsUsed.insert(symbol);
-
-      // |attSymbol| is dependent on |symbol|.
-      ctxtStorage.addDependency(symbol, attSymbol);
-
-      smtk::attribute::AttributePtr childAtt = attRes->findAttribute(symbol);
-      if (!childAtt)
+      else if (!isFinite(groupResults[j]))
       {
-        log.addRecord(
-          smtk::io::Logger::ERROR, "Cannot find referenced attribute with name " + symbol);
-        return std::pair<double, bool>(0.0, false);
+        logError(smtk::common::InfixExpressionError::ERROR_MATH_ERROR, log);
+        success = false;
       }
-
-      std::unique_ptr<smtk::attribute::Evaluator> childEvaluator =
-        attRes->createEvaluator(childAtt);
-      if (childEvaluator)
+      else
       {
-        // Recursively evaluates this child so we can learn its result. evaluationMode
-        // is set to DO_NOT_EVALUATE_DEPENDENTS to prevent infinite recursion.
-        ValueType result;
-        if (childEvaluator->evaluate(
-              result, log, element, DependentEvaluationMode::DO_NOT_EVALUATE_DEPENDENTS))
-        {
-          try
-          {
-            // TODO: The result of evaluate() could be an int, but there are no
-            // Evaluators that currently return an int, so this is OK for now.
-            return std::pair<double, bool>(boost::get<double>(result), true);
-          }
-          catch (const boost::bad_get&)
-          {
-            // This tells us that the result of |childEvaluator| was not
-            // compatible with InfixExpressionEvaluator.
-            log.addRecord(
-              smtk::io::Logger::ERROR,
-              "Result type of child expression evaluation was not "
-              "compatible with an infix expression.");
-            return std::pair<double, bool>(0.0, false);
-          }
-        }
-        else
-        {
-          log.addRecord(smtk::io::Logger::ERROR, "Evaluation failed for " + symbol + ".");
-          return std::pair<double, bool>(0.0, false);
-        }
+        results[positions[j]] = groupResults[j];
       }
+    }
+  }
 
-      log.addRecord(
-        smtk::io::Logger::ERROR, "Referenced attribute " + symbol + " is not evaluatable");
-      return std::pair<double, bool>(0.0, false);
-    };
-  grammar.setSubsymbolVisitor(childExpressionVisitor);
+  if (success)
+  {
+    SymbolDependencyStorage& ctxtStorage = attRes->queries().cache<SymbolDependencyStorage>();
+    ctxtStorage.pruneOldSymbols(symbolsUsed, att->name());
+  }
+
+  return success;
+}
+
+bool smtk::attribute::InfixExpressionEvaluator::evaluate(
+  double& result,
+  smtk::io::Logger& log,
+  std::size_t element,
+  Memo& memo)
+{
+  smtk::attribute::ConstAttributePtr att = attribute().lock();
+  if (!att)
+  {
+    return false;
+  }
+
+  smtk::attribute::ResourcePtr attRes =
+    std::dynamic_pointer_cast<smtk::attribute::Resource>(att->resource());
+  if (!attRes)
+  {
+    return false;
+  }
+
+  std::shared_ptr<const smtk::common::InfixExpressionProgram> program =
+    this->program(element, log);
+  if (!program)
+  {
+    return false;
+  }
+
+  // Collects symbols used by this expression.
+  std::unordered_set<std::string> symbolsUsed;
+
+  std::vector<double> symbolValues;
+  symbolValues.reserve(program->symbols().size());
+  for (const std::string& symbol : program->symbols())
+  {
+    std::pair<double, bool> value = this->evaluateSymbol(symbol, element, log, memo, symbolsUsed);
+    if (!value.second || !isFinite(value.first))
+    {
+      logError(smtk::common::InfixExpressionError::ERROR_SUBEVALUATION_FAILED, log);
+      return false;
+    }
+    symbolValues.push_back(value.first);
+  }
+
+  const double evaluationResult = program->evaluate(symbolValues);
+  if (!isFinite(evaluationResult))
+  {
+    logError(smtk::common::InfixExpressionError::ERROR_MATH_ERROR, log);
+    return false;
+  }
+
+  result = evaluationResult;
+
+  // Need to know: what symbols list "a" as their dependent? if "a" no longer uses them,
+  // we need to remove the dependency.
+  SymbolDependencyStorage& ctxtStorage = attRes->queries().cache<SymbolDependencyStorage>();
+  ctxtStorage.pruneOldSymbols(symbolsUsed, att->name());
+
+  return true;
+}
+
+std::shared_ptr<const smtk::common::InfixExpressionProgram>
+smtk::attribute::InfixExpressionEvaluator::program(std::size_t element, smtk::io::Logger& log)
+  const
+{
+  smtk::attribute::ConstAttributePtr att = attribute().lock();
+  if (!att)
+  {
+    return nullptr;
+  }
+
+  smtk::attribute::ResourcePtr attRes =
+    std::dynamic_pointer_cast<smtk::attribute::Resource>(att->resource());
+  if (!attRes)
+  {
+    return nullptr;
+  }
 
   smtk::attribute::ConstStringItemPtr expressionStringItem = att->findString("expression");
   if (!expressionStringItem->isSet(element))
@@ -134,52 +385,132 @@ bool smtk::attribute::InfixExpressionEvaluator::evaluate(
     log.addRecord(
       smtk::io::Logger::ERROR,
       "Missing element " + std::to_string(element + 1) + " needed for evaluation.");
-    return false;
+    return nullptr;
   }
 
-  const std::string expressionStr = att->findString("expression")->value(element);
+  const CompiledExpressions::Entry& entry = attRes->queries().cache<CompiledExpressions>().entry(
+    att, element, expressionStringItem->value(element));
+  if (entry.error != smtk::common::InfixExpressionError::ERROR_NONE)
+  {
+    logError(entry.error, log);
+    return nullptr;
+  }
 
-  smtk::common::InfixExpressionError err = smtk::common::InfixExpressionError::ERROR_NONE;
-  const double evaluationResult = grammar.evaluate(expressionStr, err);
+  return entry.program;
+}
+
+std::pair<double, bool> smtk::attribute::InfixExpressionEvaluator::evaluateSymbol(
+  const std::string& symbol,
+  std::size_t element,
+  smtk::io::Logger& log,
+  Memo& memo,
+  std::unordered_set<std::string>& symbolsUsed)
+{
+  smtk::attribute::ConstAttributePtr att = attribute().lock();
+  if (!att)
+  {
+    return std::pair<double, bool>(0.0, false);
+  }
 
-  if (err == smtk::common::InfixExpressionError::ERROR_NONE)
+  smtk::attribute::ResourcePtr attRes =
+    std::dynamic_pointer_cast<smtk::attribute::Resource>(att->resource());
+  if (!attRes)
   {
-    result = evaluationResult;
+    return std::pair<double, bool>(0.0, false);
+  }
 
-    // Need to know: what symbols list "a" as their dependent? if "a" no longer uses them,
-    // we need to remove the dependency.
-    ctxtStorage.pruneOldSymbols(symbolsUsed, attSymbol);
+  const std::string attSymbol = att->name();
+  SymbolDependencyStorage& ctxtStorage = attRes->queries().cache<SymbolDependencyStorage>();
+
+  // Are we attempting to reference ourself?
+  if (attSymbol == symbol)
+  {
+    log.addRecord(smtk::io::Logger::ERROR, "Cannot write " + attSymbol + " in terms of itself.");
+    return std::pair<double, bool>(0.0, false);
+  }
 
-    if (evaluationMode == DependentEvaluationMode::EVALUATE_DEPENDENTS)
+  // Are we attempting to reference a dependent expression?
+  // If we can reach |symbol| from |attSymbol|, this would be a cycle.
+  if (ctxtStorage.isDependentOn(attSymbol, symbol))
+  {
+    log.addRecord(
+      smtk::io::Logger::ERROR,
+      "Cannot use " + symbol + " in expression " + attSymbol + " because the expression " +
+        symbol + " already uses " + attSymbol + ".");
+    return std::pair<double, bool>(0.0, false);
+  }
+
+  symbolsUsed.insert(symbol);
+
+  // |attSymbol| is dependent on |symbol|.
+  ctxtStorage.addDependency(symbol, attSymbol);
+
+  // Has |symbol| already been evaluated elsewhere in this expression tree?
+  auto memoized = memo.find(std::make_pair(symbol, element));
+  if (memoized != memo.end())
+  {
+    return std::pair<double, bool>(memoized->second, true);
+  }
+
+  smtk::attribute::AttributePtr childAtt = attRes->findAttribute(symbol);
+  if (!childAtt)
+  {
+    log.addRecord(smtk::io::Logger::ERROR, "Cannot find referenced attribute with name " + symbol);
+    return std::pair<double, bool>(0.0, false);
+  }
+
+  std::unique_ptr<smtk::attribute::Evaluator> childEvaluator = attRes->createEvaluator(childAtt);
+  if (childEvaluator)
+  {
+    double childResult;
+    bool childEvaluated;
+    if (auto* infixChild = dynamic_cast<InfixExpressionEvaluator*>(childEvaluator.get()))
     {
-      // allDependentSymbols() returns dependents in a level-order traversal order,
-      // so these evaluators will run in an order in keeping with the dependency ordering.
-      for (const std::string& dependent : ctxtStorage.allDependentSymbols(attSymbol))
+      // Infix children share |memo| so that expressions referenced by several
+      // of them are only evaluated once.
+      childEvaluated = infixChild->evaluate(childResult, log, element, memo);
+    }
+    else
+    {
+      // Recursively evaluates this child so we can learn its result. evaluationMode
+      // is set to DO_NOT_EVALUATE_DEPENDENTS to prevent infinite recursion.
+      ValueType result;
+      childEvaluated = childEvaluator->evaluate(
+        result, log, element, DependentEvaluationMode::DO_NOT_EVALUATE_DEPENDENTS);
+      if (childEvaluated)
       {
-        smtk::attribute::AttributePtr dependentAtt = attRes->findAttribute(dependent);
-        if (!att)
-          continue;
-
-        std::unique_ptr<smtk::attribute::Evaluator> dependentEvaluator =
-          attRes->createEvaluator(dependentAtt);
-        if (!dependentEvaluator)
-          continue;
-
-        ValueType dependentResult;
-        // evaluationMode is set to DO_NOT_EVALUATE_DEPENDENTS to prevent infinite recursion.
-        dependentEvaluator->evaluate(
-          dependentResult, log, element, DependentEvaluationMode::DO_NOT_EVALUATE_DEPENDENTS);
+        try
+        {
+          // TODO: The result of evaluate() could be an int, but there are no
+          // Evaluators that currently return an int, so this is OK for now.
+          childResult = boost::get<double>(result);
+        }
+        catch (const boost::bad_get&)
+        {
+          // This tells us that the result of |childEvaluator| was not
+          // compatible with InfixExpressionEvaluator.
+          log.addRecord(
+            smtk::io::Logger::ERROR,
+            "Result type of child expression evaluation was not "
+            "compatible with an infix expression.");
+          return std::pair<double, bool>(0.0, false);
+        }
       }
     }
 
-    return true;
-  }
-  else
-  {
-    logError(err, log);
+    if (!childEvaluated)
+    {
+      log.addRecord(smtk::io::Logger::ERROR, "Evaluation failed for " + symbol + ".");
+      return std::pair<double, bool>(0.0, false);
+    }
+
+    memo[std::make_pair(symbol, element)] = childResult;
+    return std::pair<double, bool>(childResult, true);
   }
 
-  return false;
+  log.addRecord(
+    smtk::io::Logger::ERROR, "Referenced attribute " + symbol + " is not evaluatable");
+  return std::pair<double, bool>(0.0, false);
 }
 
 // InfixExpressionEvaluates chooses not to place anything in the Logger at this
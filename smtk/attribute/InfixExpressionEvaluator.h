@@ -16,6 +16,13 @@
 #include "smtk/attribute/Evaluator.h"
 
 #include "smtk/common/InfixExpressionError.h"
+#include "smtk/common/InfixExpressionProgram.h"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace smtk
 {
@@ -36,6 +43,16 @@ public:
     const std::size_t& element,
     const DependentEvaluationMode& evalutionMode) override;
 
+  // Evaluates each of |elements|, placing their values in |results|. Elements
+  // with the same expression are evaluated together by its compiled program,
+  // and each referenced expression is evaluated once per element. Dependent
+  // expressions are not evaluated. Returns false if any element could not be
+  // evaluated; its result is NaN and the reason is in |log|.
+  bool evaluate(
+    std::vector<double>& results,
+    smtk::io::Logger& log,
+    const std::vector<std::size_t>& elements);
+
   bool canEvaluate(smtk::io::Logger& log) override;
 
   bool doesEvaluate(std::size_t element) override;
@@ -44,6 +61,29 @@ public:
   std::size_t numberOfEvaluatableElements() override;
 
 private:
+  // Values of referenced expressions that have been evaluated, by name and
+  // element, so that each is evaluated once per call to evaluate().
+  struct Memo;
+
+  // Evaluates |element| without evaluating dependent expressions.
+  bool evaluate(double& result, smtk::io::Logger& log, std::size_t element, Memo& memo);
+
+  // Returns the compiled expression at |element|, or nullptr (with errors in
+  // |log|) if it is unset or cannot be compiled. Programs are cached on the
+  // attribute resource and recompiled when the expression changes.
+  std::shared_ptr<const smtk::common::InfixExpressionProgram> program(
+    std::size_t element,
+    smtk::io::Logger& log) const;
+
+  // Returns the value at |element| of the expression named |symbol|, which is
+  // referenced by this expression, and adds |symbol| to |symbolsUsed|.
+  std::pair<double, bool> evaluateSymbol(
+    const std::string& symbol,
+    std::size_t element,
+    smtk::io::Logger& log,
+    Memo& memo,
+    std::unordered_set<std::string>& symbolsUsed);
+
   // Maps |err| to an error message and adds it as a record to |log|. Does
   // nothing if |err| == smtk::common::InfixExpressionError::ERROR_NONE.
   void logError(const smtk::common::InfixExpressionError& err, smtk::io::Logger& log) const;
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cassert>
 #include <sstream>
+#include <unordered_map>
 
 namespace smtk
 {
@@ -41,6 +42,96 @@ struct ReferenceItem::Cache
 {
 };
 
+/// Internally, ReferenceItems also index the ids of the objects they
+/// reference so that find() does not resolve every key. Each id maps to the
+/// first position holding it and the number of positions holding it, which
+/// lets most edits update the index in constant time. Edits that would
+/// require a scan (such as removing the first of several duplicates) mark
+/// the index invalid, and find() rebuilds it from the keys. Since links may
+/// also be removed outside of the item, find() checks each hit against the
+/// links and rebuilds the index if it is stale.
+struct ReferenceItem::Index
+{
+  struct Entry
+  {
+    std::size_t first;
+    std::size_t count;
+  };
+
+  void add(const smtk::common::UUID& id, std::size_t i)
+  {
+    if (!valid || id.isNull())
+    {
+      return;
+    }
+    auto it = entries.find(id);
+    if (it == entries.end())
+    {
+      entries[id] = Entry{ i, 1 };
+      return;
+    }
+    it->second.first = std::min(it->second.first, i);
+    ++it->second.count;
+  }
+
+  void remove(const smtk::common::UUID& id, std::size_t i)
+  {
+    if (!valid || id.isNull())
+    {
+      return;
+    }
+    auto it = entries.find(id);
+    if (it == entries.end())
+    {
+      return;
+    }
+    if (it->second.count == 1)
+    {
+      entries.erase(it);
+    }
+    else if (it->second.first == i)
+    {
+      this->invalidate();
+    }
+    else
+    {
+      --it->second.count;
+    }
+  }
+
+  // Remove the value at \a i and shift the positions that follow it.
+  void erase(const smtk::common::UUID& id, std::size_t i)
+  {
+    this->remove(id, i);
+    if (valid)
+    {
+      for (auto& entry : entries)
+      {
+        if (entry.second.first > i)
+        {
+          --entry.second.first;
+        }
+      }
+    }
+  }
+
+  void invalidate()
+  {
+    entries.clear();
+    valid = false;
+  }
+
+  // Index the values that are all unset.
+  void clear()
+  {
+    entries.clear();
+    valid = true;
+  }
+
+  std::unordered_map<smtk::common::UUID, Entry> entries;
+  bool valid = true;
+};
+
 namespace
 {
 class access_reference
@@ -211,6 +302,7 @@ ReferenceItem::ReferenceItem(Attribute* owningAttribute, int itemPosition)
   : Item(owningAttribute, itemPosition)
   , m_referencedAttribute(owningAttribute->shared_from_this())
   , m_cache(new Cache())
+  , m_index(new Index())
   , m_currentConditional(ReferenceItemDefinition::s_invalidIndex)
   , m_nextUnsetPos(-1)
 
@@ -221,6 +313,7 @@ ReferenceItem::ReferenceItem(Item* inOwningItem, int itemPosition, int mySubGrou
   : Item(inOwningItem, itemPosition, mySubGroupPosition)
   , m_referencedAttribute(inOwningItem->attribute())
   , m_cache(new Cache())
+  , m_index(new Index())
   , m_currentConditional(ReferenceItemDefinition::s_invalidIndex)
   , m_nextUnsetPos(-1)
 {
@@ -230,6 +323,7 @@ ReferenceItem::ReferenceItem(const ReferenceItem& referenceItem)
   : Item(referenceItem)
   , m_referencedAttribute(referenceItem.m_referencedAttribute)
   , m_cache(new Cache(*referenceItem.m_cache))
+  , m_index(new Index())
   , m_currentConditional(ReferenceItemDefinition::s_invalidIndex)
   , m_nextUnsetPos(-1)
 {
@@ -240,6 +334,7 @@ ReferenceItem& ReferenceItem::operator=(const ReferenceItem& referenceItem)
   Item::operator=(referenceItem);
   m_referencedAttribute = referenceItem.m_referencedAttribute;
   m_cache.reset(new ReferenceItem::Cache(*(referenceItem.m_cache)));
+  m_index->invalidate();
   m_nextUnsetPos = referenceItem.m_nextUnsetPos;
   return *this;
 }
@@ -342,6 +437,10 @@ bool ReferenceItem::setNumberOfValues(std::size_t newSize)
   {
     m_nextUnsetPos = currentSize + 1;
   }
+  if (newSize < currentSize)
+  {
+    m_index->invalidate();
+  }
   m_keys.resize(newSize);
   m_cache->resize(newSize);
   return true;
@@ -420,6 +519,8 @@ bool ReferenceItem::setObjectKey(std::size_t i, const smtk::attribute::Reference
   {
     myAtt->guardedLinks()->removeLink(m_keys[i]);
     m_keys[i] = key;
+    // The key's link may not be resolvable yet, so index it on demand.
+    m_index->invalidate();
     return true;
   }
   return false;
@@ -569,8 +670,16 @@ bool ReferenceItem::setValue(std::size_t i, const PersistentObjectPtr& val)
   AttributePtr myAtt = this->m_referencedAttribute.lock();
   if (myAtt != nullptr)
   {
+    if (m_index->valid)
+    {
+      m_index->remove(myAtt->guardedLinks()->linkedObjectId(m_keys[i]), i);
+    }
     myAtt->guardedLinks()->removeLink(m_keys[i]);
     m_keys[i] = this->linkTo(val);
+    if (!m_keys[i].first.isNull())
+    {
+      m_index->add(val->id(), i);
+    }
   }
   else
   {
@@ -615,16 +724,9 @@ bool ReferenceItem::appendValue(const PersistentObjectPtr& val, bool allowDuplic
   }
 
   // Next - are we doing an append unique?
-  if (!allowDuplicates)
+  if (!allowDuplicates && this->find(val) >= 0)
   {
-    std::size_t n = this->numberOfValues();
-    for (std::size_t i = 0; i < n; ++i)
-    {
-      if (this->isSet(i) && (this->value(i) == val))
-      {
-        return true;
-      }
-    }
+    return true;
   }
 
   // Do we have an unset value location?
@@ -644,6 +746,10 @@ bool ReferenceItem::appendValue(const PersistentObjectPtr& val, bool allowDuplic
   }
 
   m_keys.push_back(this->linkTo(val));
+  if (!m_keys.back().first.isNull())
+  {
+    m_index->add(val->id(), m_keys.size() - 1);
+  }
   appendToCache(val);
   return true;
 }
@@ -674,12 +780,94 @@ bool ReferenceItem::removeValue(std::size_t i)
     --m_nextUnsetPos;
   }
 
+  if (m_index->valid)
+  {
+    m_index->erase(myAtt->guardedLinks()->linkedObjectId(m_keys[i]), i);
+  }
   myAtt->guardedLinks()->removeLink(m_keys[i]);
   m_keys.erase(m_keys.begin() + i);
   (*m_cache).erase((*m_cache).begin() + i);
   return true;
 }
 
+bool ReferenceItem::removeValues(const smtk::common::UUIDs& ids)
+{
+  AttributePtr myAtt = this->m_referencedAttribute.lock();
+  if ((myAtt == nullptr) || ids.empty())
+  {
+    return false;
+  }
+
+  // Find the values to remove with a single pass over the keys.
+  std::vector<std::size_t> removed;
+  {
+    auto links = myAtt->guardedLinks();
+    for (std::size_t i = 0; i < m_keys.size(); ++i)
+    {
+      if (!m_keys[i].first.isNull() && ids.count(links->linkedObjectId(m_keys[i])))
+      {
+        removed.push_back(i);
+      }
+    }
+  }
+  if (removed.empty())
+  {
+    return false;
+  }
+
+  // As with removeValue(), values are erased until the item is down to its
+  // required number of values; the rest are unset.
+  std::size_t numberOfRequiredValues = this->numberOfRequiredValues();
+  std::size_t numberToErase = m_keys.size() > numberOfRequiredValues
+    ? std::min(removed.size(), m_keys.size() - numberOfRequiredValues)
+    : 0;
+  for (auto it = removed.begin() + numberToErase; it != removed.end(); ++it)
+  {
+    this->unset(*it);
+  }
+  if (numberToErase == 0)
+  {
+    return true;
+  }
+
+  {
+    auto links = myAtt->guardedLinks();
+    for (std::size_t j = 0; j < numberToErase; ++j)
+    {
+      links->removeLink(m_keys[removed[j]]);
+    }
+  }
+
+  // Shift the remaining values over the erased ones.
+  std::size_t next = removed[0];
+  std::size_t j = 0;
+  for (std::size_t i = removed[0]; i < m_keys.size(); ++i)
+  {
+    if ((j < numberToErase) && (removed[j] == i))
+    {
+      ++j;
+      continue;
+    }
+    m_keys[next] = m_keys[i];
+    (*m_cache)[next] = std::move((*m_cache)[i]);
+    ++next;
+  }
+  m_keys.resize(next);
+  m_cache->resize(next);
+  m_index->invalidate();
+
+  m_nextUnsetPos = -1;
+  for (std::size_t i = 0; i < m_keys.size(); ++i)
+  {
+    if (!this->isSet(i))
+    {
+      m_nextUnsetPos = i;
+      break;
+    }
+  }
+  return true;
+}
+
 void ReferenceItem::detachOwningResource()
 {
   AttributePtr myAtt = this->m_referencedAttribute.lock();
@@ -698,6 +886,7 @@ void ReferenceItem::detachOwningResource()
   // Flush keys
   m_keys.clear();
   m_keys.resize((*m_cache).size());
+  m_index->clear();
 
   // Let the base class detach from the resource
   Item::detachOwningResource();
@@ -718,6 +907,7 @@ void ReferenceItem::reset()
 
   // Flush keys
   m_keys.clear();
+  m_index->clear();
 
   (*m_cache).clear();
   if (this->numberOfRequiredValues() > 0)
@@ -853,17 +1043,53 @@ ReferenceItem::const_iterator ReferenceItem::end() const
 std::ptrdiff_t ReferenceItem::find(const smtk::common::UUID& uid) const
 {
   AttributePtr myAtt = this->m_referencedAttribute.lock();
-  if (myAtt != nullptr)
+  if (myAtt == nullptr)
+  {
+    return -1;
+  }
+
+  // The index is rebuilt on demand by this const method, so concurrent
+  // readers must not touch it at the same time. Holding the guarded links
+  // (and thus the attribute resource's mutex) for the whole lookup
+  // serializes them.
+  auto links = myAtt->guardedLinks();
+
+  // Unset values are not indexed.
+  if (uid.isNull())
   {
     for (std::size_t i = 0; i < m_keys.size(); ++i)
     {
-      if (uid == myAtt->guardedLinks()->linkedObjectId(m_keys[i]))
+      if (links->linkedObjectId(m_keys[i]).isNull())
       {
         return i;
       }
     }
+    return -1;
   }
-  return -1;
+
+  if (m_index->valid)
+  {
+    auto entry = m_index->entries.find(uid);
+    if (entry == m_index->entries.end())
+    {
+      return -1;
+    }
+
+    // Links may be removed without going through this item (e.g., when the
+    // referenced resource is removed from its manager), so verify the hit.
+    if (links->linkedObjectId(m_keys[entry->second.first]) == uid)
+    {
+      return static_cast<std::ptrdiff_t>(entry->second.first);
+    }
+  }
+
+  m_index->clear();
+  for (std::size_t i = 0; i < m_keys.size(); ++i)
+  {
+    m_index->add(links->linkedObjectId(m_keys[i]), i);
+  }
+  auto entry = m_index->entries.find(uid);
+  return entry != m_index->entries.end() ? static_cast<std::ptrdiff_t>(entry->second.first) : -1;
 }
 
 std::ptrdiff_t ReferenceItem::find(const PersistentObjectPtr& comp) const
@@ -1015,6 +1241,12 @@ void ReferenceItem::appendToCache(const PersistentObjectPtr& obj) const
   return assignToCache(i, obj);
 }
 
+void ReferenceItem::reserveValues(std::size_t n)
+{
+  m_keys.reserve(n);
+  m_cache->reserve(n);
+}
+
 bool ReferenceItem::removeInvalidValues()
 {
   bool valuesRemoved = false;
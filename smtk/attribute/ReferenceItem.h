@@ -245,6 +245,15 @@ public:
   bool setValues(I vbegin, I vend, typename std::iterator_traits<I>::difference_type offset = 0);
   template<typename I>
   bool appendValues(I vbegin, I vend);
+  /**\brief Append each value in [\a vbegin, \a vend) as appendValue() would.
+    *
+    * Storage for the new values is reserved once, and duplicates are
+    * detected using the item's index of referenced objects rather than by
+    * comparing against every value. Returns false if a value could not be
+    * appended; the values before it remain appended.
+    */
+  template<typename I>
+  bool appendValues(I vbegin, I vend, bool allowDuplicates);
 
   template<typename I, typename T>
   bool setValuesVia(
@@ -273,6 +282,14 @@ public:
     * from the array (reducing the number of values stored by 1).
     */
   bool removeValue(std::size_t i);
+  /**\brief Remove every value that references an object in \a ids.
+    *
+    * Values are removed as removeValue() would remove them - erased while
+    * the item holds more than its required number of values and unset
+    * afterwards - but the remaining values are compacted in a single pass
+    * rather than once per removal. Returns true if any value was removed.
+    */
+  bool removeValues(const smtk::common::UUIDs& ids);
   /// Release the item's dependency on its parent attribute's Resource.
   void detachOwningResource() override;
   /// Clear the list of values and fill it with null entries up to the number of required values.
@@ -426,9 +443,16 @@ private:
 
   void assignToCache(std::size_t i, const PersistentObjectPtr& obj) const;
   void appendToCache(const PersistentObjectPtr& obj) const;
+  void reserveValues(std::size_t n);
 
   struct Cache;
   mutable std::unique_ptr<Cache> m_cache;
+  /// The position of each referenced object (by UUID) so that find() does
+  /// not need to resolve every key. It is rebuilt on demand (by find(), while
+  /// holding the attribute resource's mutex) after edits that cannot cheaply
+  /// update it.
+  struct Index;
+  mutable std::unique_ptr<Index> m_index;
   /// Map of of all children items associated with the item
   std::map<std::string, smtk::attribute::ItemPtr> m_childrenItems;
   /// Vector of currently active children items
@@ -498,6 +522,20 @@ bool ReferenceItem::appendValues(I vbegin, I vend)
   return this->setValues(vbegin, vend, this->numberOfValues());
 }
 
+template<typename I>
+bool ReferenceItem::appendValues(I vbegin, I vend, bool allowDuplicates)
+{
+  this->reserveValues(this->numberOfValues() + std::distance(vbegin, vend));
+  for (I it = vbegin; it != vend; ++it)
+  {
+    if (iteratorIsSet(it) && !this->appendValue(*it, allowDuplicates))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 template<typename I, typename T>
 bool ReferenceItem::setValuesVia(
   I vbegin,
@@ -502,6 +502,14 @@ void Resource::finalizeDefinitions()
     std::set<std::string> catNames = it->second->categories().categoryNames();
     m_categories.insert(catNames.begin(), catNames.end());
   }
+  // The item definitions are now complete, so build the tables used to find
+  // items by name.
+  for (const auto& entry : m_definitions)
+  {
+    entry.second->resetItemLookup();
+    entry.second->itemLookup();
+  }
+  ++m_definitionStructureVersion;
 }
 
 void Resource::derivedDefinitions(
@@ -602,6 +610,7 @@ bool Resource::disassociate(const smtk::resource::ResourcePtr& resource)
 
 void Resource::updateDerivedDefinitionIndexOffsets(smtk::attribute::DefinitionPtr def)
 {
+  ++m_definitionStructureVersion;
   auto ddefs = m_derivedDefInfo[def];
   smtk::attribute::DefinitionPtr d;
   for (auto iter = ddefs.begin(); iter != ddefs.end(); ++iter)
@@ -1002,6 +1011,14 @@ std::function<bool(const smtk::resource::Component&)> Resource::queryOperation(
   return smtk::resource::filter::Filter<smtk::attribute::filter::Grammar>(filterString);
 }
 
+const smtk::resource::filter::Rules* Resource::queryRules(
+  const std::function<bool(const smtk::resource::Component&)>& queryOp) const
+{
+  const auto* filter =
+    queryOp.target<smtk::resource::filter::Filter<smtk::attribute::filter::Grammar>>();
+  return filter ? &filter->rules() : nullptr;
+}
+
 // visit all components in the resource.
 void Resource::visit(smtk::resource::Component::Visitor& visitor) const
 {
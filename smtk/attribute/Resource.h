@@ -204,6 +204,14 @@ public:
 
   void finalizeDefinitions();
 
+  ///\brief Return a counter that changes whenever the structure of the
+  /// resource's definitions may have changed.
+  ///
+  /// It is incremented by finalizeDefinitions() and whenever a definition
+  /// gains or loses items. Information derived from the definitions (such as
+  /// the validity of attributes) may be cached until it changes.
+  std::size_t definitionStructureVersion() const { return m_definitionStructureVersion; }
+
   ///@{
   ///\brief API for accessing Category information.
   ///
@@ -371,6 +379,8 @@ public:
 protected:
   Resource(const smtk::common::UUID& myID, smtk::resource::ManagerPtr manager);
   Resource(smtk::resource::ManagerPtr manager = nullptr);
+  const smtk::resource::filter::Rules* queryRules(
+    const std::function<bool(const smtk::resource::Component&)>& queryOp) const override;
   void internalFindAllDerivedDefinitions(
     smtk::attribute::DefinitionPtr def,
     bool onlyConcrete,
@@ -395,6 +405,7 @@ protected:
   std::set<std::string> m_categories;
   std::set<std::string> m_activeCategories;
   bool m_activeCategoriesEnabled = false;
+  std::size_t m_definitionStructureVersion = 0;
   smtk::attribute::Analyses m_analyses;
   std::map<std::string, smtk::view::ConfigurationPtr> m_views;
   std::map<std::string, std::map<std::string, smtk::view::Configuration::Component>> m_styles;
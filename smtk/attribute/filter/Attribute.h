@@ -12,6 +12,7 @@
 
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/Definition.h"
+#include "smtk/attribute/Resource.h"
 #include "smtk/resource/filter/Action.h"
 #include "smtk/resource/filter/Enclosed.h"
 #include "smtk/resource/filter/Name.h"
@@ -84,6 +85,34 @@ public:
     }
     return false;
   }
+
+  // The attributes derived from a Definition are indexed by the resource.
+  bool estimateCandidates(const smtk::resource::Resource& resource, std::size_t& count)
+    const override
+  {
+    const auto* attResource = dynamic_cast<const smtk::attribute::Resource*>(&resource);
+    if (!attResource)
+    {
+      return false;
+    }
+    count = attResource->findAttributes(m_typeName).size();
+    return true;
+  }
+
+  void visitCandidates(
+    const smtk::resource::Resource& resource,
+    const std::function<void(const smtk::common::UUID&)>& visitor) const override
+  {
+    const auto* attResource = dynamic_cast<const smtk::attribute::Resource*>(&resource);
+    if (attResource)
+    {
+      for (const auto& attribute : attResource->findAttributes(m_typeName))
+      {
+        visitor(attribute->id());
+      }
+    }
+  }
+
   std::string m_typeName;
 };
 
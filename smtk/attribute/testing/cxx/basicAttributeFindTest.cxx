@@ -204,4 +204,14 @@ int main()
   item->visitChildren(recursiveAccumulate, true);
   smtkTest(myItems.size() == 1, "Failed to recurse through a single item's children");
   smtkTest((myItems[0]->name() == "a-b-a"), "Failed to find child item");
+
+  // Item lookup tables are cached by the definition; changes to nested items
+  // take effect once the resource's definitions are finalized.
+  g_idef1->addItemDefinition<StringItemDefinitionPtr>("b-b-b");
+  resource->finalizeDefinitions();
+  AttributePtr att1 = resource->createAttribute("testAtt1", "testDef");
+  smtkTest((att1->find("b-b-b") != nullptr), "Could not find b-b-b after adding it");
+  smtkTest((att1->find("b-b-a") != nullptr), "Could not find b-b-a after adding b-b-b");
+  smtkTest((att1->find("b-b-b", IMMEDIATE) == nullptr), "Could find b-b-b using IMMEDIATE");
+  smtkTest((att->find("b-b-a") != nullptr), "Could not find b-b-a in an existing attribute");
 }
@@ -0,0 +1,101 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/DoubleItemDefinition.h"
+#include "smtk/attribute/GroupItemDefinition.h"
+#include "smtk/attribute/IntItemDefinition.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using smtk::model::testing::Timer;
+
+// Time named item lookup on an attribute whose definition holds a number of
+// immediate items followed by a chain of nested groups, the way operation
+// parameters are typically laid out. The depth of the chain may be passed
+// as an argument.
+
+int main(int argc, char* argv[])
+{
+  int depth = argc > 1 ? std::atoi(argv[1]) : 8;
+  const int numberOfItems = 16;
+  const int numberOfLookups = 1000000;
+
+  auto resource = smtk::attribute::Resource::create();
+  auto def = resource->createDefinition("benchmark");
+  std::vector<std::string> immediateNames;
+  for (int i = 0; i < numberOfItems; ++i)
+  {
+    immediateNames.push_back("item " + std::to_string(i));
+    def->addItemDefinition<smtk::attribute::DoubleItemDefinition>(immediateNames.back());
+  }
+
+  std::vector<std::string> deepNames;
+  auto group = def->addItemDefinition<smtk::attribute::GroupItemDefinition>("group 0");
+  for (int d = 1; d <= depth; ++d)
+  {
+    for (int i = 0; i < numberOfItems; ++i)
+    {
+      deepNames.push_back("item " + std::to_string(d) + "." + std::to_string(i));
+      group->addItemDefinition<smtk::attribute::IntItemDefinition>(deepNames.back());
+    }
+    group = group->addItemDefinition<smtk::attribute::GroupItemDefinition>(
+      "group " + std::to_string(d));
+  }
+
+  auto att = resource->createAttribute("benchmark");
+  Timer timer;
+  double deltaT;
+  bool ok = true;
+
+  timer.mark();
+  for (int i = 0; i < numberOfLookups; ++i)
+  {
+    const std::string& name = immediateNames[i % immediateNames.size()];
+    ok &= att->find(name) != nullptr;
+  }
+  deltaT = timer.elapsed();
+  std::cout << numberOfLookups << " immediate lookups " << deltaT << " seconds "
+            << (numberOfLookups / deltaT) << " lookups/sec\n";
+
+  timer.mark();
+  for (int i = 0; i < numberOfLookups; ++i)
+  {
+    const std::string& name = deepNames[i % deepNames.size()];
+    ok &= att->find(name) != nullptr;
+  }
+  deltaT = timer.elapsed();
+  std::cout << numberOfLookups << " nested lookups (depth " << depth << ") " << deltaT
+            << " seconds " << (numberOfLookups / deltaT) << " lookups/sec\n";
+
+  const std::string missing = "missing";
+  timer.mark();
+  for (int i = 0; i < numberOfLookups; ++i)
+  {
+    ok &= att->find(missing) == nullptr;
+  }
+  deltaT = timer.elapsed();
+  std::cout << numberOfLookups << " missed lookups " << deltaT << " seconds "
+            << (numberOfLookups / deltaT) << " lookups/sec\n";
+
+  if (!ok)
+  {
+    std::cerr << "Lookups returned unexpected items.\n";
+    return 1;
+  }
+  return 0;
+}
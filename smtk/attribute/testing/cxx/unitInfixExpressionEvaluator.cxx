@@ -22,6 +22,9 @@
 
 #include <boost/variant.hpp>
 
+#include <cmath>
+#include <vector>
+
 // clang-format off
 
 const std::string sbt = R"(
@@ -280,6 +283,79 @@ void testNumberOfEvaluatableElements()
     "Expected to have 2 evalutable elements after appending a string.")
 }
 
+// Compiled expressions are cached, so an edited expression must be recompiled.
+void testEditedExpressionIsRecompiled()
+{
+  smtk::attribute::ResourcePtr attRes = createResourceForTest();
+  smtk::attribute::DefinitionPtr infixExpDef = attRes->findDefinition("infixExpression");
+  smtk::attribute::AttributePtr expressionA = attRes->createAttribute("a", infixExpDef);
+  smtk::attribute::AttributePtr expressionB = attRes->createAttribute("b", infixExpDef);
+
+  expressionA->findString("expression")->setValue("2 * {b}");
+  expressionB->findString("expression")->setValue("3");
+
+  smtk::attribute::InfixExpressionEvaluator infixEvaluator(expressionA);
+  smtk::attribute::Evaluator::ValueType result;
+  smtk::io::Logger log;
+
+  smtkTest(
+    infixEvaluator.evaluate(
+      result, log, 0, smtk::attribute::Evaluator::DependentEvaluationMode::EVALUATE_DEPENDENTS),
+    "2 * {b} should evaluate successfully.");
+  smtkTest(boost::get<double>(result) == 6.0, "Incorrectly computed 2 * {b}, where b = 3.");
+
+  expressionB->findString("expression")->setValue("4");
+  expressionA->findString("expression")->setValue("{b} - 1");
+  smtkTest(
+    infixEvaluator.evaluate(
+      result, log, 0, smtk::attribute::Evaluator::DependentEvaluationMode::EVALUATE_DEPENDENTS),
+    "{b} - 1 should evaluate successfully.");
+  smtkTest(
+    boost::get<double>(result) == 3.0, "Expected the edited expressions to be recompiled.");
+  smtkTest(log.numberOfRecords() == 0, "Expected log to have no records.");
+}
+
+// Tests evaluating several elements at once.
+void testBatchEvaluation()
+{
+  smtk::attribute::ResourcePtr attRes = createResourceForTest();
+  smtk::attribute::DefinitionPtr infixExpDef = attRes->findDefinition("infixExpression");
+  smtk::attribute::AttributePtr expressionA = attRes->createAttribute("a", infixExpDef);
+  smtk::attribute::AttributePtr expressionB = attRes->createAttribute("b", infixExpDef);
+
+  smtk::attribute::StringItemPtr expressionsA = expressionA->findString("expression");
+  smtk::attribute::StringItemPtr expressionsB = expressionB->findString("expression");
+  expressionsA->setNumberOfValues(4);
+  expressionsB->setNumberOfValues(4);
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    expressionsA->setValue(i, i == 2 ? "{b} * {b}" : "{b} + 1");
+    expressionsB->setValue(i, std::to_string(i));
+  }
+
+  smtk::attribute::InfixExpressionEvaluator infixEvaluator(expressionA);
+  std::vector<double> results;
+  smtk::io::Logger log;
+
+  smtkTest(
+    infixEvaluator.evaluate(results, log, { 3, 0, 2, 1 }),
+    "Expected every element to evaluate successfully.");
+  smtkTest(log.numberOfRecords() == 0, "Expected log to have no records.");
+  smtkTest(
+    results == std::vector<double>({ 4.0, 1.0, 4.0, 2.0 }),
+    "Incorrectly computed a batch of elements.");
+
+  // Elements that cannot be evaluated are NaN; the others are still computed.
+  expressionsB->setValue(1, "1 / 0");
+  smtkTest(
+    !infixEvaluator.evaluate(results, log, { 0, 1, 5 }),
+    "Expected a batch with failing elements to fail.");
+  smtkTest(log.hasErrors(), "Expected the failures to be logged.");
+  smtkTest(
+    results.size() == 3 && results[0] == 1.0 && std::isnan(results[1]) && std::isnan(results[2]),
+    "Expected failing elements to be NaN.");
+}
+
 int unitInfixExpressionEvaluator(int /*argc*/, char** const /*argv*/)
 {
   testSimpleEvaluation();
@@ -291,6 +367,8 @@ int unitInfixExpressionEvaluator(int /*argc*/, char** const /*argv*/)
   testSetMultipleExpressionsOnSingleAttribute();
   testDoesEvaluate();
   testNumberOfEvaluatableElements();
+  testEditedExpressionIsRecompiled();
+  testBatchEvaluation();
 
   return 0;
 }
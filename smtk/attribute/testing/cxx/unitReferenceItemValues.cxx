@@ -0,0 +1,188 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/ReferenceItem.h"
+#include "smtk/attribute/ReferenceItemDefinition.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/model/Resource.h"
+#include "smtk/model/Vertex.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <thread>
+#include <vector>
+
+using namespace smtk::attribute;
+
+namespace
+{
+// Compare the item's indexed find() against a scan of its values.
+void checkFind(
+  const ReferenceItemPtr& item,
+  const std::vector<smtk::resource::PersistentObjectPtr>& objects)
+{
+  for (const auto& object : objects)
+  {
+    std::ptrdiff_t expected = -1;
+    for (std::size_t i = 0; i < item->numberOfValues(); ++i)
+    {
+      if (item->isSet(i) && item->value(i) == object)
+      {
+        expected = static_cast<std::ptrdiff_t>(i);
+        break;
+      }
+    }
+    smtkTest(
+      item->find(object) == expected,
+      "find() returned " << item->find(object) << " instead of " << expected);
+    smtkTest(item->contains(object->id()) == (expected >= 0), "contains() disagrees with find()");
+  }
+}
+} // namespace
+
+int unitReferenceItemValues(int /*unused*/, char* /*unused*/[])
+{
+  ResourcePtr resource = Resource::create();
+  smtk::model::Resource::Ptr modelResource = smtk::model::Resource::create();
+  resource->associate(modelResource);
+
+  DefinitionPtr def = resource->createDefinition("bc");
+  auto rule = def->createLocalAssociationRule();
+  def->setLocalAssociationMask(smtk::model::VERTEX);
+  rule->setIsExtensible(true);
+  AttributePtr att = resource->createAttribute("bc", def);
+  ReferenceItemPtr item = att->associations();
+
+  std::vector<smtk::resource::PersistentObjectPtr> vertices;
+  for (int i = 0; i < 100; ++i)
+  {
+    vertices.push_back(modelResource->addVertex().component());
+  }
+
+  // Appending in bulk skips duplicates within the range and in the item.
+  smtkTest(
+    item->appendValues(vertices.begin(), vertices.begin() + 60, false),
+    "Could not append the first vertices");
+  smtkTest(
+    item->appendValues(vertices.begin() + 40, vertices.end(), false),
+    "Could not append the remaining vertices");
+  smtkTest(item->numberOfValues() == 100, "Duplicates were appended");
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    smtkTest(item->find(vertices[i]) == static_cast<std::ptrdiff_t>(i), "Vertex out of place");
+  }
+
+  // Duplicates are indexed by their first position.
+  item->appendValue(vertices[10]);
+  checkFind(item, vertices);
+
+  // Removing a value shifts the values after it.
+  att->disassociate(vertices[5]);
+  checkFind(item, vertices);
+  smtkTest(!att->isObjectAssociated(vertices[5]), "Vertex was not disassociated");
+
+  // Removing the first of two duplicates finds the second.
+  item->removeValue(static_cast<std::size_t>(item->find(vertices[10])));
+  checkFind(item, vertices);
+  smtkTest(item->contains(vertices[10]), "Duplicate should still be present");
+
+  // Overwrite and unset values in place.
+  item->setValue(0, vertices[5]);
+  item->unset(1);
+  checkFind(item, vertices);
+
+  // Remove every other vertex at once.
+  smtk::common::UUIDs ids;
+  for (std::size_t i = 0; i < vertices.size(); i += 2)
+  {
+    ids.insert(vertices[i]->id());
+  }
+  std::size_t numberOfValues = item->numberOfValues();
+  smtkTest(item->removeValues(ids), "Could not remove values");
+  smtkTest(!item->removeValues(ids), "Removed values twice");
+  smtkTest(item->numberOfValues() == numberOfValues - 49, "Wrong number of values removed");
+  checkFind(item, vertices);
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    smtkTest(
+      item->contains(vertices[i]) == (i % 2 == 1 && i != 1),
+      "Wrong values removed (vertex " << i << ")");
+  }
+
+  // The unset value left above is filled before the item grows.
+  smtkTest(!item->isSet(1), "Expected the second value to be unset");
+  item->appendValue(vertices[2]);
+  smtkTest(item->find(vertices[2]) == 1, "Unset value was not reused");
+  checkFind(item, vertices);
+
+  // Items with required values unset them rather than erasing them.
+  DefinitionPtr fixedDef = resource->createDefinition("fixed");
+  auto fixedRule = fixedDef->createLocalAssociationRule();
+  fixedDef->setLocalAssociationMask(smtk::model::VERTEX);
+  fixedRule->setNumberOfRequiredValues(3);
+  AttributePtr fixed = resource->createAttribute("fixed", fixedDef);
+  ReferenceItemPtr fixedItem = fixed->associations();
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    smtkTest(fixedItem->setValue(i, vertices[i]), "Could not set required value " << i);
+  }
+  smtkTest(fixedItem->removeValues({ vertices[1]->id() }), "Could not remove a required value");
+  smtkTest(fixedItem->numberOfValues() == 3, "Required value was erased");
+  smtkTest(!fixedItem->isSet(1), "Required value was not unset");
+  checkFind(fixedItem, vertices);
+
+  // Concurrent readers may rebuild the index at the same time.
+  smtkTest(item->removeValues({ vertices[7]->id() }), "Could not remove vertex 7");
+  {
+    ConstReferenceItemPtr reader = item;
+    std::vector<std::vector<std::ptrdiff_t>> found(4);
+    std::vector<std::thread> threads;
+    for (auto& positions : found)
+    {
+      threads.emplace_back([&reader, &vertices, &positions]() {
+        for (const auto& vertex : vertices)
+        {
+          positions.push_back(reader->find(vertex));
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    checkFind(item, vertices);
+    for (const auto& positions : found)
+    {
+      for (std::size_t i = 0; i < vertices.size(); ++i)
+      {
+        smtkTest(positions[i] == item->find(vertices[i]), "Concurrent find() disagrees");
+      }
+    }
+  }
+
+  // Links removed without going through the item (as when the model resource
+  // is removed from its manager) are not found, so the vertices may be
+  // associated again.
+  smtkTest(item->contains(vertices[3]), "Expected vertex 3 to be associated");
+  smtkTest(
+    resource->links().removeAllLinksTo(modelResource), "Could not remove links to the model");
+  for (const auto& vertex : vertices)
+  {
+    smtkTest(item->find(vertex) == -1, "Found a vertex whose link was removed");
+    smtkTest(!item->contains(vertex->id()), "Contains a vertex whose link was removed");
+  }
+  smtkTest(item->appendValue(vertices[3], false), "Could not re-append vertex 3");
+  smtkTest(item->find(vertices[3]) >= 0, "Re-appended vertex was not linked");
+  smtkTest(att->isObjectAssociated(vertices[3]), "Re-appended vertex is not associated");
+
+  return 0;
+}
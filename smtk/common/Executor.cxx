@@ -0,0 +1,359 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/Executor.h"
+
+#include <exception>
+
+namespace smtk
+{
+namespace common
+{
+
+constexpr std::size_t Executor::NumberOfPriorities;
+
+namespace
+{
+// The executor whose worker is running on this thread, and the worker's index.
+thread_local const Executor* currentExecutor = nullptr;
+thread_local std::size_t currentWorker = 0;
+
+// Progress of a call to parallelFor().
+struct Loop
+{
+  std::mutex mutex;
+  std::condition_variable done;
+  std::size_t remaining;
+  std::exception_ptr exception;
+
+  void run(
+    const std::function<void(std::size_t, std::size_t)>& body,
+    std::size_t first,
+    std::size_t last)
+  {
+    std::exception_ptr thrown;
+    try
+    {
+      body(first, last);
+    }
+    catch (...)
+    {
+      thrown = std::current_exception();
+    }
+
+    // The waiting thread checks |remaining| while holding |mutex|, so this
+    // Loop is not destroyed until after it is unlocked here.
+    std::lock_guard<std::mutex> lock(mutex);
+    if (thrown && !exception)
+    {
+      exception = thrown;
+    }
+    if (--remaining == 0)
+    {
+      done.notify_all();
+    }
+  }
+};
+} // namespace
+
+Executor::Executor(unsigned int numberOfThreads)
+  : m_numberOfThreads(
+      numberOfThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : numberOfThreads)
+{
+  for (auto& pending : m_pendingOfPriority)
+  {
+    pending = 0;
+  }
+}
+
+Executor::~Executor()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    m_stopping = true;
+  }
+  m_wake.notify_all();
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+Executor& Executor::instance()
+{
+  static Executor executor;
+  return executor;
+}
+
+bool Executor::configure(unsigned int numberOfThreads)
+{
+  // The instance is constructed on first use but its workers are only started
+  // when it is first given a task, so it may be reconfigured until then.
+  Executor& executor = Executor::instance();
+  std::lock_guard<std::mutex> lock(executor.m_mutex);
+  if (executor.m_running)
+  {
+    return false;
+  }
+  executor.m_numberOfThreads =
+    numberOfThreads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : numberOfThreads;
+  return true;
+}
+
+void Executor::start()
+{
+  std::call_once(m_started, [this]() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running = true;
+
+    for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+    {
+      m_workerQueues.emplace_back(new Queues);
+    }
+    for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+    {
+      m_threads.emplace_back(&Executor::work, this, i);
+    }
+  });
+}
+
+void Executor::submit(std::function<void()> task, Priority priority)
+{
+  this->start();
+
+  std::size_t index = this->workerIndex();
+  Queues& queues = index < m_workerQueues.size() ? *m_workerQueues[index] : m_sharedQueues;
+  {
+    std::lock_guard<std::mutex> lock(queues.mutex);
+    queues.tasks[static_cast<std::size_t>(priority)].push_back(std::move(task));
+  }
+
+  // A worker increments |m_sleeping| before checking |m_pending| and this
+  // thread increments |m_pending| before checking |m_sleeping|, so either the
+  // worker sees the task or it is woken here.
+  ++m_pendingOfPriority[static_cast<std::size_t>(priority)];
+  ++m_pending;
+  if (m_sleeping > 0)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wake.notify_one();
+  }
+}
+
+bool Executor::runPendingTask()
+{
+  if (m_pending == 0)
+  {
+    return false;
+  }
+
+  std::function<void()> task;
+  bool low;
+  if (!this->take(this->workerIndex(), Priority::Normal, task, low))
+  {
+    return false;
+  }
+  task();
+  return true;
+}
+
+void Executor::parallelFor(
+  std::size_t begin,
+  std::size_t end,
+  std::size_t grainSize,
+  const std::function<void(std::size_t, std::size_t)>& body,
+  Priority priority)
+{
+  if (end <= begin)
+  {
+    return;
+  }
+  grainSize = grainSize == 0 ? 1 : grainSize;
+  const std::size_t numberOfChunks = (end - begin + grainSize - 1) / grainSize;
+  if (numberOfChunks == 1 || m_numberOfThreads == 1)
+  {
+    body(begin, end);
+    return;
+  }
+
+  // Submit all but the first subrange, which this thread runs itself.
+  Loop loop;
+  loop.remaining = numberOfChunks;
+  for (std::size_t first = begin + grainSize; first < end; first += grainSize)
+  {
+    const std::size_t last = std::min(end, first + grainSize);
+    this->submit([&loop, &body, first, last]() { loop.run(body, first, last); }, priority);
+  }
+  loop.run(body, begin, std::min(end, begin + grainSize));
+
+  std::unique_lock<std::mutex> lock(loop.mutex);
+  while (loop.remaining > 0)
+  {
+    lock.unlock();
+    bool ran = this->runPendingTask();
+    lock.lock();
+    if (!ran)
+    {
+      // The remaining subranges are running on other threads, which may yet
+      // submit nested tasks that this thread can help with.
+      loop.done.wait_for(lock, std::chrono::milliseconds(1));
+    }
+  }
+
+  if (loop.exception)
+  {
+    std::rethrow_exception(loop.exception);
+  }
+}
+
+void Executor::work(std::size_t index)
+{
+  currentExecutor = this;
+  currentWorker = index;
+
+  std::function<void()> task;
+  bool low;
+  while (true)
+  {
+    if (this->take(index, Priority::Low, task, low))
+    {
+      task();
+      task = nullptr;
+      if (low)
+      {
+        this->finishLow();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    ++m_sleeping;
+    m_wake.wait(lock, [this]() { return this->runnable() || m_stopping; });
+    --m_sleeping;
+    if (m_stopping && m_pending == 0)
+    {
+      return;
+    }
+  }
+}
+
+bool Executor::take(std::size_t index, Priority lowest, std::function<void()>& task, bool& low)
+{
+  const std::size_t numberOfWorkers = m_workerQueues.size();
+  const std::size_t lowPriority = static_cast<std::size_t>(Priority::Low);
+  for (std::size_t priority = 0; priority <= static_cast<std::size_t>(lowest); ++priority)
+  {
+    if (m_pendingOfPriority[priority] == 0)
+    {
+      continue;
+    }
+
+    // Reserve capacity to run a Low priority task before looking for one.
+    low = priority == lowPriority;
+    if (low)
+    {
+      std::size_t running = m_runningLow;
+      do
+      {
+        if (running >= this->lowPriorityCapacity())
+        {
+          return false;
+        }
+      } while (!m_runningLow.compare_exchange_weak(running, running + 1));
+    }
+
+    // Run this worker's newest task,
+    if (index < numberOfWorkers)
+    {
+      Queues& queues = *m_workerQueues[index];
+      std::lock_guard<std::mutex> lock(queues.mutex);
+      auto& tasks = queues.tasks[priority];
+      if (!tasks.empty())
+      {
+        task = std::move(tasks.back());
+        tasks.pop_back();
+        --m_pendingOfPriority[priority];
+        --m_pending;
+        return true;
+      }
+    }
+
+    // ...or the oldest task submitted from outside the workers,
+    {
+      std::lock_guard<std::mutex> lock(m_sharedQueues.mutex);
+      auto& tasks = m_sharedQueues.tasks[priority];
+      if (!tasks.empty())
+      {
+        task = std::move(tasks.front());
+        tasks.pop_front();
+        --m_pendingOfPriority[priority];
+        --m_pending;
+        return true;
+      }
+    }
+
+    // ...or steal the oldest task of another worker.
+    for (std::size_t i = 1; i <= numberOfWorkers; ++i)
+    {
+      std::size_t victim = (index + i) % numberOfWorkers;
+      if (victim == index)
+      {
+        continue;
+      }
+      Queues& queues = *m_workerQueues[victim];
+      std::lock_guard<std::mutex> lock(queues.mutex);
+      auto& tasks = queues.tasks[priority];
+      if (!tasks.empty())
+      {
+        task = std::move(tasks.front());
+        tasks.pop_front();
+        --m_pendingOfPriority[priority];
+        --m_pending;
+        return true;
+      }
+    }
+
+    if (low)
+    {
+      this->finishLow();
+    }
+  }
+  return false;
+}
+
+void Executor::finishLow()
+{
+  // A worker increments |m_sleeping| before checking runnable(), so either
+  // it sees the released capacity or it is woken here.
+  --m_runningLow;
+  if (m_pendingOfPriority[static_cast<std::size_t>(Priority::Low)] > 0 && m_sleeping > 0)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wake.notify_one();
+  }
+}
+
+bool Executor::runnable() const
+{
+  const std::size_t pendingLow = m_pendingOfPriority[static_cast<std::size_t>(Priority::Low)];
+  return m_pending > pendingLow ||
+    (pendingLow > 0 && m_runningLow < this->lowPriorityCapacity());
+}
+
+std::size_t Executor::workerIndex() const
+{
+  return currentExecutor == this ? currentWorker : m_workerQueues.size();
+}
+} // namespace common
+} // namespace smtk
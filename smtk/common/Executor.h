@@ -0,0 +1,248 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#ifndef smtk_common_Executor_h
+#define smtk_common_Executor_h
+
+#include "smtk/CoreExports.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+/// A pool of worker threads that share tasks by work stealing.
+///
+/// Each worker keeps its own queue of tasks for each priority. Tasks submitted
+/// by a worker go to its own queue, where the worker runs the newest first;
+/// idle workers steal the oldest tasks from the others. Tasks submitted by
+/// other threads go to a queue shared by all workers. Pending tasks of higher
+/// priority are always started before those of lower priority.
+///
+/// Threads waiting on work they submitted (see wait(), parallelFor() and
+/// parallelReduce()) run other pending tasks in the meantime, so parallel
+/// work may be nested within tasks without exhausting the workers. Waiting
+/// threads never start Low priority tasks, which are reserved for long-running
+/// work (such as operations) that may block on locks held by the waiter.
+/// At most one fewer Low priority tasks than there are workers run at once
+/// (when there is more than one worker), so blocked Low priority tasks cannot
+/// keep other work from starting.
+///
+/// The process-wide instance() is shared by ThreadPool, the operation
+/// launchers and SMTK's parallel algorithms so that they do not each create
+/// a thread per core.
+class SMTKCORE_EXPORT Executor
+{
+public:
+  enum class Priority
+  {
+    High,
+    Normal,
+    Low
+  };
+
+  /// Construct an executor with \a numberOfThreads workers (one per core if
+  /// 0). Workers are started when the first task is submitted.
+  Executor(unsigned int numberOfThreads = 0);
+
+  /// Run any remaining tasks and join the workers.
+  ~Executor();
+
+  Executor(const Executor&) = delete;
+  Executor& operator=(const Executor&) = delete;
+
+  /// The process-wide executor.
+  static Executor& instance();
+
+  /// Set the number of workers of the process-wide executor (one per core if
+  /// 0). This has no effect and returns false once instance() has started
+  /// running tasks.
+  static bool configure(unsigned int numberOfThreads);
+
+  unsigned int numberOfThreads() const { return m_numberOfThreads; }
+
+  /// The number of Low priority tasks that may run at once.
+  std::size_t lowPriorityCapacity() const
+  {
+    unsigned int numberOfThreads = m_numberOfThreads;
+    return numberOfThreads > 1 ? numberOfThreads - 1 : 1;
+  }
+
+  /// Schedule \a task to be run by a worker. The task must not throw; use
+  /// async() for tasks whose exceptions should be reported.
+  void submit(std::function<void()> task, Priority priority = Priority::Normal);
+
+  /// Schedule \a function to be run by a worker and return its result as a
+  /// future.
+  template<typename Function>
+  auto async(Function&& function, Priority priority = Priority::Normal)
+    -> std::future<decltype(function())>;
+
+  /// Run a single pending task (but not a Low priority one) on the calling
+  /// thread. Returns false if there was none to run.
+  bool runPendingTask();
+
+  /// Block until \a future is ready, running pending tasks in the meantime.
+  template<typename Future>
+  void wait(const Future& future);
+
+  /// Call \a body(first, last) over subranges of [\a begin, \a end) of at
+  /// most \a grainSize indices, in parallel. The calling thread takes part and
+  /// returns once every subrange is done. If \a body throws, the first
+  /// exception is rethrown after the remaining subranges finish.
+  void parallelFor(
+    std::size_t begin,
+    std::size_t end,
+    std::size_t grainSize,
+    const std::function<void(std::size_t, std::size_t)>& body,
+    Priority priority = Priority::Normal);
+
+  /// Reduce [\a begin, \a end) by calling \a map(first, last) on subranges of
+  /// at most \a grainSize indices in parallel and folding the results into
+  /// \a identity with \a combine. Results are combined in the order of their
+  /// subranges, so \a combine need not be commutative.
+  template<typename T, typename Map, typename Combine>
+  T parallelReduce(
+    std::size_t begin,
+    std::size_t end,
+    std::size_t grainSize,
+    T identity,
+    const Map& map,
+    const Combine& combine,
+    Priority priority = Priority::Normal);
+
+private:
+  static constexpr std::size_t NumberOfPriorities = 3;
+
+  struct Queues
+  {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks[NumberOfPriorities];
+  };
+
+  void start();
+  void work(std::size_t index);
+
+  // Take the next task to run from the queues visible to the worker \a index
+  // (or, if \a index is the number of workers, to a thread that is not a
+  // worker), considering priorities up to and including \a lowest. A Low
+  // priority task is only taken if lowPriorityCapacity() allows it, in which
+  // case \a low is set and the caller must call finishLow() after running it.
+  bool take(std::size_t index, Priority lowest, std::function<void()>& task, bool& low);
+
+  // Release the capacity reserved for a Low priority task by take().
+  void finishLow();
+
+  // True when a sleeping worker has a task it may take.
+  bool runnable() const;
+
+  // The index of the calling thread if it is one of this executor's workers,
+  // or the number of workers otherwise.
+  std::size_t workerIndex() const;
+
+  // Guards configuration of the executor against it being started.
+  std::mutex m_mutex;
+  std::atomic<unsigned int> m_numberOfThreads;
+  bool m_running{ false };
+  std::once_flag m_started;
+  std::vector<std::thread> m_threads;
+  std::vector<std::unique_ptr<Queues>> m_workerQueues;
+  Queues m_sharedQueues;
+
+  // The number of queued tasks, in total and of each priority.
+  std::atomic<std::size_t> m_pending{ 0 };
+  std::atomic<std::size_t> m_pendingOfPriority[NumberOfPriorities];
+  // The number of Low priority tasks running.
+  std::atomic<std::size_t> m_runningLow{ 0 };
+  std::atomic<std::size_t> m_sleeping{ 0 };
+  std::atomic<bool> m_stopping{ false };
+  std::mutex m_sleepMutex;
+  std::condition_variable m_wake;
+};
+
+template<typename Function>
+auto Executor::async(Function&& function, Priority priority) -> std::future<decltype(function())>
+{
+  typedef decltype(function()) ReturnType;
+  // std::function requires a copyable target, so the packaged task is shared.
+  auto task = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<Function>(function));
+  std::future<ReturnType> future = task->get_future();
+  this->submit([task]() { (*task)(); }, priority);
+  return future;
+}
+
+template<typename Future>
+void Executor::wait(const Future& future)
+{
+  while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+  {
+    if (!this->runPendingTask())
+    {
+      // Whatever \a future depends upon is already running elsewhere, but it
+      // may yet submit tasks that this thread can help with.
+      future.wait_for(std::chrono::milliseconds(1));
+    }
+  }
+}
+
+template<typename T, typename Map, typename Combine>
+T Executor::parallelReduce(
+  std::size_t begin,
+  std::size_t end,
+  std::size_t grainSize,
+  T identity,
+  const Map& map,
+  const Combine& combine,
+  Priority priority)
+{
+  if (end <= begin)
+  {
+    return identity;
+  }
+  grainSize = grainSize == 0 ? 1 : grainSize;
+  const std::size_t numberOfChunks = (end - begin + grainSize - 1) / grainSize;
+  std::vector<T> partials(numberOfChunks, identity);
+  this->parallelFor(
+    0,
+    numberOfChunks,
+    1,
+    [&](std::size_t first, std::size_t last) {
+      for (std::size_t chunk = first; chunk < last; ++chunk)
+      {
+        const std::size_t chunkBegin = begin + chunk * grainSize;
+        partials[chunk] = map(chunkBegin, std::min(end, chunkBegin + grainSize));
+      }
+    },
+    priority);
+
+  T result = std::move(identity);
+  for (auto& partial : partials)
+  {
+    result = combine(std::move(result), std::move(partial));
+  }
+  return result;
+}
+} // namespace common
+} // namespace smtk
+
+#endif // smtk_common_Executor_h
@@ -52,20 +52,30 @@ SubsymbolVisitor InfixExpressionGrammar::subsymbolVisitor() const
 double InfixExpressionGrammar::evaluate(const std::string& expression, InfixExpressionError& err)
   const
 {
-  // Freshen up |err|.
-  err = InfixExpressionError::ERROR_NONE;
+  InfixExpressionProgram program;
+  err = compile(expression, program);
 
-  InfixOperators ops;
-  EvaluationStacks s;
+  if (err != InfixExpressionError::ERROR_NONE)
+  {
+    return std::nan("");
+  }
 
-  err = testExpressionSyntax(expression, ops, s);
+  return evaluate(program, err);
+}
+
+double InfixExpressionGrammar::evaluate(
+  const InfixExpressionProgram& program,
+  InfixExpressionError& err) const
+{
+  std::vector<double> values;
+  err = visitSymbols(program, values);
 
   if (err != InfixExpressionError::ERROR_NONE)
   {
     return std::nan("");
   }
 
-  double result = s.finish();
+  double result = program.evaluate(values);
   // It's important to note that we can check global |errno| to learn of a more
   // specific math-related error code (EDOM or ERANGE). ONLY AS LONG AS NOTHING
   // ELSE SETS |errno| BETWEEN THEN AND NOW.
@@ -80,26 +90,33 @@ double InfixExpressionGrammar::evaluate(const std::string& expression, InfixExpr
 InfixExpressionError InfixExpressionGrammar::testExpressionSyntax(
   const std::string& expression) const
 {
-  InfixOperators ops;
-  EvaluationStacks s;
+  InfixExpressionProgram program;
+  InfixExpressionError err = compile(expression, program);
+  if (err != InfixExpressionError::ERROR_NONE)
+  {
+    return err;
+  }
 
-  return testExpressionSyntax(expression, ops, s);
+  std::vector<double> values;
+  return visitSymbols(program, values);
 }
 
-InfixExpressionError InfixExpressionGrammar::testExpressionSyntax(
+InfixExpressionError InfixExpressionGrammar::compile(
   const std::string& expression,
-  InfixOperators& ops,
-  EvaluationStacks& stacks) const
+  InfixExpressionProgram& program) const
 {
   InfixExpressionError err = InfixExpressionError::ERROR_NONE;
 
   tao::pegtl::string_input<> in(expression, "ExpressionParser");
 
+  InfixOperators ops;
+  CompilationStacks stacks(program);
   try
   {
     tao::pegtl::
       parse<expression_internal::expression_grammar, expression_internal::ExpressionAction>(
-        in, ops, stacks, m_functions, m_subsymbolVisitor, err);
+        in, ops, stacks, m_functions, err);
+    stacks.finish();
   }
   catch (tao::pegtl::parse_error& /*parse_err*/)
   {
@@ -117,8 +134,33 @@ InfixExpressionError InfixExpressionGrammar::testExpressionSyntax(
     }
   }
 
+  if (err != InfixExpressionError::ERROR_NONE)
+  {
+    program = InfixExpressionProgram();
+  }
   return err;
 }
 
+InfixExpressionError InfixExpressionGrammar::visitSymbols(
+  const InfixExpressionProgram& program,
+  std::vector<double>& values) const
+{
+  values.clear();
+  values.reserve(program.symbols().size());
+  for (const auto& symbol : program.symbols())
+  {
+    std::pair<double, bool> result = m_subsymbolVisitor(symbol);
+
+    // TODO: if a subexpression evaluates to nan or inf, isn't that really a
+    // math error?
+    if (!result.second || std::isnan(result.first) || std::isinf(result.first))
+    {
+      return InfixExpressionError::ERROR_SUBEVALUATION_FAILED;
+    }
+    values.push_back(result.first);
+  }
+  return InfixExpressionError::ERROR_NONE;
+}
+
 } // namespace common
 } // namespace smtk
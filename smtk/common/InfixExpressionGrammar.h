@@ -19,6 +19,7 @@
 
 #include "smtk/common/InfixExpressionError.h"
 #include "smtk/common/InfixExpressionEvaluation.h"
+#include "smtk/common/InfixExpressionProgram.h"
 
 namespace smtk
 {
@@ -44,6 +45,21 @@ public:
   // ERROR_MATH_ERROR.
   double evaluate(const std::string& expression, InfixExpressionError& err) const;
 
+  // Evaluates a |program| produced by compile(), calling the subsymbol visitor
+  // once for each of its symbols. Sets |err| to ERROR_SUBEVALUATION_FAILED if
+  // the visitor fails and to ERROR_MATH_ERROR if the result is not finite.
+  double evaluate(const InfixExpressionProgram& program, InfixExpressionError& err) const;
+
+  // Parses |expression| into |program| so that it may be evaluated repeatedly
+  // without being parsed again. Subsymbols are not visited.
+  // Returns:
+  //      ERROR_NONE if successful.
+  //      ERROR_INVALID_SYNTAX if |expression| is not a valid infix expression.
+  //      ERROR_UNKNOWN_FUNCTION if |expression| uses a function not in |m_functions|.
+  // On failure, |program| is left empty.
+  InfixExpressionError compile(const std::string& expression, InfixExpressionProgram& program)
+    const;
+
   // Tests |expression| for possible errors, without computing its result.
   // Returns:
   //      ERROR_NONE if successful.
@@ -53,10 +69,11 @@ public:
   InfixExpressionError testExpressionSyntax(const std::string& expression) const;
 
 private:
-  InfixExpressionError testExpressionSyntax(
-    const std::string& expression,
-    InfixOperators& ops,
-    EvaluationStacks& stacks) const;
+  // Calls the subsymbol visitor for each of |program|'s symbols, collecting
+  // their values in |values|.
+  InfixExpressionError visitSymbols(
+    const InfixExpressionProgram& program,
+    std::vector<double>& values) const;
 
   InfixFunctions m_functions;
   SubsymbolVisitor m_subsymbolVisitor;
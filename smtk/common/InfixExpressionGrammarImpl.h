@@ -20,6 +20,7 @@
 
 #include "smtk/common/InfixExpressionError.h"
 #include "smtk/common/InfixExpressionEvaluation.h"
+#include "smtk/common/InfixExpressionProgram.h"
 
 #include <tao/pegtl.hpp>
 #include <tao/pegtl/contrib/abnf.hpp>
@@ -130,9 +131,8 @@ struct ExpressionAction<number>
   static void apply(
     const ActionInput& in,
     const InfixOperators& /* unused */,
-    EvaluationStacks& s,
+    CompilationStacks& s,
     const InfixFunctions& /* unused */,
-    const SubsymbolVisitor& /* unused */,
     InfixExpressionError& /* unused: if we matched a number, this cannot be an invalid token */)
   {
     std::stringstream ss(in.string());
@@ -149,9 +149,8 @@ struct ExpressionAction<infix_operator>
   static void apply(
     const ActionInput& in,
     const InfixOperators& b,
-    EvaluationStacks& s,
+    CompilationStacks& s,
     const InfixFunctions& /* unused */,
-    const SubsymbolVisitor& /* unused */,
     InfixExpressionError& err)
   {
     std::string str = in.string();
@@ -177,9 +176,8 @@ struct ExpressionAction<function_name>
   static void apply(
     const ActionInput& in,
     const InfixOperators& /* unused */,
-    EvaluationStacks& s,
+    CompilationStacks& s,
     const InfixFunctions& funcs,
-    const SubsymbolVisitor& /* unused */,
     InfixExpressionError& err)
   {
     std::string str = in.string();
@@ -207,28 +205,15 @@ struct ExpressionAction<subsymbol_reference>
   static void apply(
     const ActionInput& in,
     const InfixOperators& /* unused */,
-    EvaluationStacks& s,
+    CompilationStacks& s,
     const InfixFunctions& /* unused */,
-    const SubsymbolVisitor& subFunc,
-    InfixExpressionError& err)
+    InfixExpressionError& /* unused */)
   {
     std::string str = in.string();
 
-    // A substring that excludes the braces. I.e, "abc" is passed to subFunc
-    // when we matched "{abc}".
-    std::pair<double, bool> result = subFunc(str.substr(1, str.size() - 2));
-
-    // TODO: if a subexpression evaluates to nan or inf, isn't that really a
-    // math error?
-    if (!result.second || std::isnan(result.first) || std::isinf(result.first))
-    {
-      err = InfixExpressionError::ERROR_SUBEVALUATION_FAILED;
-      throw parse_error("Subexpression could not be evaluated.", in);
-    }
-    else
-    {
-      s.push(result.first);
-    }
+    // A substring that excludes the braces. I.e, "abc" is the symbol when we
+    // matched "{abc}". Its value is provided when the program is evaluated.
+    s.pushSymbol(str.substr(1, str.size() - 2));
   }
 };
 
@@ -237,9 +222,8 @@ struct ExpressionAction<one<'('>>
 {
   static void apply0(
     const InfixOperators& /* unused */,
-    EvaluationStacks& s,
+    CompilationStacks& s,
     const InfixFunctions& /* unused */,
-    const SubsymbolVisitor& /* unused */,
     InfixExpressionError& /* unused */)
   {
     s.open();
@@ -251,9 +235,8 @@ struct ExpressionAction<one<')'>>
 {
   static void apply0(
     const InfixOperators& /* unused */,
-    EvaluationStacks& s,
+    CompilationStacks& s,
     const InfixFunctions& /* unused */,
-    const SubsymbolVisitor& /* unused */,
     InfixExpressionError& /* unused */)
   {
     s.close();
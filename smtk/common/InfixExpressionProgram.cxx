@@ -0,0 +1,204 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/InfixExpressionProgram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace smtk
+{
+namespace common
+{
+
+namespace
+{
+// The number of evaluations each instruction is applied to at once by the
+// batched evaluate().
+constexpr std::size_t blockSize = 128;
+} // namespace
+
+double InfixExpressionProgram::evaluate(const std::vector<double>& symbolValues) const
+{
+  if (m_instructions.empty())
+  {
+    return std::nan("");
+  }
+
+  std::vector<double> stack(m_stackSize);
+  std::size_t top = 0;
+  for (const auto& instruction : m_instructions)
+  {
+    switch (instruction.kind)
+    {
+      case Instruction::Kind::CONSTANT:
+        stack[top++] = instruction.constant;
+        break;
+      case Instruction::Kind::SYMBOL:
+        stack[top++] = symbolValues[instruction.symbol];
+        break;
+      case Instruction::Kind::OPERATOR:
+        --top;
+        stack[top - 1] = instruction.op(stack[top - 1], stack[top]);
+        break;
+      case Instruction::Kind::FUNCTION:
+        stack[top - 1] = instruction.function(stack[top - 1]);
+        break;
+    }
+  }
+  return stack[0];
+}
+
+void InfixExpressionProgram::evaluate(
+  std::size_t count,
+  const std::vector<const double*>& symbolValues,
+  double* results) const
+{
+  if (m_instructions.empty())
+  {
+    std::fill(results, results + count, std::nan(""));
+    return;
+  }
+
+  // Each entry of the stack holds the operands of a block of evaluations.
+  std::vector<double> stack(m_stackSize * blockSize);
+  for (std::size_t begin = 0; begin < count; begin += blockSize)
+  {
+    const std::size_t n = std::min(blockSize, count - begin);
+    double* top = stack.data();
+    for (const auto& instruction : m_instructions)
+    {
+      switch (instruction.kind)
+      {
+        case Instruction::Kind::CONSTANT:
+          std::fill(top, top + n, instruction.constant);
+          top += blockSize;
+          break;
+        case Instruction::Kind::SYMBOL:
+        {
+          const double* values = symbolValues[instruction.symbol] + begin;
+          std::copy(values, values + n, top);
+          top += blockSize;
+          break;
+        }
+        case Instruction::Kind::OPERATOR:
+        {
+          top -= blockSize;
+          double* l = top - blockSize;
+          for (std::size_t i = 0; i < n; ++i)
+          {
+            l[i] = instruction.op(l[i], top[i]);
+          }
+          break;
+        }
+        case Instruction::Kind::FUNCTION:
+        {
+          double* x = top - blockSize;
+          for (std::size_t i = 0; i < n; ++i)
+          {
+            x[i] = instruction.function(x[i]);
+          }
+          break;
+        }
+      }
+    }
+    std::copy(stack.data(), stack.data() + n, results + begin);
+  }
+}
+
+CompilationStacks::CompilationStacks(InfixExpressionProgram& program)
+  : m_program(program)
+{
+  m_program = InfixExpressionProgram();
+  open();
+}
+
+void CompilationStacks::open()
+{
+  // The result of this StackLevel is itself unless |m_functionForNextOpen|
+  // is set before the next call to open().
+  m_stacks.push_back(StackLevel{ std::vector<InfixOperator>(), m_functionForNextOpen });
+  m_functionForNextOpen = nullptr;
+}
+
+void CompilationStacks::push(const InfixOperator& b)
+{
+  auto& operators = m_stacks.back().operators;
+  while (!operators.empty() && operators.back().p <= b.p)
+  {
+    reduce();
+  }
+  operators.push_back(b);
+}
+
+void CompilationStacks::push(double l)
+{
+  InfixExpressionProgram::Instruction instruction;
+  instruction.kind = InfixExpressionProgram::Instruction::Kind::CONSTANT;
+  instruction.constant = l;
+  emit(std::move(instruction), 1);
+}
+
+void CompilationStacks::pushSymbol(const std::string& symbol)
+{
+  auto& symbols = m_program.m_symbols;
+  InfixExpressionProgram::Instruction instruction;
+  instruction.kind = InfixExpressionProgram::Instruction::Kind::SYMBOL;
+  instruction.symbol = std::find(symbols.begin(), symbols.end(), symbol) - symbols.begin();
+  if (instruction.symbol == symbols.size())
+  {
+    symbols.push_back(symbol);
+  }
+  emit(std::move(instruction), 1);
+}
+
+void CompilationStacks::close()
+{
+  // finish()es the stack and applies this StackLevel's function to the result.
+  while (!m_stacks.back().operators.empty())
+  {
+    reduce();
+  }
+  if (m_stacks.back().function)
+  {
+    InfixExpressionProgram::Instruction instruction;
+    instruction.kind = InfixExpressionProgram::Instruction::Kind::FUNCTION;
+    instruction.function = m_stacks.back().function;
+    emit(std::move(instruction), 0);
+  }
+  m_stacks.pop_back();
+}
+
+void CompilationStacks::finish()
+{
+  while (!m_stacks.back().operators.empty())
+  {
+    reduce();
+  }
+}
+
+void CompilationStacks::reduce()
+{
+  InfixExpressionProgram::Instruction instruction;
+  instruction.kind = InfixExpressionProgram::Instruction::Kind::OPERATOR;
+  instruction.op = m_stacks.back().operators.back().f;
+  m_stacks.back().operators.pop_back();
+  emit(std::move(instruction), -1);
+}
+
+void CompilationStacks::emit(InfixExpressionProgram::Instruction&& instruction, int stackChange)
+{
+  m_program.m_instructions.push_back(std::move(instruction));
+  m_stackSize += stackChange;
+  m_program.m_stackSize = std::max(m_program.m_stackSize, m_stackSize);
+}
+
+} // namespace common
+} // namespace smtk
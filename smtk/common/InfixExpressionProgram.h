@@ -0,0 +1,122 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_common_InfixExpressionProgram_h
+#define smtk_common_InfixExpressionProgram_h
+/*!\file InfixExpressionProgram.h - Compiled infix mathematical expressions. */
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/common/InfixExpressionEvaluation.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace smtk
+{
+namespace common
+{
+
+// An infix expression compiled into postfix instructions by
+// InfixExpressionGrammar::compile(), so that it can be evaluated repeatedly
+// without being parsed again. Subsymbol references ("{name}") are inputs to
+// the program; their values are passed to evaluate() in the order of
+// symbols().
+class SMTKCORE_EXPORT InfixExpressionProgram
+{
+public:
+  // Returns the distinct subsymbols referenced by the expression, in the
+  // order they first appear.
+  const std::vector<std::string>& symbols() const { return m_symbols; }
+
+  // Returns true if the program has no instructions (it was not compiled).
+  bool empty() const { return m_instructions.empty(); }
+
+  // Evaluates the program, where |symbolValues| holds the value of each of
+  // symbols(). Returns NaN if the program is empty.
+  double evaluate(const std::vector<double>& symbolValues = std::vector<double>()) const;
+
+  // Evaluates the program |count| times, where |symbolValues[i]| points to
+  // |count| values of symbols()[i], and writes the results to |results|.
+  // Each instruction is applied to a block of evaluations at a time.
+  void evaluate(
+    std::size_t count,
+    const std::vector<const double*>& symbolValues,
+    double* results) const;
+
+private:
+  friend class CompilationStacks;
+
+  struct Instruction
+  {
+    enum class Kind
+    {
+      CONSTANT,
+      SYMBOL,
+      OPERATOR,
+      FUNCTION
+    };
+
+    Kind kind;
+    double constant;
+    std::size_t symbol;
+    std::function<double(double, double)> op;
+    std::function<double(double)> function;
+  };
+
+  std::vector<Instruction> m_instructions;
+  std::vector<std::string> m_symbols;
+  std::size_t m_stackSize = 0;
+};
+
+// CompilationStacks mirrors EvaluationStacks, but rather than computing the
+// expression as it is parsed it appends the operations it would have
+// performed to an InfixExpressionProgram.
+class SMTKCORE_EXPORT CompilationStacks
+{
+public:
+  CompilationStacks(InfixExpressionProgram& program);
+
+  void open();
+
+  void setFunctionForNextOpen(const std::function<double(double)>& functionForNextOpen)
+  {
+    m_functionForNextOpen = functionForNextOpen;
+  }
+
+  void push(const InfixOperator& b);
+  void push(double l);
+  void pushSymbol(const std::string& symbol);
+
+  void close();
+
+  void finish();
+
+private:
+  struct StackLevel
+  {
+    std::vector<InfixOperator> operators;
+    std::function<double(double)> function;
+  };
+
+  void reduce();
+  void emit(InfixExpressionProgram::Instruction&& instruction, int stackChange);
+
+  InfixExpressionProgram& m_program;
+  std::vector<StackLevel> m_stacks;
+  std::function<double(double)> m_functionForNextOpen;
+  std::size_t m_stackSize = 0;
+};
+
+} // namespace common
+} // namespace smtk
+
+#endif // smtk_common_InfixExpressionProgram_h
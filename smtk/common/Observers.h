@@ -10,15 +10,19 @@
 #ifndef smtk_common_Observers_h
 #define smtk_common_Observers_h
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
 #include <mutex>
-#include <set>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #define ADD_OBSERVER(key, observers, observer, priority, initialize)                               \
   key = (observers)->insert(                                                                       \
@@ -62,6 +66,12 @@ namespace common
 /// goes out of scope, the Observer functor is removed from the Observers
 /// instance) by default. To decouple the Key's lifetime from that of the
 /// Observer functor, use the Key's release() method.
+///
+/// Calls iterate over an immutable snapshot of the Observer functors, so they
+/// take no lock and may run concurrently with insertion and erasure (which
+/// publish a modified copy of the snapshot). An Observer functor erased
+/// during a call is not called by it; one inserted during a call is first
+/// called by the next call.
 template<typename Observer, bool DebugObservers = false>
 class Observers
 {
@@ -175,6 +185,7 @@ public:
     {
       if (m_observers)
       {
+        std::unique_lock<std::mutex> lock(m_observers->m_mutex);
         m_observers->m_keys[key] = this;
       }
     }
@@ -222,47 +233,27 @@ public:
   {
     decltype(std::declval<Observer>()(args...)) result = 0;
 
-    // Toggle m_observing flag to enable caching of requests to erase observers.
-    m_observing = true;
-    for (auto& entry : m_observers)
+    // Iterate over the observers present when the call began. Observers
+    // inserted during the call are not called until the next one; observers
+    // erased during the call are deactivated and skipped.
+    std::shared_ptr<const Snapshot> snapshot = std::atomic_load(&m_snapshot);
+    for (const auto& entry : *snapshot)
     {
-      // During iteration, some observers may have requested the erasure of
-      // other observers. Rather than directly remove them from the map and
-      // invalidate the iteration loop, we cache these requests and prevent
-      // these observers from being called (as though they were erased).
-      if (m_toErase.find(entry.first) == m_toErase.end())
+      if (entry.second->active.load())
       {
         if (DebugObservers)
         {
           std::cerr << "Calling observer (" << entry.first.first << ", " << entry.first.second
-                    << "): " << m_descriptions[entry.first] << std::endl;
-        }
-        if (entry.first.assigned())
-        {
-          result |= entry.second(std::forward<Types>(args)...);
+                    << "): " << entry.second->description << std::endl;
         }
+        result |= entry.second->observer(std::forward<Types>(args)...);
       }
       else if (DebugObservers)
       {
         std::cerr << "Skipping erased observer (" << entry.first.first << ", " << entry.first.second
-                  << "): " << m_descriptions[entry.first] << std::endl;
+                  << "): " << entry.second->description << std::endl;
       }
     }
-    // Now that the iteration loop is complete, it is now safe to erase
-    // observers again.
-    m_observing = false;
-
-    // Remove observers that were marked for erasure during observation.
-    for (auto& toErase : m_toErase)
-    {
-      if (DebugObservers)
-      {
-        std::cerr << "Erasing observer (" << toErase.first << ", " << toErase.second
-                  << "): " << m_descriptions[toErase] << std::endl;
-      }
-      erase(toErase);
-    }
-    m_toErase.clear();
 
     return result;
   }
@@ -274,47 +265,27 @@ public:
     !std::is_integral<decltype(std::declval<Observer>()(args...))>::value,
     decltype(std::declval<Observer>()(args...))>::type
   {
-    // Toggle m_observing flag to enable caching of requests to erase observers.
-    m_observing = true;
-    for (auto& entry : m_observers)
+    // Iterate over the observers present when the call began. Observers
+    // inserted during the call are not called until the next one; observers
+    // erased during the call are deactivated and skipped.
+    std::shared_ptr<const Snapshot> snapshot = std::atomic_load(&m_snapshot);
+    for (const auto& entry : *snapshot)
     {
-      // During iteration, some observers may have requested the erasure of
-      // other observers. Rather than directly remove them from the map and
-      // invalidate the iteration loop, we cache these requests and prevent
-      // these observers from being called (as though they were erased).
-      if (m_toErase.find(entry.first) == m_toErase.end())
+      if (entry.second->active.load())
       {
         if (DebugObservers)
         {
           std::cerr << "Calling observer (" << entry.first.first << ", " << entry.first.second
-                    << "): " << m_descriptions[entry.first] << std::endl;
-        }
-        if (entry.first.assigned())
-        {
-          entry.second(std::forward<Types>(args)...);
+                    << "): " << entry.second->description << std::endl;
         }
+        entry.second->observer(std::forward<Types>(args)...);
       }
       else if (DebugObservers)
       {
         std::cerr << "Skipping erased observer (" << entry.first.first << ", " << entry.first.second
-                  << "): " << m_descriptions[entry.first] << std::endl;
-      }
-    }
-    // Now that the iteration loop is complete, it is now safe to erase
-    // observers again.
-    m_observing = false;
-
-    // Remove observers that were marked for erasure during observation.
-    for (auto& toErase : m_toErase)
-    {
-      if (DebugObservers)
-      {
-        std::cerr << "Erasing observer (" << toErase.first << ", " << toErase.second
-                  << "): " << m_descriptions[toErase] << std::endl;
+                  << "): " << entry.second->description << std::endl;
       }
-      erase(toErase);
     }
-    m_toErase.clear();
   }
 
   /// Ask to receive notification (and possibly a chance to respond to) events.
@@ -328,62 +299,50 @@ public:
   /// the observer.
   Key insert(Observer fn, Priority priority, bool initialize, std::string description = "")
   {
-    // An observer's handle id (the second value in its key) defines the order
-    // in which the observer is called at a specific priority level. We
-    // monotonically increase this value for each priority value we encounter.
-    int handleId;
-    if (m_observers.empty())
+    if (initialize && m_initializer)
     {
-      // If there are no observers, then this observer is the first of its
-      // priority level.
-      handleId = 0;
+      m_initializer(fn);
     }
-    else
+
+    InternalKey handle;
     {
-      // Search for the the last observer (the one with the highest handle id)
-      // at the requested priority. To do this, we first access the first
-      // observer at the priority lower than the requested priority. We then
-      // access the observer before it.
-      typename std::map<InternalKey, Observer>::iterator upper;
-      if (priority != std::numeric_limits<Priority>::lowest())
+      std::unique_lock<std::mutex> lock(m_mutex);
+      const Snapshot& observers = *m_snapshot;
+
+      // An observer's handle id (the second value in its key) defines the
+      // order in which the observer is called at a specific priority level.
+      // We monotonically increase this value for each priority value we
+      // encounter, so the new observer follows the last observer (the one
+      // with the highest handle id) at the requested priority.
+      auto upper = std::upper_bound(
+        observers.begin(),
+        observers.end(),
+        InternalKey(priority, std::numeric_limits<int>::max()),
+        [](const InternalKey& key, const typename Snapshot::value_type& entry) {
+          return key < entry.first;
+        });
+      int handleId = 0;
+      if (upper != observers.begin() && std::prev(upper)->first.first == priority)
       {
-        auto key = InternalKey(priority - 1, -1);
-        upper = m_observers.upper_bound(key);
-
-        // If the found observer is the first observer in the map, the incident
-        // observer is the first at its priority level. It will be assigned as
-        // such by the subsequent logic of this method without the iterator
-        // decrement.
-        if (upper != m_observers.begin())
-        {
-          --upper;
-        }
+        handleId = std::prev(upper)->first.second + 1;
       }
-      else
+      handle = InternalKey(priority, handleId);
+
+      if (DebugObservers)
       {
-        // If the requested priority is unset, we return the
-        // last observer in the map.
-        upper = --m_observers.end();
+        std::cerr << "Inserting observer (" << handle.first << ", " << handle.second
+                  << "): " << description << std::endl;
       }
-      // If the observer we found is at the same priority as the incident
-      // observer, the new handle id is one higher than the found observer's
-      // handle id. Otherwise, this is the first observer at this priority
-      // level.
-      handleId = (upper->first.first == priority ? upper->first.second + 1 : 0);
-    }
-    InternalKey handle = InternalKey(priority, handleId);
-    if (initialize && m_initializer)
-    {
-      m_initializer(fn);
-    }
 
-    m_descriptions.insert(std::make_pair(handle, description));
-    if (DebugObservers)
-    {
-      std::cerr << "Inserting observer (" << handle.first << ", " << handle.second
-                << "): " << description << std::endl;
+      auto entry = std::make_shared<Entry>(std::move(fn), std::move(description));
+      auto updated = std::make_shared<Snapshot>();
+      updated->reserve(observers.size() + 1);
+      updated->insert(updated->end(), observers.begin(), upper);
+      updated->emplace_back(handle, entry);
+      updated->insert(updated->end(), upper, observers.end());
+      std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot>(std::move(updated)));
     }
-    return m_observers.insert(std::make_pair(handle, fn)).second ? Key(handle, this) : Key();
+    return Key(handle, this);
   }
 
   Key insert(Observer fn, std::string description = "")
@@ -397,20 +356,10 @@ public:
   {
     handle.release();
 
-    if (m_observing)
-    {
-      if (DebugObservers)
-      {
-        std::cerr << "Queueing observer erasure (" << handle.first << ", " << handle.second
-                  << "): " << m_descriptions[handle] << std::endl;
-      }
-      m_toErase.insert(handle);
-      return m_observers.size() - m_toErase.size();
-    }
     if (DebugObservers)
     {
-      std::cerr << "Immediate observer erasure (" << handle.first << ", " << handle.second
-                << "): " << m_descriptions[handle] << std::endl;
+      std::cerr << "Erasing observer (" << handle.first << ", " << handle.second
+                << "): " << this->description(handle) << std::endl;
     }
     return erase(static_cast<InternalKey&>(handle));
   }
@@ -418,12 +367,12 @@ public:
   /// Return the observer for the given key if one exists or nullptr otherwise.
   Observer find(const Key& handle) const
   {
-    auto entry = m_observers.find(handle);
-    return entry == m_observers.end() ? nullptr : entry->second;
+    std::shared_ptr<const Entry> entry = this->entry(handle);
+    return entry ? entry->observer : nullptr;
   }
 
   /// Return the number of Observer functors in this instance.
-  std::size_t size() const { return m_observers.size(); }
+  std::size_t size() const { return std::atomic_load(&m_snapshot)->size(); }
 
   /// Replace the default implementation (calling each Observer functor in
   /// sequence) with a new behavior.
@@ -437,18 +386,38 @@ public:
 
   void setInitializer(Initializer fn) { m_initializer = fn; }
 
-  std::string description(Key handle) const { return m_descriptions[handle]; }
+  std::string description(const Key& handle) const
+  {
+    std::shared_ptr<const Entry> entry = this->entry(handle);
+    return entry ? entry->description : std::string();
+  }
 
 protected:
-  // A map of observers. The observers are held in a map so that they can be
-  // referenced (and therefore removed) at a later time using the observer's
-  // associated key.
-  std::map<InternalKey, Observer> m_observers;
+  // An observer and the description it was inserted with. A description can
+  // be manually added to an observer during its insertion, or it can
+  // automatically refer to the location of the observer's insertion in the
+  // source code if the ADD_OBSERVER macro is used. The observer is
+  // deactivated when it is erased so that calls already iterating over a
+  // snapshot that holds it will skip it.
+  struct Entry
+  {
+    Entry(Observer&& fn, std::string&& text)
+      : observer(std::move(fn))
+      , description(std::move(text))
+      , active(true)
+    {
+    }
 
-  // A map of descriptions. A descriptions can be manually added to an observer
-  // during its insertion, or it can automatically refer to the location of the
-  // observer's insertion in the source code if the ADD_OBSERVER macro is used.
-  std::map<InternalKey, std::string> m_descriptions;
+    Observer observer;
+    std::string description;
+    std::atomic<bool> active;
+  };
+
+  // The observers sorted by key. The vector is never modified once it is
+  // published; insert() and erase() publish a modified copy, so calls can
+  // iterate over the current snapshot without holding a lock.
+  using Snapshot = std::vector<std::pair<InternalKey, std::shared_ptr<Entry>>>;
+  std::shared_ptr<const Snapshot> m_snapshot{ std::make_shared<Snapshot>() };
 
   // A functor to override the default behavior of the Observers' call method.
   Observer m_override;
@@ -457,16 +426,47 @@ protected:
   Initializer m_initializer;
 
 private:
+  std::shared_ptr<const Entry> entry(const InternalKey& key) const
+  {
+    std::shared_ptr<const Snapshot> snapshot = std::atomic_load(&m_snapshot);
+    auto it = std::lower_bound(
+      snapshot->begin(),
+      snapshot->end(),
+      key,
+      [](const typename Snapshot::value_type& entry, const InternalKey& key) {
+        return entry.first < key;
+      });
+    return (it != snapshot->end() && it->first == key) ? it->second : nullptr;
+  }
+
   std::size_t erase(const InternalKey& key)
   {
     std::unique_lock<std::mutex> lock(m_mutex);
     m_keys.erase(key);
-    return m_observers.erase(key);
-  }
 
-  bool m_observing{ false };
-  std::set<InternalKey> m_toErase;
+    const Snapshot& observers = *m_snapshot;
+    auto it = std::lower_bound(
+      observers.begin(),
+      observers.end(),
+      key,
+      [](const typename Snapshot::value_type& entry, const InternalKey& key) {
+        return entry.first < key;
+      });
+    if (it == observers.end() || it->first != key)
+    {
+      return 0;
+    }
+    it->second->active = false;
+
+    auto updated = std::make_shared<Snapshot>();
+    updated->reserve(observers.size() - 1);
+    updated->insert(updated->end(), observers.begin(), it);
+    updated->insert(updated->end(), std::next(it), observers.end());
+    std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot>(std::move(updated)));
+    return 1;
+  }
 
+  // Guards modification of the snapshot and of the set of keys.
   std::mutex m_mutex;
   std::map<InternalKey, Key*> m_keys;
 };
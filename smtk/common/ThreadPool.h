@@ -14,14 +14,15 @@
 #include "smtk/CoreExports.h"
 
 #include "smtk/common/CompilerInformation.h"
+#include "smtk/common/Executor.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <future>
 #include <mutex>
 #include <queue>
-#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -29,10 +30,15 @@ namespace smtk
 {
 namespace common
 {
-/// A basic thread pool that executes functors in separate threads. It accepts
-/// the number of threads to build at construction, and waits for all tasks to
-/// complete before being destroyed. The \a ReturnType is a default-constructible
-/// type that tasks return via std::future.
+/// A basic thread pool that executes functors on the process-wide Executor.
+/// It accepts the maximum number of its tasks to run at once at construction,
+/// and waits for all tasks to complete before being destroyed. The
+/// \a ReturnType is a default-constructible type that tasks return via
+/// std::future.
+///
+/// Waiting on the returned futures from within an executor task blocks one of
+/// its workers; use Executor::wait() there instead so that the waiting thread
+/// runs other tasks in the meantime.
 template<typename ReturnType = void>
 class SMTK_ALWAYS_EXPORT ThreadPool
 {
@@ -41,8 +47,11 @@ class SMTK_ALWAYS_EXPORT ThreadPool
     "Templated return type must be void or a default constructible type");
 
 public:
-  /// Initialize thread pool with \a maxThreads threads spawned to execute tasks.
-  ThreadPool(unsigned int maxThreads = 0);
+  /// Initialize thread pool to run at most \a maxThreads tasks at once (the
+  /// executor's number of threads if 0) with the given \a priority.
+  ThreadPool(
+    unsigned int maxThreads = 0,
+    Executor::Priority priority = Executor::Priority::Normal);
   virtual ~ThreadPool();
 
   /// Add a task to be performed by the thread queue. Once a thread becomes
@@ -55,62 +64,57 @@ public:
   }
 
 protected:
-  void initialize();
-
   /// Append a functor with no inputs to the task queue. This is used in tandem
   /// with std::bind to construct the class's call method.
   std::future<ReturnType> appendToQueue(std::function<ReturnType()>&& task);
 
-  /// Run by a worker thread: poll the task queue for tasks to perform.
-  /// NOTE: the single layer of misdirection ensures that we launch a thread
-  ///       using the correct method address.
-  void execute() { return this->exec(); }
+  /// Run by an executor worker for each task appended to the queue: perform
+  /// a task and schedule the next, if any.
+  /// NOTE: the single layer of misdirection ensures that we call the derived
+  ///       class's exec().
+  void execute();
+
+  /// Pop a task from the queue (if it is not empty) and perform it.
   virtual void exec();
 
+  // Signaled when the last of the pool's tasks completes.
   std::condition_variable m_condition;
   std::mutex m_queueMutex;
-  std::vector<std::thread> m_threads;
   std::queue<std::packaged_task<ReturnType()>> m_queue;
-  bool m_initialized{ false };
   std::atomic<bool> m_active;
   unsigned int m_maxThreads;
+  Executor::Priority m_priority;
+
+  // The number of calls to execute() that are scheduled or running.
+  unsigned int m_running{ 0 };
 };
 
 template<typename ReturnType>
-ThreadPool<ReturnType>::ThreadPool(unsigned int maxThreads)
+ThreadPool<ReturnType>::ThreadPool(unsigned int maxThreads, Executor::Priority priority)
   : m_active(true)
-  , m_maxThreads(maxThreads == 0 ? std::thread::hardware_concurrency() : maxThreads)
+  , m_maxThreads(maxThreads == 0 ? Executor::instance().numberOfThreads() : maxThreads)
+  , m_priority(priority)
 {
 }
 
 template<typename ReturnType>
 ThreadPool<ReturnType>::~ThreadPool()
 {
-  // Change the state of the thread pool to signify that threads should no
-  // longer run.
+  // Change the state of the thread pool to signify that it is being destroyed.
   m_active = false;
 
-  // For each thread in the pool, send a task that will cause it to exit its
-  // infinite loop.
-  for (std::size_t i = 0; i < m_threads.size(); i++)
-  {
-    (*this)([] { return ReturnType(); });
-  }
-
-  // Now that all of the threads have exited, join each thread with the parent
-  // thread.
-  for (auto& thread : m_threads)
-  {
-    thread.join();
-  }
-}
-
-template<typename ReturnType>
-void ThreadPool<ReturnType>::initialize()
-{
-  for (unsigned int i = 0; i < m_maxThreads; ++i)
+  // Wait for the queued tasks to complete, running other pending tasks on this
+  // thread in the meantime in case it is an executor worker.
+  std::unique_lock<std::mutex> queueLock(m_queueMutex);
+  while (m_running > 0)
   {
-    m_threads.push_back(std::thread(&ThreadPool<ReturnType>::execute, this));
+    queueLock.unlock();
+    bool ran = Executor::instance().runPendingTask();
+    queueLock.lock();
+    if (!ran)
+    {
+      m_condition.wait_for(queueLock, std::chrono::milliseconds(1));
+    }
   }
 }
 
@@ -118,55 +122,75 @@ template<typename ReturnType>
 std::future<ReturnType> ThreadPool<ReturnType>::appendToQueue(std::function<ReturnType()>&& task)
 {
   std::future<ReturnType> future;
+  bool schedule;
 
   // Scope access to the queue.
   {
     std::unique_lock<std::mutex> queueLock(m_queueMutex);
 
-    // If the thread pool is not yet active, initialize it.
-    // NOTE: we use lazy initialization here to allow derived thread pools to
-    //       have custom exec() logic, which is called upon the construction of
-    //       std::thread. The derived methods will only be available after
-    //       the base constructor has returned, so we cannot construct
-    //       std::thread instances in this class's constructor.
-    if (!m_initialized)
-    {
-      m_initialized = true;
-      this->initialize();
-    }
-
     // Construct a packaged_task to launch the input task and access its
     // future.
     m_queue.emplace(task);
     future = m_queue.back().get_future();
+
+    // Tasks beyond the first |m_maxThreads| are started as earlier ones
+    // complete (see execute()).
+    schedule = m_running < m_maxThreads;
+    if (schedule)
+    {
+      ++m_running;
+    }
+  }
+
+  if (schedule)
+  {
+    Executor::instance().submit([this]() { this->execute(); }, m_priority);
   }
-  // Signal to the next thread that the queue is ready for access.
-  m_condition.notify_one();
 
   // Return the future associated with the promise created above.
   return future;
 }
 
 template<typename ReturnType>
-void ThreadPool<ReturnType>::exec()
+void ThreadPool<ReturnType>::execute()
 {
-  // Always check if the containing class has signaled that the thread pool
-  // should no longer be active.
-  while (m_active)
+  this->exec();
+
+  // Rather than running the pool's tasks in a loop here, each is scheduled
+  // separately so that the executor's other tasks are not held up behind them.
+  bool more;
   {
-    std::packaged_task<ReturnType()> task;
-    // Scope access to the queue.
+    std::unique_lock<std::mutex> queueLock(m_queueMutex);
+    more = !m_queue.empty();
+    if (!more)
     {
-      std::unique_lock<std::mutex> queueLock(m_queueMutex);
+      --m_running;
+      m_condition.notify_all();
+    }
+  }
 
-      // Access a task from the queue.
-      m_condition.wait(queueLock, [this] { return !m_queue.empty(); });
-      task = std::move(m_queue.front());
-      m_queue.pop();
+  if (more)
+  {
+    Executor::instance().submit([this]() { this->execute(); }, m_priority);
+  }
+}
+
+template<typename ReturnType>
+void ThreadPool<ReturnType>::exec()
+{
+  std::packaged_task<ReturnType()> task;
+  // Scope access to the queue.
+  {
+    std::unique_lock<std::mutex> queueLock(m_queueMutex);
+    if (m_queue.empty())
+    {
+      return;
     }
-    // Execute the task.
-    task();
+    task = std::move(m_queue.front());
+    m_queue.pop();
   }
+  // Execute the task.
+  task();
 }
 } // namespace common
 } // namespace smtk
@@ -44,31 +44,31 @@ public:
 private:
   NO_UBSAN_VPTR void exec() override
   {
-    while (this->m_active)
+    std::packaged_task<bool()> task;
     {
-      std::packaged_task<bool()> task;
-      {
-        std::unique_lock<std::mutex> queueLock(this->m_queueMutex);
-
-        // Access a task from the queue.
-        this->m_condition.wait(queueLock, [this] { return !this->m_queue.empty(); });
+      std::unique_lock<std::mutex> queueLock(this->m_queueMutex);
 
-        if (!m_stopped)
-        {
-          task = std::move(this->m_queue.front());
-        }
-        else
-        {
-          std::packaged_task<bool()> emptyTask([]() { return bool(); });
-          task = std::move(emptyTask);
-        }
+      // Access a task from the queue.
+      if (this->m_queue.empty())
+      {
+        return;
+      }
 
-        this->m_queue.pop();
+      if (!m_stopped)
+      {
+        task = std::move(this->m_queue.front());
+      }
+      else
+      {
+        std::packaged_task<bool()> emptyTask([]() { return bool(); });
+        task = std::move(emptyTask);
       }
 
-      // Execute the task.
-      task();
+      this->m_queue.pop();
     }
+
+    // Execute the task.
+    task();
   }
 
   bool m_stopped{ false };
@@ -0,0 +1,241 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/Executor.h"
+#include "smtk/common/ThreadPool.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+void testParallelFor(smtk::common::Executor& executor)
+{
+  std::vector<int> visits(1000, 0);
+  executor.parallelFor(0, visits.size(), 7, [&visits](std::size_t begin, std::size_t end) {
+    smtkTest(end - begin <= 7, "Subrange exceeds the grain size");
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      ++visits[i];
+    }
+  });
+  for (int visit : visits)
+  {
+    smtkTest(visit == 1, "Each index should be visited once");
+  }
+}
+
+void testParallelReduce(smtk::common::Executor& executor)
+{
+  std::size_t sum = executor.parallelReduce(
+    1,
+    10001,
+    100,
+    std::size_t(0),
+    [](std::size_t begin, std::size_t end) {
+      std::size_t partial = 0;
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        partial += i;
+      }
+      return partial;
+    },
+    [](std::size_t a, std::size_t b) { return a + b; });
+  smtkTest(sum == 50005000, "Incorrect sum " << sum);
+
+  // Partial results are combined in order.
+  std::string digits = executor.parallelReduce(
+    0,
+    10,
+    3,
+    std::string(),
+    [](std::size_t begin, std::size_t end) {
+      std::string partial;
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        partial += std::to_string(i);
+      }
+      return partial;
+    },
+    [](const std::string& a, const std::string& b) { return a + b; });
+  smtkTest(digits == "0123456789", "Reduction combined out of order: " << digits);
+}
+
+// Loops nested within tasks complete even when every worker is busy with an
+// outer iteration, since waiting threads run pending tasks.
+void testNestedParallelism(smtk::common::Executor& executor)
+{
+  std::atomic<std::size_t> count(0);
+  executor.parallelFor(0, 8, 1, [&executor, &count](std::size_t, std::size_t) {
+    executor.parallelFor(0, 100, 1, [&count](std::size_t begin, std::size_t end) {
+      count += end - begin;
+    });
+  });
+  smtkTest(count == 800, "Nested loops did not visit every index");
+}
+
+// Thread pools, which run on the shared executor, may be used from within its
+// tasks.
+void testNestedThreadPool()
+{
+  smtk::common::Executor& executor = smtk::common::Executor::instance();
+  std::future<int> outer = executor.async([&executor]() {
+    smtk::common::ThreadPool<int> pool(2);
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 10; ++i)
+    {
+      futures.push_back(pool([i]() { return i; }));
+    }
+    int total = 0;
+    for (auto& future : futures)
+    {
+      executor.wait(future);
+      total += future.get();
+    }
+    return total;
+  });
+  executor.wait(outer);
+  smtkTest(outer.get() == 45, "Incorrect result from a nested thread pool");
+}
+
+void testExceptions(smtk::common::Executor& executor)
+{
+  bool caught = false;
+  try
+  {
+    executor.parallelFor(0, 100, 10, [](std::size_t begin, std::size_t) {
+      if (begin == 50)
+      {
+        throw std::runtime_error("expected");
+      }
+    });
+  }
+  catch (const std::runtime_error&)
+  {
+    caught = true;
+  }
+  smtkTest(caught, "Exception was not rethrown by parallelFor()");
+
+  std::future<int> future = executor.async([]() -> int { throw std::runtime_error("expected"); });
+  caught = false;
+  try
+  {
+    future.get();
+  }
+  catch (const std::runtime_error&)
+  {
+    caught = true;
+  }
+  smtkTest(caught, "Exception was not returned by async()");
+}
+
+// With a single worker, pending tasks are started in order of priority.
+void testPriorities()
+{
+  smtk::common::Executor executor(1);
+
+  std::mutex mutex;
+  std::vector<std::string> order;
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::future<void> blocker = executor.async([released]() { released.wait(); });
+
+  typedef smtk::common::Executor::Priority Priority;
+  std::vector<std::future<void>> futures;
+  auto record = [&mutex, &order](const std::string& name) {
+    return [&mutex, &order, name]() {
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(name);
+    };
+  };
+  futures.push_back(executor.async(record("low"), Priority::Low));
+  futures.push_back(executor.async(record("normal"), Priority::Normal));
+  futures.push_back(executor.async(record("high"), Priority::High));
+  release.set_value();
+  for (auto& future : futures)
+  {
+    future.wait();
+  }
+
+  smtkTest(
+    order == std::vector<std::string>({ "high", "normal", "low" }),
+    "Tasks did not run in order of priority");
+}
+
+// Blocked Low priority tasks leave a worker free for other work.
+void testLowPriorityCapacity()
+{
+  smtk::common::Executor executor(3);
+  smtkTest(executor.lowPriorityCapacity() == 2, "Expected capacity for 2 Low priority tasks");
+
+  typedef smtk::common::Executor::Priority Priority;
+  std::atomic<int> running{ 0 };
+  std::atomic<int> mostRunning{ 0 };
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  std::vector<std::future<void>> blocked;
+  for (int i = 0; i < 4; ++i)
+  {
+    blocked.push_back(executor.async(
+      [&running, &mostRunning, released]() {
+        int count = ++running;
+        int most = mostRunning;
+        while (count > most && !mostRunning.compare_exchange_weak(most, count))
+        {
+        }
+        released.wait();
+        --running;
+      },
+      Priority::Low));
+  }
+
+  // This would never run if every worker were blocked by a Low priority task.
+  std::future<int> normal = executor.async([]() { return 42; });
+  smtkTest(
+    normal.wait_for(std::chrono::seconds(10)) == std::future_status::ready && normal.get() == 42,
+    "Normal priority task was starved by blocked Low priority tasks");
+
+  release.set_value();
+  for (auto& future : blocked)
+  {
+    future.wait();
+  }
+  smtkTest(mostRunning <= 2, "Too many Low priority tasks ran at once");
+}
+} // namespace
+
+int UnitTestExecutor(int /*unused*/, char** const /*unused*/)
+{
+  smtk::common::Executor executor(2);
+  testParallelFor(executor);
+  testParallelReduce(executor);
+  testNestedParallelism(executor);
+  testExceptions(executor);
+  testPriorities();
+  testLowPriorityCapacity();
+
+  // The process-wide executor may be reconfigured only until it starts.
+  smtkTest(smtk::common::Executor::configure(3), "Could not configure the shared executor");
+  smtkTest(
+    smtk::common::Executor::instance().numberOfThreads() == 3,
+    "Shared executor was not configured");
+  testNestedParallelism(smtk::common::Executor::instance());
+  testNestedThreadPool();
+  smtkTest(
+    !smtk::common::Executor::configure(4), "Configured the shared executor after it started");
+
+  return 0;
+}
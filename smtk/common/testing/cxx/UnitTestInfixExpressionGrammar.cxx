@@ -12,11 +12,13 @@
 
 #include "smtk/common/InfixExpressionError.h"
 #include "smtk/common/InfixExpressionGrammar.h"
+#include "smtk/common/InfixExpressionProgram.h"
 
 #include "smtk/common/testing/cxx/helpers.h"
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 void testSimpleExpression()
 {
@@ -79,6 +81,54 @@ void testAddFunction()
     smtkTest(err == smtk::common::InfixExpressionError::ERROR_NONE, "Expected err to be ERROR_NONE")
 }
 
+void testCompiledExpression()
+{
+  smtk::common::InfixExpressionGrammar infix;
+  int visits = 0;
+  infix.setSubsymbolVisitor([&visits](const std::string& symbol) {
+    ++visits;
+    return std::pair<double, bool>(symbol == "a" ? 2.0 : 3.0, true);
+  });
+
+  smtk::common::InfixExpressionProgram program;
+  smtkTest(
+    infix.compile("{a} * ({b} - 1) + sqrt({a} ^ 2)", program) ==
+      smtk::common::InfixExpressionError::ERROR_NONE,
+    "Failed to compile expression.");
+  smtkTest(program.symbols().size() == 2, "Expected 2 distinct symbols.");
+  smtkTest(visits == 0, "Compiling should not visit subsymbols.");
+
+  smtk::common::InfixExpressionError err = smtk::common::InfixExpressionError::ERROR_NONE;
+  smtkTest(infix.evaluate(program, err) == 6.0, "Incorrectly evaluated compiled expression.");
+  smtkTest(err == smtk::common::InfixExpressionError::ERROR_NONE, "Expected err to be ERROR_NONE");
+  smtkTest(visits == 2, "Expected each subsymbol to be visited once.");
+
+  smtkTest(
+    infix.compile("1 + (", program) == smtk::common::InfixExpressionError::ERROR_INVALID_SYNTAX,
+    "Expected err to be ERROR_INVALID_SYNTAX");
+  smtkTest(program.empty(), "Expected a failed compilation to leave the program empty.");
+}
+
+void testBatchEvaluation()
+{
+  smtk::common::InfixExpressionGrammar infix;
+  smtk::common::InfixExpressionProgram program;
+  infix.compile("2 * {x} + cos({y})", program);
+
+  const std::size_t n = 1000;
+  std::vector<double> x(n), y(n, 0.0), results(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    x[i] = static_cast<double>(i);
+  }
+  program.evaluate(n, { x.data(), y.data() }, results.data());
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    smtkTest(results[i] == program.evaluate({ x[i], y[i] }), "Batch evaluation differs.");
+    smtkTest(results[i] == 2.0 * x[i] + 1.0, "Incorrect batch evaluation.");
+  }
+}
+
 int UnitTestInfixExpressionGrammar(int, char** const)
 {
   testSimpleExpression();
@@ -87,6 +137,8 @@ int UnitTestInfixExpressionGrammar(int, char** const)
   testFailsForInvalidSyntax();
   testFailsForInvalidFunction();
   testAddFunction();
+  testCompiledExpression();
+  testBatchEvaluation();
 
   return 0;
 }
@@ -13,12 +13,14 @@
 #include "smtk/common/InfixExpressionError.h"
 #include "smtk/common/InfixExpressionEvaluation.h"
 #include "smtk/common/InfixExpressionGrammarImpl.h"
+#include "smtk/common/InfixExpressionProgram.h"
 
 #include "smtk/io/Logger.h"
 
 #include <cmath>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "smtk/common/testing/cxx/helpers.h"
 
@@ -30,19 +32,16 @@ int tryParse(const std::string& expression)
   tao::pegtl::string_input<> in(expression, "ExpressionParser");
 
   smtk::common::InfixOperators ops;
-  smtk::common::EvaluationStacks s;
+  smtk::common::InfixExpressionProgram program;
+  smtk::common::CompilationStacks s(program);
   smtk::common::InfixFunctions funcs;
   smtk::common::InfixExpressionError infixErr = smtk::common::InfixExpressionError::ERROR_NONE;
-  smtk::common::SubsymbolVisitor subsymbolFunc = [](const std::string&) {
-    return std::make_pair(0.0, true);
-  };
 
   try
   {
     tao::pegtl::parse<
       smtk::common::expression_internal::expression_grammar,
-      smtk::common::expression_internal::ExpressionAction>(
-      in, ops, s, funcs, subsymbolFunc, infixErr);
+      smtk::common::expression_internal::ExpressionAction>(in, ops, s, funcs, infixErr);
   }
   catch (tao::pegtl::parse_error& err)
   {
@@ -62,19 +61,16 @@ double evaluateExpression(const std::string& expression)
   tao::pegtl::string_input<> in(expression, "ExpressionParser");
 
   smtk::common::InfixOperators ops;
-  smtk::common::EvaluationStacks s;
+  smtk::common::InfixExpressionProgram program;
+  smtk::common::CompilationStacks s(program);
   smtk::common::InfixFunctions funcs;
   smtk::common::InfixExpressionError infixErr = smtk::common::InfixExpressionError::ERROR_NONE;
-  smtk::common::SubsymbolVisitor subsymbolFunc = [](const std::string&) {
-    return std::make_pair(0.0, true);
-  };
 
   try
   {
     tao::pegtl::parse<
       smtk::common::expression_internal::expression_grammar,
-      smtk::common::expression_internal::ExpressionAction>(
-      in, ops, s, funcs, subsymbolFunc, infixErr);
+      smtk::common::expression_internal::ExpressionAction>(in, ops, s, funcs, infixErr);
   }
   catch (tao::pegtl::parse_error& err)
   {
@@ -86,7 +82,9 @@ double evaluateExpression(const std::string& expression)
     return std::nan("");
   }
 
-  return s.finish();
+  // Subsymbols evaluate to 0.
+  s.finish();
+  return program.evaluate(std::vector<double>(program.symbols().size(), 0.0));
 }
 
 int UnitTestInfixExpressionGrammarImpl(int, char** const)
@@ -11,6 +11,8 @@
 
 #include "smtk/common/testing/cxx/helpers.h"
 
+#include <vector>
+
 namespace
 {
 class Observed
@@ -59,9 +61,44 @@ void TestPriority()
   return;
 }
 
+void TestModificationDuringCall()
+{
+  Observed observed;
+
+  std::vector<int> called;
+  Observed::Observers::Key secondKey;
+  Observed::Observers::Key insertedKey;
+
+  auto first = [&]() {
+    called.push_back(1);
+    // Erasing an observer that has not yet been called prevents the call,
+    // while inserting an observer defers its call to the next notification.
+    observed.observers().erase(secondKey);
+    if (!insertedKey.assigned())
+    {
+      insertedKey = observed.observers().insert([&]() { called.push_back(4); }, -4, false);
+    }
+  };
+  auto second = [&]() { called.push_back(2); };
+  auto third = [&]() { called.push_back(3); };
+
+  auto firstKey = observed.observers().insert(first, -1, false);
+  secondKey = observed.observers().insert(second, -2, false);
+  auto thirdKey = observed.observers().insert(third, -3, false);
+
+  observed();
+  smtkTest((called == std::vector<int>{ 1, 3 }), "erased or inserted observer was called");
+  smtkTest(observed.observers().size() == 3, "wrong number of observers after erasure");
+
+  called.clear();
+  observed();
+  smtkTest((called == std::vector<int>{ 1, 3, 4 }), "inserted observer was not called");
+}
+
 int UnitTestObservers(int /*unused*/, char** const /*unused*/)
 {
   TestPriority();
+  TestModificationDuringCall();
 
   return 0;
 }
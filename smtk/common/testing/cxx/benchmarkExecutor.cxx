@@ -0,0 +1,191 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/common/Executor.h"
+#include "smtk/common/ThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// Compare the cost of dispatching small tasks through smtk::common::Executor
+// with that of the thread pool it replaced, which gave each pool its own
+// threads and a single mutex-guarded queue of packaged tasks. Tasks are either
+// submitted one at a time and waited upon through futures, or (for the
+// executor) as the iterations of a parallel loop. The number of tasks may be
+// passed as an argument.
+
+namespace
+{
+// The thread pool as it was before it was built upon Executor.
+class LegacyThreadPool
+{
+public:
+  LegacyThreadPool(unsigned int numberOfThreads)
+  {
+    for (unsigned int i = 0; i < numberOfThreads; ++i)
+    {
+      m_threads.emplace_back(&LegacyThreadPool::exec, this);
+    }
+  }
+
+  ~LegacyThreadPool()
+  {
+    m_active = false;
+    for (std::size_t i = 0; i < m_threads.size(); ++i)
+    {
+      (*this)([] {});
+    }
+    for (auto& thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  std::future<void> operator()(std::function<void()>&& task)
+  {
+    std::future<void> future;
+    {
+      std::unique_lock<std::mutex> queueLock(m_queueMutex);
+      m_queue.emplace(task);
+      future = m_queue.back().get_future();
+    }
+    m_condition.notify_one();
+    return future;
+  }
+
+private:
+  void exec()
+  {
+    while (m_active)
+    {
+      std::packaged_task<void()> task;
+      {
+        std::unique_lock<std::mutex> queueLock(m_queueMutex);
+        m_condition.wait(queueLock, [this] { return !m_queue.empty(); });
+        task = std::move(m_queue.front());
+        m_queue.pop();
+      }
+      task();
+    }
+  }
+
+  std::condition_variable m_condition;
+  std::mutex m_queueMutex;
+  std::vector<std::thread> m_threads;
+  std::queue<std::packaged_task<void()>> m_queue;
+  std::atomic<bool> m_active{ true };
+};
+
+// A task that does a little work so it cannot be optimized away.
+std::atomic<std::size_t> counter(0);
+void task()
+{
+  ++counter;
+}
+
+template<typename Submit>
+double timeFutures(std::size_t numberOfTasks, Submit submit)
+{
+  std::vector<std::future<void>> futures;
+  futures.reserve(numberOfTasks);
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < numberOfTasks; ++i)
+  {
+    futures.push_back(submit());
+  }
+  for (auto& future : futures)
+  {
+    future.wait();
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* label, double seconds, std::size_t numberOfTasks)
+{
+  std::cout << "  " << label << ": " << seconds << " s, "
+            << 1e9 * seconds / static_cast<double>(numberOfTasks) << " ns/task\n";
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  std::size_t numberOfTasks = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+  smtk::common::Executor& executor = smtk::common::Executor::instance();
+  unsigned int numberOfThreads = executor.numberOfThreads();
+  std::cout << numberOfTasks << " tasks on " << numberOfThreads << " threads\n";
+
+  {
+    LegacyThreadPool pool(numberOfThreads);
+    report(
+      "legacy ThreadPool",
+      timeFutures(numberOfTasks, [&pool]() { return pool(task); }),
+      numberOfTasks);
+  }
+
+  {
+    smtk::common::ThreadPool<> pool;
+    report(
+      "ThreadPool",
+      timeFutures(numberOfTasks, [&pool]() { return pool(task); }),
+      numberOfTasks);
+  }
+
+  report(
+    "Executor::async",
+    timeFutures(numberOfTasks, [&executor]() { return executor.async(task); }),
+    numberOfTasks);
+
+  {
+    auto start = std::chrono::steady_clock::now();
+    executor.parallelFor(0, numberOfTasks, 1, [](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        task();
+      }
+    });
+    report(
+      "Executor::parallelFor",
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(),
+      numberOfTasks);
+  }
+
+  // Tasks submitted from within tasks go to the submitting worker's own queue.
+  {
+    auto start = std::chrono::steady_clock::now();
+    const std::size_t numberOfOuterTasks = 4 * numberOfThreads;
+    executor.parallelFor(
+      0,
+      numberOfOuterTasks,
+      1,
+      [&executor, numberOfTasks, numberOfOuterTasks](std::size_t, std::size_t) {
+        executor.parallelFor(
+          0, numberOfTasks / numberOfOuterTasks, 1, [](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+              task();
+            }
+          });
+      });
+    report(
+      "nested Executor::parallelFor",
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(),
+      numberOfTasks);
+  }
+
+  return 0;
+}
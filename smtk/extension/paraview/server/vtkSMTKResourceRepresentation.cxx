@@ -55,6 +55,7 @@
 #include "smtk/model/Model.h"
 #include "smtk/model/Resource.h"
 
+#include "smtk/geometry/Resource.h"
 #include "smtk/geometry/queries/SelectionFootprint.h"
 
 #include "smtk/resource/Component.h"
@@ -525,8 +526,20 @@ bool vtkSMTKResourceRepresentation::SetEntityVisibility(
   {
     csit->second.m_visibility = (visible ? 1 : 0);
     didChange = true;
-    auto dataIt = this->RenderableData.find(csit->first);
-    if (dataIt != this->RenderableData.end())
+    // Let caching geometry providers know which geometry may be freed.
+    auto geometryResource =
+      std::dynamic_pointer_cast<smtk::geometry::Resource>(this->GetResource());
+    if (geometryResource)
+    {
+      smtk::extension::vtk::geometry::Backend vtk;
+      const auto& geom = geometryResource->geometry(vtk);
+      if (geom)
+      {
+        geom->setVisibility(ent->id(), visible);
+      }
+    }
+    auto dataIt = this->RenderableLookup.find(csit->first);
+    if (dataIt != this->RenderableLookup.end())
     {
       // Tell both the entity and glyph mappers that, should they encounter the data object,
       // use the provided visibility.
@@ -543,6 +556,7 @@ bool vtkSMTKResourceRepresentation::SetEntityVisibility(
       this->GlyphMapper->Modified();
       // mark the selection modified, so UpdateDisplayAttributesFromSelection will fix
       // the selection visibility
+      this->StyledBlocks.insert(dataIt->second);
       this->SelectionModified();
     }
   }
@@ -756,14 +770,24 @@ void vtkSMTKResourceRepresentation::UpdateRenderableData(
   vtkMultiBlockDataSet* resourceData,
   vtkMultiBlockDataSet* instanceData)
 {
+  // The map only depends on the input data, so it is not rebuilt when
+  // the selection changes.
   if (
     (resourceData && resourceData->GetMTime() > this->RenderableTime) ||
-    (instanceData && instanceData->GetMTime() > this->RenderableTime) ||
-    (this->SelectionTime > this->RenderableTime))
+    (instanceData && instanceData->GetMTime() > this->RenderableTime))
   {
     this->RenderableData.clear();
     AddRenderables(instanceData, this->RenderableData);
     AddRenderables(resourceData, this->RenderableData);
+    this->RenderableLookup.clear();
+    this->RenderableLookup.reserve(this->RenderableData.size());
+    this->RenderableIds.clear();
+    this->RenderableIds.reserve(this->RenderableData.size());
+    for (const auto& entry : this->RenderableData)
+    {
+      this->RenderableLookup.insert(entry);
+      this->RenderableIds[entry.second] = entry.first;
+    }
     this->RenderableTime.Modified();
   }
 }
@@ -793,45 +817,64 @@ void vtkSMTKResourceRepresentation::UpdateDisplayAttributesFromSelection(
     return;
   }
 
-  if (
-    resourceData->GetMTime() < this->ApplyStyleTime &&
-    (!instanceData || instanceData->GetMTime() < this->ApplyStyleTime) &&
-    this->RenderableTime < this->ApplyStyleTime && this->SelectionTime < this->ApplyStyleTime)
+  bool dataModified = resourceData->GetMTime() >= this->ApplyStyleTime ||
+    (instanceData && instanceData->GetMTime() >= this->ApplyStyleTime) ||
+    this->RenderableTime >= this->ApplyStyleTime;
+  if (!dataModified && this->SelectionTime < this->ApplyStyleTime)
   {
     return;
   }
 
-  // We are about to manually set block visibilities for the selection,
-  // so reset what's there now to reflect nothing being selected (i.e.,
-  // only blocks hidden by user should have visibility entries and those
-  // should be false).
-  auto* nrme = this->EntityMapper->GetCompositeDataDisplayAttributes();
-  auto* nrmg = this->GlyphMapper->GetBlockAttributes();
-  nrme->RemoveBlockVisibilities();
-  nrmg->RemoveBlockVisibilities();
-  // Similarly, the selected-entity and selected-glyph block visibilities
-  // should *all* be present but set to false.
-  auto* seda = this->SelectedEntityMapper->GetCompositeDataDisplayAttributes();
-  auto* sgda = this->SelectedGlyphMapper->GetBlockAttributes();
-  for (const auto& entry : this->RenderableData)
-  {
-    seda->SetBlockVisibility(entry.second, false);
-    sgda->SetBlockVisibility(entry.second, false);
-  }
+  // Styles supplied by plugins may alter display attributes without going
+  // through SetSelectedState(), so we cannot tell which blocks they touched.
+  auto resource = this->GetResource();
+  bool customStyle = resource && !!vtkSMTKRepresentationStyleGenerator()(resource);
+
+  if (dataModified || customStyle)
+  {
+    // We are about to manually set block visibilities for the selection,
+    // so reset what's there now to reflect nothing being selected (i.e.,
+    // only blocks hidden by user should have visibility entries and those
+    // should be false).
+    auto* nrme = this->EntityMapper->GetCompositeDataDisplayAttributes();
+    auto* nrmg = this->GlyphMapper->GetBlockAttributes();
+    nrme->RemoveBlockVisibilities();
+    nrmg->RemoveBlockVisibilities();
+    // Similarly, the selected-entity and selected-glyph block visibilities
+    // should *all* be present but set to false.
+    auto* seda = this->SelectedEntityMapper->GetCompositeDataDisplayAttributes();
+    auto* sgda = this->SelectedGlyphMapper->GetBlockAttributes();
+    for (const auto& entry : this->RenderableData)
+    {
+      seda->SetBlockVisibility(entry.second, false);
+      sgda->SetBlockVisibility(entry.second, false);
+    }
 
-  // Add user-specified visibility
-  for (const auto& entry : this->ComponentState)
+    // Add user-specified visibility
+    for (const auto& entry : this->ComponentState)
+    {
+      auto rit = this->RenderableLookup.find(entry.first);
+      if (rit == this->RenderableLookup.end())
+      {
+        continue;
+      }
+      nrme->SetBlockVisibility(rit->second, !!entry.second.m_visibility);
+      nrmg->SetBlockVisibility(rit->second, !!entry.second.m_visibility);
+      // We don't need to set visibility on seda/sgda here since
+      // it will always be false (no selection being processed yet).
+    }
+  }
+  else
   {
-    auto rit = this->RenderableData.find(entry.first);
-    if (rit == this->RenderableData.end())
+    // Only the selection changed, so only the blocks styled for the previous
+    // selection need to be reset. This keeps hovering and selecting cheap
+    // for resources with many components.
+    for (auto* block : this->StyledBlocks)
     {
-      continue;
+      this->ResetSelectedState(block);
     }
-    nrme->SetBlockVisibility(rit->second, !!entry.second.m_visibility);
-    nrmg->SetBlockVisibility(rit->second, !!entry.second.m_visibility);
-    // We don't need to set visibility on seda/sgda here since
-    // it will always be false (no selection being processed yet).
   }
+  this->StyledBlocks.clear();
 
   // Finally, ask our "style" functor to update selection visibility/color info
   // on the mappers by calling SetSelectedState() on entries in this->RenderableData.
@@ -847,124 +890,6 @@ void vtkSMTKResourceRepresentation::UpdateDisplayAttributesFromSelection(
   this->ApplyStyleTime.Modified();
 }
 
-void vtkSMTKResourceRepresentation::UpdateSelection(
-  vtkMultiBlockDataSet* data,
-  vtkCompositeDataDisplayAttributes* blockAttr,
-  vtkActor* actor)
-{
-  auto* rm = this->GetWrapper(); // vtkSMTKWrapper::Instance(); // TODO: Remove the need for this.
-  auto sm = rm ? rm->GetSelection() : nullptr;
-  if (!sm)
-  {
-    actor->SetVisibility(0);
-    return;
-  }
-
-  auto selection = sm->currentSelection();
-  if (selection.empty())
-  {
-    actor->SetVisibility(0);
-    return;
-  }
-
-  int propVis = 0;
-  this->ClearSelection(actor->GetMapper()); // FIXME: ClearSelection does stupid things.
-  // FIXME: This is the wrong thing to loop over -- since we don't have a map
-  //        from component (or UUID) to block ID, the call to FindNode is slow.
-  //        If we loop over blocks instead, we can search the selection map quickly!
-  for (auto& item : selection)
-  {
-    if (item.second <= 0)
-    {
-      continue;
-    }
-    auto* matchedBlock = this->FindNode(data, item.first->id().toString());
-    if (matchedBlock)
-    {
-      propVis = 1;
-      blockAttr->SetBlockVisibility(matchedBlock, true);
-      blockAttr->SetBlockColor(
-        matchedBlock, item.second > 1 ? this->HoverColor : this->SelectionColor);
-    }
-  }
-  actor->SetVisibility(propVis);
-
-  // This is necessary to force an update in the mapper
-  actor->GetMapper()->Modified();
-}
-
-vtkDataObject* vtkSMTKResourceRepresentation::FindNode(
-  vtkMultiBlockDataSet* data,
-  const smtk::common::UUID& uuid)
-{
-  const int numBlocks = data->GetNumberOfBlocks();
-  for (int index = 0; index < numBlocks; index++)
-  {
-    auto* currentBlock = data->GetBlock(index);
-    auto currentId = vtkResourceMultiBlockSource::GetDataObjectUUID(data->GetMetaData(index));
-    if (currentId == uuid)
-    {
-      return currentBlock;
-    }
-
-    auto* childBlock = vtkMultiBlockDataSet::SafeDownCast(currentBlock);
-    if (childBlock)
-    {
-      auto* matchedNode = this->FindNode(childBlock, uuid);
-      if (matchedNode)
-      {
-        return matchedNode;
-      }
-    }
-  }
-
-  return nullptr;
-}
-
-void vtkSMTKResourceRepresentation::ClearSelection(vtkMapper* mapper)
-{
-  auto clearAttributes = [](vtkCompositeDataDisplayAttributes* attr) {
-    attr->RemoveBlockVisibilities();
-    attr->RemoveBlockColors();
-  };
-
-  auto* cpdm = vtkCompositePolyDataMapper2::SafeDownCast(mapper);
-  if (cpdm)
-  {
-    auto* blockAttr = cpdm->GetCompositeDataDisplayAttributes();
-    clearAttributes(blockAttr);
-    auto* data = cpdm->GetInputDataObject(0, 0);
-
-    // For vtkCompositePolyDataMapper2, setting the top node as false is enough
-    // since the state of the top node will stream down to its nodes.
-    blockAttr->SetBlockVisibility(data, false);
-    return;
-  }
-
-  auto* gm = vtkGlyph3DMapper::SafeDownCast(mapper);
-  if (gm)
-  {
-    auto* blockAttr = gm->GetBlockAttributes();
-    clearAttributes(blockAttr);
-
-    // Glyph3DMapper does not behave as vtkCompositePolyDataMapper2, hence it is
-    // necessary to update the block visibility of each node directly.
-    auto* mbds = vtkMultiBlockDataSet::SafeDownCast(gm->GetInputDataObject(0, 0));
-    vtkDataObjectTreeIterator* iter = mbds->NewTreeIterator();
-    iter->VisitOnlyLeavesOff();
-
-    iter->GoToFirstItem();
-    while (!iter->IsDoneWithTraversal())
-    {
-      auto* dataObj = iter->GetCurrentDataObject();
-      blockAttr->SetBlockVisibility(dataObj, false);
-      iter->GoToNextItem();
-    }
-    iter->Delete();
-    return;
-  }
-}
-
 void vtkSMTKResourceRepresentation::SetResource(const smtk::resource::ResourcePtr& res)
 {
   this->Resource = res;
@@ -1661,6 +1586,29 @@ void vtkSMTKResourceRepresentation::SetSelectedState(
   }
   sel->SetBlockVisibility(data, selectionValue > 0);
   nrm->SetBlockVisibility(data, selectionValue == 0);
+  this->StyledBlocks.insert(data);
+}
+
+void vtkSMTKResourceRepresentation::ResetSelectedState(vtkDataObject* data)
+{
+  auto* nrme = this->EntityMapper->GetCompositeDataDisplayAttributes();
+  auto* nrmg = this->GlyphMapper->GetBlockAttributes();
+  this->SelectedEntityMapper->GetCompositeDataDisplayAttributes()->SetBlockVisibility(data, false);
+  this->SelectedGlyphMapper->GetBlockAttributes()->SetBlockVisibility(data, false);
+
+  auto idIt = this->RenderableIds.find(data);
+  auto csit = idIt == this->RenderableIds.end() ? this->ComponentState.end()
+                                                 : this->ComponentState.find(idIt->second);
+  if (csit == this->ComponentState.end())
+  {
+    nrme->RemoveBlockVisibility(data);
+    nrmg->RemoveBlockVisibility(data);
+  }
+  else
+  {
+    nrme->SetBlockVisibility(data, !!csit->second.m_visibility);
+    nrmg->SetBlockVisibility(data, !!csit->second.m_visibility);
+  }
 }
 
 void vtkSMTKResourceRepresentation::SetInstanceVisibility(unsigned int index, bool visible)
@@ -25,6 +25,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 class vtkSMTKWrapper;
 
@@ -357,21 +358,13 @@ protected:
   void UpdateDisplayAttributesFromSelection(
     vtkMultiBlockDataSet* modelData,
     vtkMultiBlockDataSet* instanceData);
-  void UpdateSelection(
-    vtkMultiBlockDataSet* data,
-    vtkCompositeDataDisplayAttributes* blockAttr,
-    vtkActor* actor);
-  vtkDataObject* FindNode(vtkMultiBlockDataSet* data, const smtk::common::UUID& uuid);
 
   /**
-   * Clear the current selection stored in the mapper's
-   * vtkCompositeDisplayDataAttributes. For vtkCompositePolyDataMapper2,
-   * setting the top node as false is enough since the state of the top
-   * node will stream down to its nodes.  Glyph3DMapper does not behave as
-   * vtkCompositePolyDataMapper2, hence it is necessary to update the block
-   * visibility of each node directly.
+   * Return \a data to its unselected appearance, undoing SetSelectedState().
+   * Its visibility in the unselected mappers reverts to that in ComponentState
+   * (or to the default when it has no state).
    */
-  void ClearSelection(vtkMapper* mapper);
+  void ResetSelectedState(vtkDataObject* data);
 
   /**
    * Update the active coloring mode (field coloring, etc.).
@@ -497,6 +490,12 @@ protected:
 
   /// Hold a map of renderable objects whose style is altered by an SMTK selection.
   RenderableDataMap RenderableData;
+  /// A hashed copy of RenderableData for the representation's own lookups.
+  std::unordered_map<smtk::common::UUID, vtkDataObject*> RenderableLookup;
+  /// The inverse of RenderableData: the UUID each renderable object represents.
+  std::unordered_map<vtkDataObject*, smtk::common::UUID> RenderableIds;
+  /// Renderable objects passed to SetSelectedState() since styles were last applied.
+  std::unordered_set<vtkDataObject*> StyledBlocks;
   /// Timestamp for when RenderableData was last updated
   vtkTimeStamp RenderableTime;
   /// Timestamp for when the SMTK application Selection was last modified.
@@ -81,7 +81,11 @@ private:
   /// Internal method run on a subthread to invoke the operation.
   smtk::operation::Operation::Result run(smtk::operation::Operation::Ptr operation);
 
-  smtk::common::ThreadPool<smtk::operation::Operation::Result> m_threadPool;
+  // Operations run at low priority since they may block on resource locks.
+  smtk::common::ThreadPool<smtk::operation::Operation::Result> m_threadPool{
+    0,
+    smtk::common::Executor::Priority::Low
+  };
 };
 
 namespace qt
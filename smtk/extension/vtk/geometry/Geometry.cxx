@@ -24,6 +24,12 @@ namespace vtk
 namespace geometry
 {
 
+std::size_t Geometry::memoryUsage(const DataType& data) const
+{
+  // VTK reports memory in kibibytes.
+  return data ? static_cast<std::size_t>(data->GetActualMemorySize()) * 1024 : 0;
+}
+
 void Geometry::addColorArray(
   vtkDataObject* data,
   const std::vector<double>& rgba,
@@ -71,6 +71,9 @@ public:
   /// The VTK backend requires a purpose for each object's geometry.
   virtual Purpose purpose(const smtk::resource::PersistentObjectPtr& obj) const = 0;
 
+  /// Report the memory used by VTK data so caching providers can enforce a budget.
+  std::size_t memoryUsage(const DataType& data) const override;
+
   /// A convenience to add a field-data color array to a cache entry (used to set object color).
   static void addColorArray(
     vtkDataObject* data,
@@ -294,7 +294,7 @@ int vtkResourceMultiBlockSource::RequestDataFromGeometry(
     if (obj)
     {
       int dim = geometry.dimension(obj);
-      auto& data = geometry.data(obj);
+      auto data = geometry.data(obj);
       if (data)
       {
         // Add Data to the Cache Map
@@ -13,7 +13,14 @@
 #include "smtk/geometry/GeometryForBackend.h"
 #include "smtk/geometry/Resource.h"
 
+#include "smtk/common/ThreadPool.h"
+
+#include <algorithm>
+#include <future>
 #include <map>
+#include <memory>
+#include <unordered_set>
+#include <vector>
 
 namespace smtk
 {
@@ -33,6 +40,9 @@ namespace geometry
   *     + geometricBounds(const DataType&, BoundingBox&) — obtain bounds
   *       from cached geometry
   *
+  * The cache may be given a memory budget (see setMemoryBudget()), in which
+  * case ThisClass should also override memoryUsage(const DataType&).
+  * Entries may be populated in bulk and in parallel with populate().
   */
 template<typename BaseClass>
 class Cache : public BaseClass
@@ -54,6 +64,8 @@ public:
   {
     GenerationNumber m_generation; //!< A generation number or Invalid.
     DataType m_geometry;           //!< Geometry held by the cache.
+    std::size_t m_size = 0;        //!< Bytes used by m_geometry (see memoryUsage()).
+    std::size_t m_lastAccess = 0;  //!< When the entry was last used (for eviction).
 
     CacheEntry()
       : m_generation(Invalid)
@@ -106,120 +118,209 @@ public:
   /// If no cache entry existed previously, this will construct one.
   GenerationNumber generationNumber(const smtk::resource::PersistentObject::Ptr& obj) const override
   {
-    if (obj)
-    {
-      auto it = m_cache.find(obj->id());
-      bool found = it != m_cache.end();
-      if (found && it->second.m_geometry)
-      { // Cache is clean.
-        return it->second.m_generation;
-      }
-      else if (found)
-      { // Cache was marked dirty.
-        this->queryGeometry(obj, it->second);
-        if (!it->second.isValid())
-        {
-          m_cache.erase(it);
-        }
-        else
-        {
-          return it->second.m_generation;
-        }
-      }
-      else
-      { // No cache entry yet; try to add one.
-        CacheEntry entry;
-        this->queryGeometry(obj, entry);
-        if (entry.isValid())
-        {
-          m_cache[obj->id()] = entry;
-          return entry.m_generation;
-        }
-      }
-    }
-    return Invalid;
+    auto* entry = this->fetch(obj);
+    return entry ? entry->m_generation : Invalid;
   }
 
   /// Return the geometric bounds
   void bounds(const smtk::resource::PersistentObject::Ptr& obj, BoundingBox& bds) const override
   {
-    if (obj)
+    auto* entry = this->fetch(obj);
+    if (entry)
     {
-      auto it = m_cache.find(obj->id());
-      bool found = it != m_cache.end();
-      if (found && it->second.m_geometry)
-      { // Cache is clean:
-        this->geometricBounds(it->second.m_geometry, bds);
-        return;
-      }
-      else if (found)
-      { // Cache was marked dirty. Update it:
-        this->queryGeometry(obj, it->second);
-        if (it->second.isValid())
-        {
-          this->geometricBounds(it->second.m_geometry, bds);
-          return;
-        }
-        else
-        {
-          m_cache.erase(it);
-        }
-      }
-      else
-      {
-        CacheEntry entry;
-        this->queryGeometry(obj, entry);
-        if (entry.isValid())
-        {
-          m_cache[obj->id()] = entry;
-          this->geometricBounds(entry.m_geometry, bds);
-          return;
-        }
-      }
+      this->geometricBounds(entry->m_geometry, bds);
+      return;
     }
     // Object is invalid or has no geometry; return invalid bounds.
     bds[0] = bds[2] = bds[4] = 0.0;
     bds[1] = bds[3] = bds[5] = -1.0;
   }
 
-  /// Provide access to the actual cached geometry reference.
-  DataType& data(const smtk::resource::PersistentObject::Ptr& obj) const override
+  /// Provide access to the cached geometry.
+  ///
+  /// A copy of the cached handle is returned so that eviction of the
+  /// entry does not invalidate geometry the caller still holds.
+  DataType data(const smtk::resource::PersistentObject::Ptr& obj) const override
   {
-    if (obj)
+    auto* entry = this->fetch(obj);
+    if (entry)
     {
+      return entry->m_geometry;
+    }
+    return DataType();
+  }
+
+  /// Ensure each of the given objects has an up-to-date cache entry.
+  ///
+  /// Objects whose entries are missing or dirty are passed to queryGeometry()
+  /// on a pool of worker threads (see setNumberOfThreads()); the cache
+  /// itself is only modified on the calling thread once every query has
+  /// completed. When more than one thread is used, subclasses must ensure
+  /// that queryGeometry() may be invoked concurrently for distinct objects.
+  void populate(const std::vector<smtk::resource::PersistentObject::Ptr>& objects) const
+  {
+    struct Job
+    {
+      smtk::resource::PersistentObject::Ptr m_object;
+      CacheEntry m_entry;
+    };
+    std::vector<Job> jobs;
+    for (const auto& obj : objects)
+    {
+      if (!obj)
+      {
+        continue;
+      }
       auto it = m_cache.find(obj->id());
-      bool found = it != m_cache.end();
-      if (found && it->second.m_geometry)
-      { // Cache is clean.
-        return it->second.m_geometry;
+      if (it != m_cache.end() && it->second.m_geometry)
+      {
+        ++m_statistics.m_hits;
+        it->second.m_lastAccess = ++m_clock;
+        continue;
       }
-      else if (found)
-      { // Cache was marked dirty. Update it:
-        this->queryGeometry(obj, it->second);
-        if (it->second.isValid())
-        {
-          return it->second.m_geometry;
-        }
-        else
+      jobs.push_back(Job{ obj, it != m_cache.end() ? it->second : CacheEntry() });
+    }
+
+    if (m_numberOfThreads == 1 || jobs.size() < 2)
+    {
+      for (auto& job : jobs)
+      {
+        this->queryGeometry(job.m_object, job.m_entry);
+      }
+    }
+    else
+    {
+      if (!m_threadPool)
+      {
+        m_threadPool.reset(new smtk::common::ThreadPool<>(m_numberOfThreads));
+      }
+      // Hand each worker a contiguous range of jobs rather than queuing one
+      // task per object.
+      std::size_t numberOfTasks = 4 *
+        (m_numberOfThreads == 0 ? smtk::common::Executor::instance().numberOfThreads()
+                                : m_numberOfThreads);
+      std::size_t chunk =
+        std::max<std::size_t>(1, (jobs.size() + numberOfTasks - 1) / numberOfTasks);
+      std::vector<std::future<void>> futures;
+      for (std::size_t begin = 0; begin < jobs.size(); begin += chunk)
+      {
+        std::size_t end = std::min(begin + chunk, jobs.size());
+        futures.push_back((*m_threadPool)([this, &jobs, begin, end]() {
+          for (std::size_t ii = begin; ii < end; ++ii)
+          {
+            this->queryGeometry(jobs[ii].m_object, jobs[ii].m_entry);
+          }
+        }));
+      }
+      for (auto& future : futures)
+      {
+        // Run other pending tasks while waiting in case this thread is itself
+        // an executor worker.
+        smtk::common::Executor::instance().wait(future);
+        future.get();
+      }
+    }
+
+    for (auto& job : jobs)
+    {
+      ++m_statistics.m_misses;
+      auto it = m_cache.find(job.m_object->id());
+      if (it != m_cache.end())
+      {
+        m_bytes -= it->second.m_size;
+      }
+      if (!job.m_entry.isValid())
+      {
+        if (it != m_cache.end())
         {
           m_cache.erase(it);
         }
+        continue;
+      }
+      if (it == m_cache.end())
+      {
+        it = m_cache.emplace(job.m_object->id(), std::move(job.m_entry)).first;
       }
       else
-      { // No cache existed. See if we can create an entry:
-        CacheEntry entry;
-        this->queryGeometry(obj, entry);
-        if (entry.isValid())
-        {
-          m_cache[obj->id()] = entry;
-          return m_cache[obj->id()].m_geometry;
-        }
+      {
+        it->second = job.m_entry;
       }
+      this->updateUsage(it->second);
+    }
+    this->evict(nullptr);
+  }
+
+  /// Set/get the number of worker threads populate() uses to query geometry.
+  ///
+  /// The default is 1, which queries geometry on the calling thread.
+  /// A value of 0 uses one thread per hardware core.
+  //@{
+  void setNumberOfThreads(unsigned int numberOfThreads)
+  {
+    if (numberOfThreads != m_numberOfThreads)
+    {
+      m_numberOfThreads = numberOfThreads;
+      m_threadPool.reset();
+    }
+  }
+  unsigned int numberOfThreads() const { return m_numberOfThreads; }
+  //@}
+
+  /// Set/get the number of bytes of cached geometry to retain.
+  ///
+  /// When cached geometry (as reported by memoryUsage()) exceeds the budget,
+  /// the least-recently used entries that a consumer has reported hidden
+  /// (see setVisibility()) have their geometry freed until usage drops
+  /// below 7/8 of the budget. Objects whose visibility is unknown are never
+  /// evicted, so the budget may be exceeded when no consumer reports
+  /// visibility. Evicted
+  /// entries keep their generation number, exactly as if markModified()
+  /// had been called, so the next query regenerates them. Because of this,
+  /// a budget should only be set on providers whose queryGeometry() can
+  /// reproduce geometry on demand. The default of 0 imposes no limit.
+  //@{
+  void setMemoryBudget(std::size_t bytes)
+  {
+    m_budget = bytes;
+    this->evict(nullptr);
+  }
+  std::size_t memoryBudget() const { return m_budget; }
+  //@}
+
+  /// Return the number of bytes of geometry currently held by the cache.
+  std::size_t memoryUsed() const { return m_bytes; }
+
+  /// Mark an object as visible (or not).
+  ///
+  /// Only geometry for objects reported hidden may be evicted to meet the
+  /// memory budget. Eviction happens on the next cache miss (or change of
+  /// budget) rather than immediately.
+  void setVisibility(const smtk::common::UUID& uid, bool visible) override
+  {
+    if (visible)
+    {
+      m_hidden.erase(uid);
+    }
+    else
+    {
+      m_hidden.insert(uid);
     }
-    static DataType invalid;
-    return invalid;
   }
 
+  /// Counts of cache activity, useful for tuning the memory budget.
+  struct Statistics
+  {
+    std::size_t m_hits = 0;      //!< Queries answered by clean cache entries.
+    std::size_t m_misses = 0;    //!< Queries that required queryGeometry().
+    std::size_t m_evictions = 0; //!< Entries whose geometry was freed to meet the budget.
+  };
+
+  /// Return (or reset) statistics on cache activity.
+  //@{
+  const Statistics& statistics() const { return m_statistics; }
+  void resetStatistics() { m_statistics = Statistics(); }
+  //@}
+
   /// Visit each persistent object that has renderable geometry.
   ///
   /// This implementation calls ThisClass::update() to
@@ -271,6 +372,8 @@ public:
       {
         DataType blank; // Assume default constructor creates "null" data.
         it->second.m_geometry = blank;
+        m_bytes -= it->second.m_size;
+        it->second.m_size = 0;
       }
       else
       {
@@ -287,10 +390,122 @@ public:
   /// In this case, not only is the geometry freed, but the cache entry
   /// is also removed so that visitation will no longer query the resource
   /// for geometry with the given UUID.
-  bool erase(const smtk::common::UUID& uid) override { return m_cache.erase(uid) > 0; }
+  bool erase(const smtk::common::UUID& uid) override
+  {
+    m_hidden.erase(uid);
+    auto it = m_cache.find(uid);
+    if (it == m_cache.end())
+    {
+      return false;
+    }
+    m_bytes -= it->second.m_size;
+    m_cache.erase(it);
+    return true;
+  }
 
 protected:
+  /// Return an up-to-date cache entry for \a obj (or null if it has no geometry).
+  ///
+  /// This updates the cache on a miss and records the access for eviction.
+  CacheEntry* fetch(const smtk::resource::PersistentObject::Ptr& obj) const
+  {
+    if (!obj)
+    {
+      return nullptr;
+    }
+    auto it = m_cache.find(obj->id());
+    bool found = it != m_cache.end();
+    if (found && it->second.m_geometry)
+    { // Cache is clean.
+      ++m_statistics.m_hits;
+      it->second.m_lastAccess = ++m_clock;
+      return &it->second;
+    }
+    ++m_statistics.m_misses;
+    if (found)
+    { // Cache was marked dirty. Update it:
+      m_bytes -= it->second.m_size;
+      it->second.m_size = 0;
+      this->queryGeometry(obj, it->second);
+      if (!it->second.isValid())
+      {
+        m_cache.erase(it);
+        return nullptr;
+      }
+    }
+    else
+    { // No cache entry yet; try to add one.
+      CacheEntry entry;
+      this->queryGeometry(obj, entry);
+      if (!entry.isValid())
+      {
+        return nullptr;
+      }
+      it = m_cache.emplace(obj->id(), std::move(entry)).first;
+    }
+    this->updateUsage(it->second);
+    this->evict(&it->second);
+    return &it->second;
+  }
+
+  /// Account for the memory used by a freshly-queried \a entry.
+  void updateUsage(CacheEntry& entry) const
+  {
+    entry.m_size = entry.m_geometry ? this->memoryUsage(entry.m_geometry) : 0;
+    entry.m_lastAccess = ++m_clock;
+    m_bytes += entry.m_size;
+  }
+
+  /// Free the least-recently used geometry until the memory budget is met.
+  ///
+  /// Only entries reported hidden are evicted; \a keep (if non-null) never is.
+  /// Usage is reduced to 7/8 of the budget so that eviction (which must
+  /// sort candidates by age) does not run on every subsequent cache miss.
+  void evict(const CacheEntry* keep) const
+  {
+    if (m_budget == 0 || m_bytes <= m_budget)
+    {
+      return;
+    }
+    std::vector<typename std::map<smtk::common::UUID, CacheEntry>::iterator> candidates;
+    for (auto it = m_cache.begin(); it != m_cache.end(); ++it)
+    {
+      if (
+        it->second.m_size > 0 && &it->second != keep &&
+        m_hidden.find(it->first) != m_hidden.end())
+      {
+        candidates.push_back(it);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const auto& aa, const auto& bb) {
+      return aa->second.m_lastAccess < bb->second.m_lastAccess;
+    });
+    std::size_t target = m_budget - m_budget / 8;
+    for (auto& candidate : candidates)
+    {
+      if (m_bytes <= target)
+      {
+        break;
+      }
+      DataType blank;
+      candidate->second.m_geometry = blank;
+      m_bytes -= candidate->second.m_size;
+      candidate->second.m_size = 0;
+      ++m_statistics.m_evictions;
+    }
+  }
+
+  // Subclasses may modify m_cache directly (e.g., in update()), but doing so
+  // bypasses memory accounting; such entries are only counted against the
+  // budget once they are regenerated by queryGeometry().
   mutable std::map<smtk::common::UUID, CacheEntry> m_cache;
+  std::unordered_set<smtk::common::UUID> m_hidden;
+  std::size_t m_budget = 0;
+  mutable std::size_t m_bytes = 0;
+  mutable std::size_t m_clock = 0;
+  mutable Statistics m_statistics;
+  unsigned int m_numberOfThreads = 1;
+  mutable std::unique_ptr<smtk::common::ThreadPool<>> m_threadPool;
 };
 
 } // namespace geometry
@@ -154,6 +154,13 @@ public:
   virtual bool erase(const smtk::common::UUID& uid) = 0;
   //@}
 
+  /// Inform the geometry provider whether an object is currently displayed.
+  ///
+  /// Rendering consumers should call this as objects are shown or hidden.
+  /// Caching providers use it to decide which geometry may be freed;
+  /// the default implementation ignores it.
+  virtual void setVisibility(const smtk::common::UUID&, bool) {}
+
 protected:
   std::atomic<GenerationNumber> m_lastModified;
 };
@@ -48,10 +48,20 @@ public:
   virtual void update() const {}
   virtual void geometricBounds(const Format&, BoundingBox&) const = 0;
 
+  /// Return the number of bytes of memory used by the given geometry.
+  ///
+  /// Caching providers use this to enforce a memory budget.
+  /// The default returns 0, meaning the size is unknown and never
+  /// counted against a budget.
+  virtual std::size_t memoryUsage(const Format&) const { return 0; }
+
   /// Return the data associated with an object.
   ///
   /// Only call this method after ensuring that generationNumber(obj) != Invalid.
-  virtual Format& data(const resource::PersistentObject::Ptr&) const = 0;
+  /// The data is returned by value; when Format is a reference-counted handle
+  /// (e.g., vtkSmartPointer), callers share ownership of the geometry so it
+  /// remains valid even if a caching provider later frees its own copy.
+  virtual Format data(const resource::PersistentObject::Ptr&) const = 0;
 };
 
 } // namespace geometry
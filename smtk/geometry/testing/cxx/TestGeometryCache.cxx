@@ -0,0 +1,182 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/geometry/Backend.h"
+#include "smtk/geometry/Cache.h"
+
+#include "smtk/resource/Component.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace
+{
+// Each object's "geometry" is an array of doubles whose size is the
+// object's complexity.
+using Format = std::shared_ptr<std::vector<double>>;
+
+class TestBackend : public smtk::geometry::Backend
+{
+public:
+  std::string name() const override { return "TestBackend"; }
+};
+
+class Component : public smtk::resource::Component
+{
+public:
+  smtkTypeMacro(Component);
+  smtkSuperclassMacro(smtk::resource::Component);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  Component(std::size_t complexity)
+    : m_complexity(complexity)
+    , m_id(smtk::common::UUID::random())
+  {
+  }
+
+  const smtk::resource::ResourcePtr resource() const override { return nullptr; }
+  const smtk::common::UUID& id() const override { return m_id; }
+  bool setId(const smtk::common::UUID& id) override
+  {
+    m_id = id;
+    return true;
+  }
+
+  std::size_t m_complexity;
+  smtk::common::UUID m_id;
+};
+
+class Geometry : public smtk::geometry::Cache<smtk::geometry::GeometryForBackend<Format>>
+{
+public:
+  const smtk::geometry::Backend& backend() const override
+  {
+    static TestBackend data;
+    return data;
+  }
+
+  smtk::geometry::Resource::Ptr resource() const override { return nullptr; }
+
+  // Queries may run concurrently; they only touch the entry passed to them.
+  void queryGeometry(const smtk::resource::PersistentObject::Ptr& obj, CacheEntry& entry)
+    const override
+  {
+    ++m_queries;
+    auto comp = std::dynamic_pointer_cast<Component>(obj);
+    if (comp && comp->m_complexity > 0)
+    {
+      entry.m_geometry = std::make_shared<std::vector<double>>(comp->m_complexity, 1.0);
+      entry.m_generation = entry.isValid() ? entry.m_generation + 1 : Initial;
+    }
+    else
+    {
+      entry.m_generation = Invalid;
+    }
+  }
+
+  void geometricBounds(const Format& value, BoundingBox& bds) const override
+  {
+    bds[0] = bds[2] = bds[4] = 0.0;
+    bds[1] = bds[3] = bds[5] = static_cast<double>(value->size());
+  }
+
+  std::size_t memoryUsage(const Format& value) const override
+  {
+    return value->size() * sizeof(double);
+  }
+
+  mutable std::atomic<int> m_queries{ 0 };
+};
+} // namespace
+
+int TestGeometryCache(int /*unused*/, char** const /*unused*/)
+{
+  constexpr std::size_t numberOfObjects = 100;
+  constexpr std::size_t objectBytes = 10 * sizeof(double);
+  std::vector<smtk::resource::PersistentObject::Ptr> objects;
+  for (std::size_t ii = 0; ii < numberOfObjects; ++ii)
+  {
+    objects.push_back(std::make_shared<Component>(10));
+  }
+  objects.push_back(std::make_shared<Component>(0)); // An object without geometry.
+
+  // Populate entries in parallel.
+  Geometry geometry;
+  geometry.setNumberOfThreads(4);
+  geometry.populate(objects);
+  smtkTest(
+    geometry.m_queries == static_cast<int>(numberOfObjects + 1), "Expected one query per object.");
+  smtkTest(geometry.statistics().m_misses == numberOfObjects + 1, "Expected a miss per object.");
+  smtkTest(
+    geometry.memoryUsed() == numberOfObjects * objectBytes, "Expected all geometry to be counted.");
+  smtkTest(
+    geometry.generationNumber(objects.back()) == Geometry::Invalid,
+    "Expected no entry for an object without geometry.");
+
+  // Populated entries are hits.
+  geometry.resetStatistics();
+  geometry.populate(objects);
+  smtkTest(geometry.statistics().m_hits == numberOfObjects, "Expected populated entries to hit.");
+  Geometry::BoundingBox bds;
+  geometry.bounds(objects[0], bds);
+  smtkTest(bds[1] == 10.0, "Expected bounds from cached geometry.");
+  smtkTest(geometry.statistics().m_hits == numberOfObjects + 1, "Expected bounds to hit.");
+
+  // Geometry is not evicted unless a consumer has reported it hidden.
+  geometry.resetStatistics();
+  geometry.setMemoryBudget(20 * objectBytes);
+  smtkTest(
+    geometry.statistics().m_evictions == 0 &&
+      geometry.memoryUsed() == numberOfObjects * objectBytes,
+    "Expected no evictions without visibility information.");
+
+  // Imposing a budget evicts the least-recently used, hidden entries.
+  for (const auto& object : objects)
+  {
+    geometry.setVisibility(object->id(), false);
+  }
+  geometry.setVisibility(objects[1]->id(), true);
+  geometry.setMemoryBudget(20 * objectBytes);
+  smtkTest(
+    geometry.memoryUsed() <= geometry.memoryBudget(), "Expected usage to meet the budget.");
+  smtkTest(geometry.statistics().m_evictions > 0, "Expected evictions.");
+  smtkTest(!!geometry.data(objects[1]), "Expected visible geometry to be retained.");
+  smtkTest(
+    geometry.statistics().m_misses == 0 && geometry.statistics().m_hits == 1,
+    "Expected visible geometry to hit.");
+  smtkTest(!!geometry.data(objects[0]), "Expected recently-used geometry to be retained.");
+  smtkTest(geometry.statistics().m_misses == 0, "Expected recently-used geometry to hit.");
+
+  // Geometry handed out by the cache survives eviction.
+  Format held = geometry.data(objects[3]);
+  smtkTest(geometry.statistics().m_misses == 1, "Expected evicted geometry to miss.");
+  geometry.markModified(objects[3]);
+  smtkTest(held && held->size() == 10, "Expected returned geometry to be shared.");
+
+  // Evicted entries are regenerated on demand with a new generation number.
+  geometry.resetStatistics();
+  auto generation = geometry.generationNumber(objects[2]);
+  smtkTest(geometry.statistics().m_misses == 1, "Expected evicted geometry to miss.");
+  smtkTest(generation == Geometry::Initial + 1, "Expected regenerated geometry to be newer.");
+  smtkTest(
+    geometry.memoryUsed() <= geometry.memoryBudget(), "Expected usage to remain within budget.");
+
+  // Erasing entries releases their memory.
+  for (const auto& object : objects)
+  {
+    geometry.erase(object->id());
+  }
+  smtkTest(geometry.memoryUsed() == 0, "Expected no memory used after erasure.");
+
+  return 0;
+}
@@ -15,17 +15,65 @@
 
 #include "smtk/common/CompilerInformation.h"
 #include "smtk/common/TypeMap.h"
+#include "smtk/common/UUID.h"
+
+#include "smtk/graph/TypeTraits.h"
+
+#include <functional>
+#include <string>
+#include <unordered_map>
 
 namespace smtk
 {
 namespace graph
 {
+namespace detail
+{
+template<typename T>
+const T& unwrap(const std::reference_wrapper<T>& node)
+{
+  return node.get();
+}
+
+template<typename T>
+const T& unwrap(const T& node)
+{
+  return node;
+}
+
+/// Invoke \a functor on the id of each node at the head of \a arc (for arc
+/// types whose to() method returns a container of nodes).
+template<typename ArcType, typename Functor>
+typename std::enable_if<is_container<decltype(std::declval<const ArcType&>().to())>::value>::type
+visitToIds(const ArcType& arc, const Functor& functor)
+{
+  for (const auto& to : arc.to())
+  {
+    functor(unwrap(to).id());
+  }
+}
+
+/// Invoke \a functor on the id of the node at the head of \a arc (for arc
+/// types whose to() method returns a single node).
+template<typename ArcType, typename Functor>
+typename std::enable_if<!is_container<decltype(std::declval<const ArcType&>().to())>::value>::type
+visitToIds(const ArcType& arc, const Functor& functor)
+{
+  functor(arc.to().id());
+}
+} // namespace detail
 
 /**\brief A container for arcs held by a resource.
   *
   * The main reason this currently exists is to delete the copy/assignment
   * constructors so developers must reference the container instead of
   * mistakenly modifying an accidental copy.
+  *
+  * Arc types may optionally maintain an inverse (incoming) index that maps
+  * the id of each node at the head of an arc to the ids of the nodes at its
+  * tail. The index is kept up to date as arcs are inserted and erased through
+  * this class; arc containers modified in place must report their changes via
+  * connect() and disconnect() (as the Arcs and OrderedArcs APIs do).
   */
 class SMTKCORE_EXPORT ArcMap : public smtk::common::TypeMap<smtk::common::UUID>
 {
@@ -43,6 +91,186 @@ public:
   ArcMap& operator=(const ArcMap&) = delete;
 
   ~ArcMap() override = default;
+
+  /// A map from the id of a node at the head of an arc to the ids of nodes at
+  /// the tail of arcs pointing to it (along with the number of such arcs).
+  using InverseIndex =
+    std::unordered_map<smtk::common::UUID, std::unordered_map<smtk::common::UUID, std::size_t>>;
+
+  /// Insert (\a Type, \a key, \a value ) into the map.
+  template<typename Type>
+  bool insert(const smtk::common::UUID& key, const Type& value)
+  {
+    if (!Superclass::insert<Type>(key, value))
+    {
+      return false;
+    }
+    this->index<Type>(key, true);
+    return true;
+  }
+
+  /// Emplace (\a Type, \a key, \a value ) into the map.
+  template<typename Type>
+  bool emplace(const smtk::common::UUID& key, Type&& value)
+  {
+    if (!Superclass::emplace<Type>(key, std::forward<Type>(value)))
+    {
+      return false;
+    }
+    this->index<Type>(key, true);
+    return true;
+  }
+
+  /// Erase value of type \a Type indexed by \a key from the map.
+  template<typename Type>
+  void erase(const smtk::common::UUID& key)
+  {
+    if (this->hasInverseIndex<Type>() && this->contains<Type>(key))
+    {
+      this->index<Type>(key, false);
+    }
+    Superclass::erase<Type>(key);
+  }
+
+  /// Enable an inverse index for arcs of type \a Type. Any arcs already
+  /// present are indexed.
+  template<typename Type>
+  void insertInverseIndex()
+  {
+    auto inserted =
+      m_inverse.insert(std::make_pair(smtk::common::typeName<Type>(), InverseIndex()));
+    if (inserted.second && this->containsType<Type>())
+    {
+      for (const auto& entry : this->get<Type>().data())
+      {
+        this->index<Type>(entry.first, true);
+      }
+    }
+  }
+
+  /// Check whether arcs of type \a Type maintain an inverse index.
+  template<typename Type>
+  bool hasInverseIndex() const
+  {
+    return m_inverse.find(smtk::common::typeName<Type>()) != m_inverse.end();
+  }
+
+  /// Record an arc of type \a Type from node \a from to node \a to that was
+  /// added to an existing arc container in place.
+  template<typename Type>
+  void connect(const smtk::common::UUID& from, const smtk::common::UUID& to)
+  {
+    auto it = m_inverse.find(smtk::common::typeName<Type>());
+    if (it != m_inverse.end())
+    {
+      ++it->second[to][from];
+    }
+  }
+
+  /// Record the removal of an arc of type \a Type from node \a from to node
+  /// \a to from an existing arc container.
+  template<typename Type>
+  void disconnect(const smtk::common::UUID& from, const smtk::common::UUID& to)
+  {
+    auto it = m_inverse.find(smtk::common::typeName<Type>());
+    if (it != m_inverse.end())
+    {
+      ArcMap::disconnect(it->second, from, to);
+    }
+  }
+
+  /// Invoke \a visitor on the id of each node with an arc of type \a Type
+  /// pointing to the node with id \a to. If \a Type has an inverse index, this
+  /// is proportional to the number of incoming arcs; otherwise every arc of
+  /// type \a Type is examined. Return true if the visitor terminated early
+  /// (by returning true).
+  template<typename Type>
+  bool visitIncoming(
+    const smtk::common::UUID& to,
+    const std::function<bool(const smtk::common::UUID&)>& visitor) const
+  {
+    auto it = m_inverse.find(smtk::common::typeName<Type>());
+    if (it != m_inverse.end())
+    {
+      auto incoming = it->second.find(to);
+      if (incoming != it->second.end())
+      {
+        for (const auto& from : incoming->second)
+        {
+          if (visitor(from.first))
+          {
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    if (!this->containsType<Type>())
+    {
+      return false;
+    }
+    for (const auto& entry : this->get<Type>().data())
+    {
+      bool pointsTo = false;
+      detail::visitToIds(entry.second, [&pointsTo, &to](const smtk::common::UUID& id) {
+        pointsTo |= (id == to);
+      });
+      if (pointsTo && visitor(entry.first))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  // Add (or remove) the arcs stored under \a key to (or from) the inverse
+  // index for \a Type.
+  template<typename Type>
+  void index(const smtk::common::UUID& key, bool add)
+  {
+    auto it = m_inverse.find(smtk::common::typeName<Type>());
+    if (it == m_inverse.end())
+    {
+      return;
+    }
+    InverseIndex& inverse = it->second;
+    detail::visitToIds(
+      this->at<Type>(key), [&inverse, &key, add](const smtk::common::UUID& to) {
+        if (add)
+        {
+          ++inverse[to][key];
+        }
+        else
+        {
+          ArcMap::disconnect(inverse, key, to);
+        }
+      });
+  }
+
+  static void disconnect(
+    InverseIndex& inverse,
+    const smtk::common::UUID& from,
+    const smtk::common::UUID& to)
+  {
+    auto incoming = inverse.find(to);
+    if (incoming == inverse.end())
+    {
+      return;
+    }
+    auto count = incoming->second.find(from);
+    if (count != incoming->second.end() && --count->second == 0)
+    {
+      incoming->second.erase(count);
+      if (incoming->second.empty())
+      {
+        inverse.erase(incoming);
+      }
+    }
+  }
+
+  std::unordered_map<std::string, InverseIndex> m_inverse;
 };
 
 } // namespace graph
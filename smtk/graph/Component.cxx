@@ -37,18 +37,21 @@ bool Component::setId(const smtk::common::UUID& uid)
 {
   if (auto resource = m_resource.lock())
   {
-    const_cast<ResourceBase::NodeSet&>(resource->nodes()).erase(this->shared_from_this());
+    auto self = this->shared_from_this();
+    bool wasPresent = resource->eraseNode(self);
     smtk::common::UUID tmp = m_id;
     m_id = uid;
-    if (const_cast<ResourceBase::NodeSet&>(resource->nodes())
-          .insert(this->shared_from_this())
-          .second)
+    if (resource->insertNode(self))
     {
       return true;
     }
     else
     {
       m_id = tmp;
+      if (wasPresent)
+      {
+        resource->insertNode(self);
+      }
       return false;
     }
   }
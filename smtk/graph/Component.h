@@ -116,6 +116,19 @@ public:
     return API().get(*static_cast<const typename ArcType::FromType*>(this));
   }
 
+  /// The incoming() method returns the nodes that have an arc of type ArcType
+  /// pointing to this node. If the resource's traits list ArcType among its
+  /// InverseIndexedArcTypes, this is proportional to the number of incoming
+  /// arcs; otherwise, all arcs of type ArcType are examined.
+  template<typename ArcType>
+  auto incoming() const
+    -> decltype(std::declval<const typename ArcType::template API<ArcType>>().incoming(
+      std::declval<const typename ArcType::ToType&>()))
+  {
+    typedef const typename ArcType::template API<ArcType> API;
+    return API().incoming(*static_cast<const typename ArcType::ToType*>(this));
+  }
+
   /// While get() returns the nodes connected to this component via the input arc
   /// type, visit() allows you to pass your calling code to each connected node
   /// without having to return a reference to each node. Input lambdas return a
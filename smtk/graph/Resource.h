@@ -30,6 +30,7 @@
 #include <string>
 #include <tuple>
 #include <typeindex>
+#include <vector>
 
 namespace smtk
 {
@@ -78,16 +79,27 @@ public:
     enable_if<smtk::tuple_contains<NodeType, typename GraphTraits::NodeTypes>::value, bool>::type
     add(const std::shared_ptr<NodeType>& node)
   {
-    return ResourceBase::m_nodes.insert(node).second;
+    return ResourceBase::insertNode(node);
   }
 
-  /// Remove a node from the resource. Return true if the removal took place.
+  /// Remove a node from the resource, along with any arcs that originate at
+  /// the node. Return true if the removal took place.
+  ///
+  /// Arcs terminating at the node are also removed for arc types listed in
+  /// GraphTraits::InverseIndexedArcTypes, whose inverse index locates them in
+  /// time proportional to the node's degree. Only arc types whose endpoints
+  /// may be of type NodeType are considered.
   template<typename NodeType>
   typename std::
     enable_if<smtk::tuple_contains<NodeType, typename GraphTraits::NodeTypes>::value, bool>::type
     remove(const std::shared_ptr<NodeType>& node)
   {
-    return ResourceBase::m_nodes.erase(node) > 0;
+    if (!ResourceBase::eraseNode(node))
+    {
+      return false;
+    }
+    this->template removeArcs<0, typename GraphTraits::ArcTypes, NodeType>(node->id());
+    return true;
   }
 
   /// Create an arc of type ArcType with additional constructor arguments.
@@ -141,15 +153,123 @@ protected:
     : Superclass(manager)
     , m_arcs(identity<typename GraphTraits::ArcTypes>())
   {
+    this->template insertInverseIndices<0, InverseIndexedArcTypes>();
   }
 
   Resource(const smtk::common::UUID& uid, smtk::resource::ManagerPtr manager = nullptr)
     : Superclass(uid, manager)
     , m_arcs(identity<typename GraphTraits::ArcTypes>())
   {
+    this->template insertInverseIndices<0, InverseIndexedArcTypes>();
+  }
+
+  const smtk::resource::filter::Rules* queryRules(
+    const std::function<bool(const smtk::resource::Component&)>& queryOp) const override
+  {
+    const auto* filter =
+      queryOp.target<smtk::resource::filter::Filter<smtk::graph::filter::Grammar>>();
+    return filter ? &filter->rules() : nullptr;
   }
 
   ArcMap m_arcs;
+
+private:
+  typedef typename inverse_indexed_arc_types<GraphTraits>::type InverseIndexedArcTypes;
+
+  template<std::size_t I, typename Tuple>
+  inline typename std::enable_if<I != std::tuple_size<Tuple>::value>::type insertInverseIndices()
+  {
+    typedef typename std::tuple_element<I, Tuple>::type ArcType;
+    static_assert(
+      smtk::tuple_contains<ArcType, typename GraphTraits::ArcTypes>::value,
+      "Inverse-indexed arc types must be listed in the resource's ArcTypes.");
+    m_arcs.insertInverseIndex<ArcType>();
+    this->template insertInverseIndices<I + 1, Tuple>();
+  }
+
+  template<std::size_t I, typename Tuple>
+  inline typename std::enable_if<I == std::tuple_size<Tuple>::value>::type insertInverseIndices()
+  {
+  }
+
+  // True if a node of static type \a NodeType may be an endpoint of type
+  // \a EndpointType.
+  template<typename NodeType, typename EndpointType>
+  struct may_be
+    : std::integral_constant<
+        bool,
+        std::is_base_of<EndpointType, NodeType>::value ||
+          std::is_base_of<NodeType, EndpointType>::value>
+  {
+  };
+
+  template<std::size_t I, typename Tuple, typename NodeType>
+  inline typename std::enable_if<I != std::tuple_size<Tuple>::value>::type removeArcs(
+    const smtk::common::UUID& id)
+  {
+    typedef typename std::tuple_element<I, Tuple>::type ArcType;
+    typedef typename std::decay<typename ArcType::FromType>::type FromType;
+    typedef typename std::decay<typename ArcType::ToType>::type ToType;
+
+    // Remove arcs originating at the node.
+    if (may_be<NodeType, FromType>::value && m_arcs.contains<ArcType>(id))
+    {
+      m_arcs.erase<ArcType>(id);
+    }
+
+    // Remove arcs terminating at the node. Without an inverse index, this
+    // would require a scan of every arc of this type, so it is skipped.
+    if (may_be<NodeType, ToType>::value && m_arcs.hasInverseIndex<ArcType>())
+    {
+      std::vector<smtk::common::UUID> sources;
+      m_arcs.visitIncoming<ArcType>(id, [&sources](const smtk::common::UUID& from) {
+        sources.push_back(from);
+        return false;
+      });
+      for (const auto& from : sources)
+      {
+        this->template removeArcsTo<ArcType>(from, id);
+      }
+    }
+
+    this->template removeArcs<I + 1, Tuple, NodeType>(id);
+  }
+
+  template<std::size_t I, typename Tuple, typename NodeType>
+  inline typename std::enable_if<I == std::tuple_size<Tuple>::value>::type removeArcs(
+    const smtk::common::UUID&)
+  {
+  }
+
+  // Remove every arc of type ArcType from \a from to \a to (for arc types
+  // that hold a container of nodes).
+  template<typename ArcType>
+  typename std::enable_if<is_container<decltype(std::declval<ArcType&>().to())>::value>::type
+  removeArcsTo(const smtk::common::UUID& from, const smtk::common::UUID& to)
+  {
+    auto& container = m_arcs.at<ArcType>(from).to();
+    for (auto it = container.begin(); it != container.end();)
+    {
+      if (detail::unwrap(*it).id() == to)
+      {
+        it = container.erase(it);
+        m_arcs.disconnect<ArcType>(from, to);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  // Remove the arc of type ArcType from \a from (for arc types that hold a
+  // single node).
+  template<typename ArcType>
+  typename std::enable_if<!is_container<decltype(std::declval<ArcType&>().to())>::value>::type
+  removeArcsTo(const smtk::common::UUID& from, const smtk::common::UUID&)
+  {
+    m_arcs.erase<ArcType>(from);
+  }
 };
 
 } // namespace graph
@@ -24,31 +24,27 @@ bool ResourceBase::Compare::operator()(
   return (!lhs ? true : (!rhs ? false : lhs->id() < rhs->id()));
 }
 
-std::shared_ptr<smtk::resource::Component> ResourceBase::find(
-  const smtk::common::UUID& compId) const
+bool ResourceBase::Compare::operator()(
+  const smtk::common::UUID& lhs,
+  const std::shared_ptr<smtk::resource::Component>& rhs) const
 {
-  // Components are stored in a set, so we construct a dummy component to find
-  // the component we want.
-  struct QueryKey : resource::Component
-  {
-    QueryKey(const smtk::common::UUID& id)
-      : m_id(id)
-    {
-    }
-    const smtk::common::UUID& id() const final { return m_id; }
-    bool setId(const smtk::common::UUID&) final { return false; }
-    const smtk::resource::ResourcePtr resource() const final
-    {
-      return smtk::resource::ResourcePtr();
-    }
+  return (!rhs ? false : lhs < rhs->id());
+}
 
-    const smtk::common::UUID& m_id;
-  };
+bool ResourceBase::Compare::operator()(
+  const std::shared_ptr<smtk::resource::Component>& lhs,
+  const smtk::common::UUID& rhs) const
+{
+  return (!lhs ? true : lhs->id() < rhs);
+}
 
-  auto it = m_nodes.find(std::make_shared<QueryKey>(compId));
-  if (it != m_nodes.end())
+std::shared_ptr<smtk::resource::Component> ResourceBase::find(
+  const smtk::common::UUID& compId) const
+{
+  auto it = m_index.find(compId);
+  if (it != m_index.end())
   {
-    return *it;
+    return *(it->second);
   }
   return std::shared_ptr<smtk::resource::Component>();
 }
@@ -61,5 +57,48 @@ void ResourceBase::visit(std::function<void(const smtk::resource::ComponentPtr&)
   }
 }
 
+bool ResourceBase::insertNode(const std::shared_ptr<smtk::resource::Component>& node)
+{
+  if (!node)
+  {
+    return false;
+  }
+
+  auto inserted = m_nodes.insert(node);
+  if (!inserted.second)
+  {
+    return false;
+  }
+  m_index[node->id()] = inserted.first;
+  m_typeIndex[node->typeName()].insert(node->id());
+  return true;
+}
+
+bool ResourceBase::eraseNode(const std::shared_ptr<smtk::resource::Component>& node)
+{
+  if (!node)
+  {
+    return false;
+  }
+
+  auto it = m_index.find(node->id());
+  if (it == m_index.end())
+  {
+    return false;
+  }
+  auto typeIt = m_typeIndex.find(node->typeName());
+  if (typeIt != m_typeIndex.end())
+  {
+    typeIt->second.erase(node->id());
+    if (typeIt->second.empty())
+    {
+      m_typeIndex.erase(typeIt);
+    }
+  }
+  m_nodes.erase(it->second);
+  m_index.erase(it);
+  return true;
+}
+
 } // namespace graph
 } // namespace smtk
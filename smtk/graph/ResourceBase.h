@@ -17,9 +17,12 @@
 #include "smtk/graph/ArcMap.h"
 
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace smtk
 {
@@ -35,11 +38,21 @@ class SMTKCORE_EXPORT ResourceBase
   : public smtk::resource::DerivedFrom<ResourceBase, smtk::geometry::Resource>
 {
 protected:
+  /// Order nodes by UUID. The comparator is transparent so that nodes may be
+  /// located in a NodeSet by UUID without constructing a key component.
   struct SMTKCORE_EXPORT Compare
   {
+    using is_transparent = std::true_type;
+
     bool operator()(
       const std::shared_ptr<smtk::resource::Component>& lhs,
       const std::shared_ptr<smtk::resource::Component>& rhs) const;
+    bool operator()(
+      const smtk::common::UUID& lhs,
+      const std::shared_ptr<smtk::resource::Component>& rhs) const;
+    bool operator()(
+      const std::shared_ptr<smtk::resource::Component>& lhs,
+      const smtk::common::UUID& rhs) const;
   };
 
 public:
@@ -48,16 +61,29 @@ public:
 
   using NodeSet = std::set<std::shared_ptr<smtk::resource::Component>, Compare>;
 
+  /// A hashed index from node UUIDs to their location in the NodeSet, used
+  /// to make find() an allocation-free, constant-time lookup.
+  using NodeIndex = std::unordered_map<smtk::common::UUID, NodeSet::const_iterator>;
+
+  /// A hashed index from node type names to the UUIDs of nodes of that type,
+  /// used to answer filter queries on node type without visiting every node.
+  using NodeTypeIndex = std::unordered_map<std::string, std::unordered_set<smtk::common::UUID>>;
+
   std::shared_ptr<smtk::resource::Component> find(const smtk::common::UUID&) const override;
 
   void visit(std::function<void(const smtk::resource::ComponentPtr&)>& v) const override;
 
   const NodeSet& nodes() const { return m_nodes; }
 
+  /// Access the UUIDs of nodes, grouped by their typeName().
+  const NodeTypeIndex& nodesByType() const { return m_typeIndex; }
+
   virtual const ArcMap& arcs() const = 0;
   virtual ArcMap& arcs() = 0;
 
 protected:
+  friend class Component;
+
   ResourceBase(smtk::resource::ManagerPtr manager = nullptr)
     : Superclass(manager)
   {
@@ -68,7 +94,17 @@ protected:
   {
   }
 
+  /// Insert a node into the resource, keeping the UUID and type indices in
+  /// sync. Return true if the insertion took place.
+  bool insertNode(const std::shared_ptr<smtk::resource::Component>& node);
+
+  /// Remove a node from the resource, keeping the UUID and type indices in
+  /// sync. Return true if the removal took place.
+  bool eraseNode(const std::shared_ptr<smtk::resource::Component>& node);
+
   NodeSet m_nodes;
+  NodeIndex m_index;
+  NodeTypeIndex m_typeIndex;
 };
 
 } // namespace graph
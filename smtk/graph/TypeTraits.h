@@ -12,6 +12,7 @@
 #define smtk_graph_TypeTraits_h
 
 #include <functional>
+#include <tuple>
 #include <type_traits>
 
 namespace smtk
@@ -90,6 +91,30 @@ public:
   using type = decltype(testAccepts<Functor>(nullptr));
   static constexpr bool value = type::value;
 };
+
+template<typename...>
+struct make_void
+{
+  typedef void type;
+};
+
+/// The tuple of arc types for which a resource with traits \a Traits maintains
+/// an inverse (incoming) index. Traits may opt in by declaring
+/// `typedef std::tuple<...> InverseIndexedArcTypes;`; otherwise no arc types
+/// are indexed.
+template<typename Traits, typename = void>
+struct inverse_indexed_arc_types
+{
+  typedef std::tuple<> type;
+};
+
+template<typename Traits>
+struct inverse_indexed_arc_types<
+  Traits,
+  typename make_void<typename Traits::InverseIndexedArcTypes>::type>
+{
+  typedef typename Traits::InverseIndexedArcTypes type;
+};
 } // namespace graph
 } // namespace smtk
 
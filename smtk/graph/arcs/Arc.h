@@ -13,6 +13,9 @@
 
 #include "smtk/common/CompilerInformation.h"
 
+#include <functional>
+#include <vector>
+
 namespace smtk
 {
 namespace graph
@@ -77,6 +80,22 @@ public:
         .template get<SelfType>()
         .contains(lhs.id());
     }
+
+    /// Return the nodes with an arc of this type pointing to \a rhs. This is
+    /// proportional to the number of incoming arcs if the resource's traits
+    /// request an inverse index for this arc type.
+    std::vector<std::reference_wrapper<const FromType>> incoming(const ToType& rhs) const
+    {
+      std::vector<std::reference_wrapper<const FromType>> result;
+      const auto& arcs =
+        std::static_pointer_cast<smtk::graph::ResourceBase>(rhs.resource())->arcs();
+      arcs.template visitIncoming<SelfType>(
+        rhs.id(), [&arcs, &result](const smtk::common::UUID& from) {
+          result.push_back(std::cref(arcs.template at<SelfType>(from).from()));
+          return false;
+        });
+      return result;
+    }
   };
 
 private:
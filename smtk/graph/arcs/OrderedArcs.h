@@ -111,6 +111,57 @@ public:
         .template get<SelfType>()
         .contains(lhs.id());
     }
+
+    /// Append an arc from \a lhs to \a rhs. Unlike modifying the container
+    /// returned by get(), this keeps the resource's inverse index (if any) up
+    /// to date.
+    bool connect(const FromType& lhs, const ToType& rhs)
+    {
+      self(lhs).to().push_back(std::cref(rhs));
+      std::static_pointer_cast<smtk::graph::ResourceBase>(lhs.resource())
+        ->arcs()
+        .template connect<SelfType>(lhs.id(), rhs.id());
+      return true;
+    }
+
+    /// Remove the first arc from \a lhs to \a rhs. Return true if an arc was
+    /// removed.
+    bool disconnect(const FromType& lhs, const ToType& rhs)
+    {
+      if (!this->contains(lhs))
+      {
+        return false;
+      }
+      auto& to = self(lhs).to();
+      for (auto it = to.begin(); it != to.end(); ++it)
+      {
+        if (it->get().id() == rhs.id())
+        {
+          to.erase(it);
+          std::static_pointer_cast<smtk::graph::ResourceBase>(lhs.resource())
+            ->arcs()
+            .template disconnect<SelfType>(lhs.id(), rhs.id());
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /// Return the nodes with an arc of this type pointing to \a rhs. This is
+    /// proportional to the number of incoming arcs if the resource's traits
+    /// request an inverse index for this arc type.
+    std::vector<std::reference_wrapper<const FromType>> incoming(const ToType& rhs) const
+    {
+      std::vector<std::reference_wrapper<const FromType>> result;
+      const auto& arcs =
+        std::static_pointer_cast<smtk::graph::ResourceBase>(rhs.resource())->arcs();
+      arcs.template visitIncoming<SelfType>(
+        rhs.id(), [&arcs, &result](const smtk::common::UUID& from) {
+          result.push_back(std::cref(arcs.template at<SelfType>(from).from()));
+          return false;
+        });
+      return result;
+    }
   };
 
 private:
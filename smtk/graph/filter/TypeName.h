@@ -10,6 +10,8 @@
 #ifndef smtk_graph_filter_TypeName_h
 #define smtk_graph_filter_TypeName_h
 
+#include "smtk/graph/ResourceBase.h"
+
 #include "smtk/resource/filter/Action.h"
 #include "smtk/resource/filter/Name.h"
 #include "smtk/resource/filter/Rule.h"
@@ -53,6 +55,39 @@ struct TypeName
       return (object.typeName() == value);
     }
 
+    // Nodes are indexed by type name in graph resources.
+    bool estimateCandidates(
+      const smtk::resource::Resource& resource, std::size_t& count) const override
+    {
+      const auto* graphResource = dynamic_cast<const smtk::graph::ResourceBase*>(&resource);
+      if (!graphResource)
+      {
+        return false;
+      }
+      auto it = graphResource->nodesByType().find(value);
+      count = (it == graphResource->nodesByType().end() ? 0 : it->second.size());
+      return true;
+    }
+
+    void visitCandidates(
+      const smtk::resource::Resource& resource,
+      const std::function<void(const smtk::common::UUID&)>& visitor) const override
+    {
+      const auto* graphResource = dynamic_cast<const smtk::graph::ResourceBase*>(&resource);
+      if (!graphResource)
+      {
+        return;
+      }
+      auto it = graphResource->nodesByType().find(value);
+      if (it != graphResource->nodesByType().end())
+      {
+        for (const auto& id : it->second)
+        {
+          visitor(id);
+        }
+      }
+    }
+
     std::string value;
   };
 
@@ -66,6 +101,49 @@ struct TypeName
       return std::regex_match(object.typeName(), std::regex(value));
     }
 
+    // The regex need only be matched against each distinct node type name.
+    bool estimateCandidates(
+      const smtk::resource::Resource& resource, std::size_t& count) const override
+    {
+      const auto* graphResource = dynamic_cast<const smtk::graph::ResourceBase*>(&resource);
+      if (!graphResource)
+      {
+        return false;
+      }
+      std::regex regex(value);
+      count = 0;
+      for (const auto& entry : graphResource->nodesByType())
+      {
+        if (std::regex_match(entry.first, regex))
+        {
+          count += entry.second.size();
+        }
+      }
+      return true;
+    }
+
+    void visitCandidates(
+      const smtk::resource::Resource& resource,
+      const std::function<void(const smtk::common::UUID&)>& visitor) const override
+    {
+      const auto* graphResource = dynamic_cast<const smtk::graph::ResourceBase*>(&resource);
+      if (!graphResource)
+      {
+        return;
+      }
+      std::regex regex(value);
+      for (const auto& entry : graphResource->nodesByType())
+      {
+        if (std::regex_match(entry.first, regex))
+        {
+          for (const auto& id : entry.second)
+          {
+            visitor(id);
+          }
+        }
+      }
+    }
+
     std::string value;
   };
 };
@@ -0,0 +1,119 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/graph/Component.h"
+#include "smtk/graph/Resource.h"
+#include "smtk/graph/arcs/Arc.h"
+#include "smtk/graph/arcs/Arcs.h"
+#include "smtk/graph/arcs/OrderedArcs.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+/// Exercise queries for incoming arcs, both with and without an inverse index,
+/// and verify which arcs attached to a node are removed with it.
+
+namespace test_incoming_arcs
+{
+class Node : public smtk::graph::Component
+{
+public:
+  template<typename... Args>
+  Node(Args&&... args)
+    : smtk::graph::Component::Component(std::forward<Args>(args)...)
+  {
+  }
+};
+
+class Parent : public smtk::graph::Arc<Node, Node>
+{
+public:
+  template<typename... Args>
+  Parent(Args&&... args)
+    : smtk::graph::Arc<Node, Node>::Arc(std::forward<Args>(args)...)
+  {
+  }
+};
+
+class Children : public smtk::graph::Arcs<Node, Node>
+{
+public:
+  using smtk::graph::Arcs<Node, Node>::Arcs;
+};
+
+class Sequence : public smtk::graph::OrderedArcs<Node, Node>
+{
+public:
+  using smtk::graph::OrderedArcs<Node, Node>::OrderedArcs;
+};
+
+struct ScanTraits
+{
+  typedef std::tuple<Node> NodeTypes;
+  typedef std::tuple<Parent, Children, Sequence> ArcTypes;
+};
+
+struct IndexedTraits
+{
+  typedef std::tuple<Node> NodeTypes;
+  typedef std::tuple<Parent, Children, Sequence> ArcTypes;
+  typedef std::tuple<Parent, Children, Sequence> InverseIndexedArcTypes;
+};
+
+template<typename Traits>
+void testIncoming(bool indexed)
+{
+  auto resource = smtk::graph::Resource<Traits>::create();
+  test(
+    resource->arcs().template hasInverseIndex<Children>() == indexed,
+    "Unexpected inverse index state.");
+
+  std::shared_ptr<Node> root = resource->template create<Node>();
+  std::shared_ptr<Node> child1 = resource->template create<Node>();
+  std::shared_ptr<Node> child2 = resource->template create<Node>();
+
+  resource->template create<Parent>(*child1, *root);
+  resource->template create<Parent>(*child2, *root);
+  Children::API<Children>().connect(*root, *child1);
+  Children::API<Children>().connect(*root, *child2);
+  Sequence::API<Sequence>().connect(*child1, *child2);
+  Sequence::API<Sequence>().connect(*child1, *child2);
+
+  test(root->incoming<Parent>().size() == 2, "Expected two nodes whose parent is root.");
+  test(child1->incoming<Children>().size() == 1, "Expected one node with child1 as a child.");
+  test(
+    child1->incoming<Children>()[0].get().id() == root->id(),
+    "Expected root to have child1 as a child.");
+  test(child2->incoming<Sequence>().size() == 1, "Expected one sequence to hold child2.");
+  test(child1->incoming<Sequence>().empty(), "Expected no sequence to hold child1.");
+
+  // Removing one of two duplicate ordered arcs should leave the other intact.
+  test(Sequence::API<Sequence>().disconnect(*child1, *child2), "Could not disconnect arc.");
+  test(child2->incoming<Sequence>().size() == 1, "Expected one sequence to hold child2.");
+  test(Sequence::API<Sequence>().disconnect(*child1, *child2), "Could not disconnect arc.");
+  test(child2->incoming<Sequence>().empty(), "Expected no sequence to hold child2.");
+
+  // Removing a node removes the arcs that originate at it and, for indexed
+  // arc types, the arcs that terminate at it.
+  test(resource->remove(child1), "Could not remove child1.");
+  test(
+    root->get<Children>().size() == (indexed ? 1 : 2),
+    "Unexpected arcs from root after removing child1.");
+  test(root->incoming<Parent>().size() == 1, "Expected removal to remove child1's parent arc.");
+
+  test(resource->remove(root), "Could not remove root.");
+  test(child2->contains<Parent>() == !indexed, "Unexpected parent arc after removing root.");
+}
+} // namespace test_incoming_arcs
+
+int TestIncomingArcs(int, char*[])
+{
+  test_incoming_arcs::testIncoming<test_incoming_arcs::ScanTraits>(false);
+  test_incoming_arcs::testIncoming<test_incoming_arcs::IndexedTraits>(true);
+  return 0;
+}
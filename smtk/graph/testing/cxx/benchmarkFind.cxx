@@ -0,0 +1,99 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/graph/Component.h"
+#include "smtk/graph/Resource.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/// Measure the throughput of smtk::graph::ResourceBase::find() for resources
+/// holding 10^4 to 10^N nodes (N defaults to 7 and may be passed as the first
+/// argument).
+
+namespace benchmark_find
+{
+class Node : public smtk::graph::Component
+{
+public:
+  template<typename... Args>
+  Node(Args&&... args)
+    : smtk::graph::Component::Component(std::forward<Args>(args)...)
+  {
+  }
+};
+
+struct Traits
+{
+  typedef std::tuple<benchmark_find::Node> NodeTypes;
+  typedef std::tuple<> ArcTypes;
+};
+
+double elapsed(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace benchmark_find
+
+int main(int argc, char* argv[])
+{
+  int maxExponent = argc > 1 ? std::atoi(argv[1]) : 7;
+  const std::size_t numLookups = 2000000;
+
+  std::size_t numNodes = 1000;
+  for (int exponent = 4; exponent <= maxExponent; ++exponent)
+  {
+    numNodes *= 10;
+
+    auto resource = smtk::graph::Resource<benchmark_find::Traits>::create();
+    std::vector<smtk::common::UUID> ids;
+    ids.reserve(numNodes);
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t ii = 0; ii < numNodes; ++ii)
+    {
+      ids.push_back(resource->create<benchmark_find::Node>()->id());
+    }
+    double deltaT = benchmark_find::elapsed(start);
+    std::cout << numNodes << " nodes created in " << deltaT << " seconds\n";
+
+    // #### Hits
+    std::size_t found = 0;
+    start = std::chrono::steady_clock::now();
+    for (std::size_t ii = 0; ii < numLookups; ++ii)
+    {
+      found += resource->find(ids[(ii * 7919) % numNodes]) ? 1 : 0;
+    }
+    deltaT = benchmark_find::elapsed(start);
+    std::cout << "  " << numLookups << " good lookups " << deltaT << " seconds "
+              << (numLookups / deltaT) << " lookups/sec\n";
+
+    // #### Misses
+    smtk::common::UUID nil;
+    start = std::chrono::steady_clock::now();
+    for (std::size_t ii = 0; ii < numLookups; ++ii)
+    {
+      found += resource->find(nil) ? 1 : 0;
+      (*nil.begin())++; // twiddling bits should still result in a missing UUID.
+    }
+    deltaT = benchmark_find::elapsed(start);
+    std::cout << "  " << numLookups << " missed lookups " << deltaT << " seconds "
+              << (numLookups / deltaT) << " lookups/sec\n";
+
+    if (found != numLookups)
+    {
+      std::cerr << "Expected " << numLookups << " nodes to be found, got " << found << "\n";
+      return 1;
+    }
+  }
+
+  return 0;
+}
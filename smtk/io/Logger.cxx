@@ -35,9 +35,30 @@ Logger::~Logger()
 
 Logger& Logger::operator=(const Logger& logger)
 {
+  if (&logger == this)
+  {
+    return *this;
+  }
+
+  std::deque<Record> records;
+  bool hasErrors;
+  std::size_t capacity;
+  Severity minimumSeverity;
+  {
+    std::lock_guard<std::mutex> lock(logger.m_mutex);
+    records = logger.m_records;
+    hasErrors = logger.m_hasErrors;
+    capacity = logger.m_capacity;
+    minimumSeverity = logger.m_minimumSeverity;
+  }
+
   std::lock_guard<std::mutex> lock(m_mutex);
-  m_records = logger.m_records;
-  m_hasErrors = logger.m_hasErrors;
+  m_discarded += m_records.size();
+  m_records = std::move(records);
+  m_hasErrors = hasErrors;
+  m_capacity = capacity;
+  m_minimumSeverity = minimumSeverity;
+  this->discardExcessRecords();
   return *this;
 }
 
@@ -47,14 +68,24 @@ void Logger::addRecord(
   const std::string& fname,
   unsigned int line)
 {
+  if (!this->accepts(s))
+  {
+    return;
+  }
+
+  // Construct the record before acquiring the lock so that concurrent writers
+  // only contend for the insertion itself.
+  Record record(s, m, fname, line);
+
   std::lock_guard<std::mutex> lock(m_mutex);
   if ((s == Logger::ERROR) || (s == Logger::FATAL))
   {
     m_hasErrors = true;
   }
-  m_records.emplace_back(s, m, fname, line);
+  m_records.push_back(std::move(record));
   std::size_t nr = this->numberOfRecords();
   this->flushRecordsToStream(nr - 1, nr);
+  this->discardExcessRecords();
 }
 
 void Logger::append(const Logger& l)
@@ -65,27 +96,31 @@ void Logger::append(const Logger& l)
     return;
   }
 
+  std::vector<Record> records = l.records();
+
   std::lock_guard<std::mutex> lock(m_mutex);
-  m_records.insert(m_records.end(), l.m_records.begin(), l.m_records.end());
+  m_records.insert(m_records.end(), records.begin(), records.end());
   if (l.m_hasErrors)
   {
     m_hasErrors = true;
   }
   std::size_t nr = this->numberOfRecords();
-  this->flushRecordsToStream(nr - l.numberOfRecords(), nr);
+  this->flushRecordsToStream(nr - records.size(), nr);
+  this->discardExcessRecords();
 }
 
 void Logger::reset()
 {
   std::lock_guard<std::mutex> lock(m_mutex);
   m_hasErrors = false;
+  m_discarded += m_records.size();
   m_records.clear();
 }
 
 std::vector<Logger::Record> Logger::records() const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
-  return m_records;
+  return std::vector<Record>(m_records.begin(), m_records.end());
 }
 
 Logger::Record Logger::record(std::size_t i) const
@@ -94,6 +129,41 @@ Logger::Record Logger::record(std::size_t i) const
   return m_records[i];
 }
 
+Logger::Cursor Logger::cursor() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_discarded + m_records.size();
+}
+
+std::vector<Logger::Record> Logger::recordsSince(Cursor cursor) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::size_t begin = cursor > m_discarded ? cursor - m_discarded : 0;
+  if (begin >= m_records.size())
+  {
+    return std::vector<Record>();
+  }
+  return std::vector<Record>(
+    m_records.begin() + static_cast<std::ptrdiff_t>(begin), m_records.end());
+}
+
+void Logger::setCapacity(std::size_t capacity)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_capacity = capacity;
+  this->discardExcessRecords();
+}
+
+/// Discard the oldest records until no more than the logger's capacity remain.
+void Logger::discardExcessRecords()
+{
+  while (m_capacity > 0 && m_records.size() > m_capacity)
+  {
+    m_records.pop_front();
+    ++m_discarded;
+  }
+}
+
 std::string Logger::severityAsString(Severity s)
 {
   switch (s)
@@ -191,12 +261,13 @@ std::string Logger::toHTML(std::size_t i, std::size_t j, bool includeSourceLoc)
 
 std::string Logger::convertToString(bool includeSourceLoc) const
 {
-  return this->toString(0, m_records.size(), includeSourceLoc);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return this->toStringInternal(0, m_records.size(), includeSourceLoc);
 }
 
 std::string Logger::convertToHTML(bool includeSourceLog) const
 {
-  return this->toHTML(0, m_records.size(), includeSourceLog);
+  return this->toHTML(0, this->numberOfRecords(), includeSourceLog);
 }
 
 /**\brief Request all records be flushed to \a output as they are logged.
@@ -13,6 +13,8 @@
 
 #include "smtk/CoreExports.h"
 #include "smtk/SystemConfig.h"
+#include <atomic>
+#include <deque>
 #include <functional>
 #include <iosfwd>
 #include <mutex>
@@ -37,9 +39,12 @@
 #define smtkErrorMacro(logger, x)                                                                  \
   do                                                                                               \
   {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                              \
-    (logger).addRecord(smtk::io::Logger::ERROR, s1.str(), __FILE__, __LINE__);                     \
+    if ((logger).accepts(smtk::io::Logger::ERROR))                                                 \
+    {                                                                                              \
+      std::stringstream s1;                                                                        \
+      s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                            \
+      (logger).addRecord(smtk::io::Logger::ERROR, s1.str(), __FILE__, __LINE__);                   \
+    }                                                                                              \
   } while (0)
 
 /**\brief Write the expression \a x to \a logger as a warning message.
@@ -49,9 +54,12 @@
 #define smtkWarningMacro(logger, x)                                                                \
   do                                                                                               \
   {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                              \
-    (logger).addRecord(smtk::io::Logger::WARNING, s1.str(), __FILE__, __LINE__);                   \
+    if ((logger).accepts(smtk::io::Logger::WARNING))                                               \
+    {                                                                                              \
+      std::stringstream s1;                                                                        \
+      s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                            \
+      (logger).addRecord(smtk::io::Logger::WARNING, s1.str(), __FILE__, __LINE__);                 \
+    }                                                                                              \
   } while (0)
 
 /**\brief Write the expression \a x to \a logger as a debug message.
@@ -61,9 +69,12 @@
 #define smtkDebugMacro(logger, x)                                                                  \
   do                                                                                               \
   {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                              \
-    (logger).addRecord(smtk::io::Logger::DEBUG, s1.str(), __FILE__, __LINE__);                     \
+    if ((logger).accepts(smtk::io::Logger::DEBUG))                                                 \
+    {                                                                                              \
+      std::stringstream s1;                                                                        \
+      s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                            \
+      (logger).addRecord(smtk::io::Logger::DEBUG, s1.str(), __FILE__, __LINE__);                   \
+    }                                                                                              \
   } while (0)
 
 /**\brief Write the expression \a x to \a logger as an informational message.
@@ -76,9 +87,12 @@
 #define smtkInfoMacro(logger, x)                                                                   \
   do                                                                                               \
   {                                                                                                \
-    std::stringstream s1;                                                                          \
-    s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                              \
-    (logger).addRecord(smtk::io::Logger::INFO, s1.str());                                          \
+    if ((logger).accepts(smtk::io::Logger::INFO))                                                  \
+    {                                                                                              \
+      std::stringstream s1;                                                                        \
+      s1 << x; /* NOLINT(bugprone-macro-parentheses) */                                            \
+      (logger).addRecord(smtk::io::Logger::INFO, s1.str());                                        \
+    }                                                                                              \
   } while (0)
 
 namespace smtk
@@ -90,6 +104,14 @@ namespace io
  *
  * Logger has a singleton interface to a global logger, but is also
  * constructible as a non-singleton object.
+ *
+ * By default, a logger retains every record added to it. Long-running
+ * processes may bound the number of retained records with setCapacity(), in
+ * which case the oldest records are discarded as new ones arrive, and may
+ * discard low-severity records before they are formatted with
+ * setMinimumSeverity(). Records are numbered in the order they are added; a
+ * Cursor marks a position in that sequence so that the records added after it
+ * may be retrieved without copying the entire log.
  */
 class SMTKCORE_EXPORT Logger
 {
@@ -121,12 +143,18 @@ public:
     Record() = default;
   };
 
+  /// A position in the sequence of records added to a logger.
+  typedef std::size_t Cursor;
+
   Logger() = default;
 
   Logger(const Logger& logger)
-    : m_hasErrors(logger.m_hasErrors)
-    , m_records(logger.m_records)
   {
+    std::lock_guard<std::mutex> lock(logger.m_mutex);
+    m_hasErrors = logger.m_hasErrors;
+    m_records = logger.m_records;
+    m_capacity = logger.m_capacity;
+    m_minimumSeverity = logger.m_minimumSeverity.load();
   }
 
   virtual ~Logger();
@@ -148,6 +176,31 @@ public:
   ///\brief Return a copy of the ith record in the logger
   Record record(std::size_t i) const;
 
+  ///\brief Return a cursor positioned after the most recently added record.
+  Cursor cursor() const;
+  ///\brief Return a copy of the retained records added at or after \a cursor.
+  std::vector<Record> recordsSince(Cursor cursor) const;
+
+  ///\brief Limit the number of records the logger retains.
+  ///
+  /// Once \a capacity records are held, the oldest record is discarded for
+  /// each new one. A capacity of 0 (the default) retains every record.
+  void setCapacity(std::size_t capacity);
+  std::size_t capacity() const { return m_capacity; }
+
+  ///\brief Discard records less severe than \a severity.
+  ///
+  /// The logging macros test accepts() before formatting their message, so
+  /// discarded records cost nothing to produce. Errors are always recorded.
+  void setMinimumSeverity(Severity severity) { m_minimumSeverity = severity; }
+  Severity minimumSeverity() const { return m_minimumSeverity; }
+
+  ///\brief Return true if records of severity \a s are retained.
+  bool accepts(Severity s) const
+  {
+    return s >= ERROR || s >= m_minimumSeverity.load(std::memory_order_relaxed);
+  }
+
   static std::string toString(const Record& record, bool includeSourceLoc = false);
   std::string toString(std::size_t i, bool includeSourceLoc = false) const;
   std::string toString(std::size_t i, std::size_t j, bool includeSourceLoc = false) const;
@@ -173,9 +226,13 @@ public:
 protected:
   void flushRecordsToStream(std::size_t beginRec, std::size_t endRec);
   std::string toStringInternal(std::size_t i, std::size_t j, bool includeSourceLoc = false) const;
+  void discardExcessRecords();
 
   bool m_hasErrors{ false };
-  std::vector<Record> m_records;
+  std::deque<Record> m_records;
+  std::size_t m_capacity{ 0 };
+  std::size_t m_discarded{ 0 };
+  std::atomic<Severity> m_minimumSeverity{ DEBUG };
   std::ostream* m_stream{ nullptr };
   bool m_ownStream{ false };
   std::function<void()> m_callback;
@@ -30,6 +30,13 @@ inline PySharedPtrClass< smtk::io::Logger > pybind11_init_smtk_io_Logger(py::mod
     .def("clearErrors", &smtk::io::Logger::clearErrors)
     .def("addRecord", &smtk::io::Logger::addRecord, py::arg("s"), py::arg("m"), py::arg("fname") = "", py::arg("line") = 0)
     .def("record", &smtk::io::Logger::record, py::arg("i"))
+    .def("cursor", &smtk::io::Logger::cursor)
+    .def("recordsSince", &smtk::io::Logger::recordsSince, py::arg("cursor"))
+    .def("setCapacity", &smtk::io::Logger::setCapacity, py::arg("capacity"))
+    .def("capacity", &smtk::io::Logger::capacity)
+    .def("setMinimumSeverity", &smtk::io::Logger::setMinimumSeverity, py::arg("severity"))
+    .def("minimumSeverity", &smtk::io::Logger::minimumSeverity)
+    .def("accepts", &smtk::io::Logger::accepts, py::arg("s"))
     .def("toString", (std::string (smtk::io::Logger::*)(::size_t, bool) const) &smtk::io::Logger::toString, py::arg("i"), py::arg("includeSourceLoc") = false)
     .def("toString", (std::string (smtk::io::Logger::*)(::size_t, ::size_t, bool) const) &smtk::io::Logger::toString, py::arg("i"), py::arg("j"), py::arg("includeSourceLoc") = false)
     .def("toHTML", &smtk::io::Logger::toHTML, py::arg("i"), py::arg("j"), py::arg("includeSourceLoc"))
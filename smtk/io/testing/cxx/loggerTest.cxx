@@ -38,5 +38,55 @@ int main()
               << "\n\tMessage = " << r.message << "\tFile = " << r.fileName
               << "\n\tLine = " << r.lineNumber << std::endl;
   }
+
+  // Test a bounded logger with a cursor.
+  smtk::io::Logger bounded;
+  bounded.setCapacity(3);
+  bounded.setMinimumSeverity(smtk::io::Logger::WARNING);
+  smtkInfoMacro(bounded, "this is discarded");
+  smtkDebugMacro(bounded, "this is discarded");
+  smtkWarningMacro(bounded, "first");
+  smtk::io::Logger::Cursor cursor = bounded.cursor();
+  for (i = 0; i < 4; i++)
+  {
+    smtkErrorMacro(bounded, "error " << i);
+  }
+  if (bounded.numberOfRecords() != 3 || bounded.record(0).message != "error 1")
+  {
+    std::cerr << "Bounded logger retained the wrong records!\n";
+    return -1;
+  }
+  auto since = bounded.recordsSince(cursor);
+  if (since.size() != 3 || since.back().message != "error 3")
+  {
+    std::cerr << "Wrong records since cursor!  Got " << since.size() << " Should be 3!\n";
+    return -1;
+  }
+  cursor = bounded.cursor();
+  smtkErrorMacro(bounded, "last");
+  since = bounded.recordsSince(cursor);
+  if (since.size() != 1 || since[0].message != "last")
+  {
+    std::cerr << "Wrong records since cursor!  Got " << since.size() << " Should be 1!\n";
+    return -1;
+  }
+
+  // Assigned loggers keep the capacity and minimum severity of their source.
+  smtk::io::Logger assigned;
+  assigned = bounded;
+  if (
+    assigned.capacity() != 3 || assigned.minimumSeverity() != smtk::io::Logger::WARNING ||
+    assigned.numberOfRecords() != 3)
+  {
+    std::cerr << "Assigned logger does not match its source!\n";
+    return -1;
+  }
+  smtkInfoMacro(assigned, "this is discarded");
+  smtkErrorMacro(assigned, "after assignment");
+  if (assigned.numberOfRecords() != 3 || assigned.record(2).message != "after assignment")
+  {
+    std::cerr << "Assigned logger did not apply its source's settings!\n";
+    return -1;
+  }
   return 0;
 }
@@ -0,0 +1,104 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/mesh/core/CellAdjacency.h"
+
+#include "smtk/mesh/core/Interface.h"
+
+#include <algorithm>
+
+namespace smtk
+{
+namespace mesh
+{
+
+CellAdjacency::CellAdjacency(
+  const smtk::mesh::InterfacePtr& iface,
+  const smtk::mesh::HandleRange& cells)
+  : m_cells(cells)
+  , m_revision(iface->connectivityRevision())
+{
+  m_handles.assign(cells.elements_begin(), cells.elements_end());
+
+  m_offsets.reserve(m_handles.size() + 1);
+  m_offsets.push_back(0);
+  for (smtk::mesh::Handle cell : m_handles)
+  {
+    smtk::mesh::HandleRange neighbors = iface->neighbors(cell);
+    for (const auto& interval : neighbors)
+    {
+      // Walk the handles of each neighboring interval that lie in the range.
+      auto it = std::lower_bound(m_handles.begin(), m_handles.end(), interval.lower());
+      for (; it != m_handles.end() && *it <= interval.upper(); ++it)
+      {
+        m_neighbors.push_back(static_cast<std::size_t>(it - m_handles.begin()));
+      }
+    }
+    m_offsets.push_back(m_neighbors.size());
+  }
+}
+
+std::size_t CellAdjacency::index(smtk::mesh::Handle cell) const
+{
+  auto it = std::lower_bound(m_handles.begin(), m_handles.end(), cell);
+  return (it != m_handles.end() && *it == cell) ? static_cast<std::size_t>(it - m_handles.begin())
+                                                : m_handles.size();
+}
+
+smtk::mesh::HandleRange CellAdjacency::grow(
+  const smtk::mesh::HandleRange& seeds,
+  const Acceptor& accept) const
+{
+  smtk::mesh::HandleRange region = seeds;
+
+  std::vector<bool> inRegion(m_handles.size(), false);
+  std::vector<std::size_t> front;
+  for (auto i = seeds.elements_begin(); i != seeds.elements_end(); ++i)
+  {
+    std::size_t index = this->index(*i);
+    if (index != m_handles.size())
+    {
+      inRegion[index] = true;
+      front.push_back(index);
+    }
+  }
+
+  // Visit the region one layer at a time, collecting the cells that join it.
+  std::vector<std::size_t> added;
+  std::vector<std::size_t> next;
+  while (!front.empty())
+  {
+    next.clear();
+    for (std::size_t cell : front)
+    {
+      for (const std::size_t* n = this->neighborsBegin(cell); n != this->neighborsEnd(cell); ++n)
+      {
+        if (!inRegion[*n] && accept(cell, *n))
+        {
+          inRegion[*n] = true;
+          next.push_back(*n);
+        }
+      }
+    }
+    added.insert(added.end(), next.begin(), next.end());
+    front.swap(next);
+  }
+
+  // Insert the new cells in increasing order so the range is built by
+  // appending.
+  std::sort(added.begin(), added.end());
+  smtk::mesh::HandleRange grown;
+  for (std::size_t index : added)
+  {
+    grown.insert(m_handles[index]);
+  }
+  return region += grown;
+}
+} // namespace mesh
+} // namespace smtk
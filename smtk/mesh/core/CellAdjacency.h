@@ -0,0 +1,87 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_mesh_core_CellAdjacency_h
+#define smtk_mesh_core_CellAdjacency_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/mesh/core/Handle.h"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+
+//CellAdjacency holds the dimension-equivalent neighbors of each cell in a
+//range (as reported by Interface::neighbors()), restricted to that range, in
+//compressed sparse row form. Cells are addressed by their position in the
+//range so that traversals can use flat arrays rather than maps keyed by
+//handle.
+//
+//Building the adjacency queries the interface once per cell. Use
+//Resource::cellAdjacency() to share an adjacency between queries; it is
+//rebuilt when the interface's connectivity revision changes.
+class SMTKCORE_EXPORT CellAdjacency
+{
+public:
+  //called by grow() with the index of a cell in the region and the index of
+  //one of its neighbors that is not; return true to add the neighbor.
+  typedef std::function<bool(std::size_t, std::size_t)> Acceptor;
+
+  CellAdjacency(const smtk::mesh::InterfacePtr& iface, const smtk::mesh::HandleRange& cells);
+
+  const smtk::mesh::HandleRange& cells() const { return m_cells; }
+  std::size_t numberOfCells() const { return m_handles.size(); }
+
+  //the interface's connectivity revision when the adjacency was built
+  std::size_t revision() const { return m_revision; }
+
+  //the index of a cell, or numberOfCells() if it is not in the range
+  std::size_t index(smtk::mesh::Handle cell) const;
+  smtk::mesh::Handle handle(std::size_t index) const { return m_handles[index]; }
+
+  //the indices of the neighbors of the cell at <index>
+  const std::size_t* neighborsBegin(std::size_t index) const
+  {
+    return m_neighbors.data() + m_offsets[index];
+  }
+  const std::size_t* neighborsEnd(std::size_t index) const
+  {
+    return m_neighbors.data() + m_offsets[index + 1];
+  }
+  std::size_t numberOfNeighbors(std::size_t index) const
+  {
+    return m_offsets[index + 1] - m_offsets[index];
+  }
+
+  //grow a region breadth-first from <seeds>. Each time a cell joins the
+  //region, its neighbors outside of the region are offered to <accept>, and
+  //those it accepts join the region in turn. Seeds that are not in the range
+  //are part of the region but have no neighbors. Returns the region,
+  //including the seeds.
+  smtk::mesh::HandleRange grow(const smtk::mesh::HandleRange& seeds, const Acceptor& accept)
+    const;
+
+private:
+  smtk::mesh::HandleRange m_cells;
+  std::vector<smtk::mesh::Handle> m_handles;
+  std::vector<std::size_t> m_offsets;
+  std::vector<std::size_t> m_neighbors;
+  std::size_t m_revision;
+};
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -10,39 +10,386 @@
 
 #include "smtk/mesh/core/Handle.h"
 
+#include <algorithm>
+
 namespace smtk
 {
 namespace mesh
 {
 
+namespace
+{
+// Return true if <b> starts after <a> ends, leaving at least one handle
+// between them. Comparing with a difference avoids overflowing <upper> + 1.
+bool separated(Handle aUpper, Handle bLower)
+{
+  return bLower > aUpper && bLower - aUpper > 1;
+}
+
+std::size_t length(const HandleInterval& interval)
+{
+  return interval.upper() - interval.lower() + 1;
+}
+
+// Append <interval> to the end of <intervals>, joining it with the last
+// interval if they touch. <interval> must not start before the last interval.
+void append(std::vector<HandleInterval>& intervals, const HandleInterval& interval)
+{
+  if (!intervals.empty() && !separated(intervals.back().upper(), interval.lower()))
+  {
+    if (interval.upper() > intervals.back().upper())
+    {
+      intervals.back() = HandleInterval(intervals.back().lower(), interval.upper());
+    }
+  }
+  else
+  {
+    intervals.push_back(interval);
+  }
+}
+
+// Return the number of handles in <intervals>.
+std::size_t count(const std::vector<HandleInterval>& intervals)
+{
+  std::size_t size = 0;
+  for (const auto& interval : intervals)
+  {
+    size += length(interval);
+  }
+  return size;
+}
+} // namespace
+
+HandleRange::const_iterator HandleRange::find(Handle handle) const
+{
+  auto it = std::lower_bound(
+    m_intervals.begin(), m_intervals.end(), handle, [](const HandleInterval& interval, Handle h) {
+      return interval.upper() < h;
+    });
+  return (it != m_intervals.end() && it->lower() <= handle) ? it : m_intervals.end();
+}
+
+HandleRange::const_iterator HandleRange::find(const HandleInterval& interval) const
+{
+  auto it = std::lower_bound(
+    m_intervals.begin(),
+    m_intervals.end(),
+    interval.lower(),
+    [](const HandleInterval& existing, Handle h) { return existing.upper() < h; });
+  return (it != m_intervals.end() && it->lower() <= interval.upper()) ? it : m_intervals.end();
+}
+
+HandleRange& HandleRange::add(const HandleInterval& interval)
+{
+  this->add(m_intervals.end(), interval);
+  return *this;
+}
+
+HandleRange::const_iterator HandleRange::add(const_iterator prior, const HandleInterval& interval)
+{
+  if (interval.upper() < interval.lower())
+  {
+    return m_intervals.end();
+  }
+
+  // Appending in increasing order is the common case.
+  if (m_intervals.empty() || separated(m_intervals.back().upper(), interval.lower()))
+  {
+    m_intervals.push_back(interval);
+    m_size += length(interval);
+    return m_intervals.end() - 1;
+  }
+
+  // Find the first interval that is not separated from <interval> on the
+  // left, starting from the hint if it lies before <interval>.
+  auto before = [](const HandleInterval& existing, Handle lower) {
+    return separated(existing.upper(), lower);
+  };
+  auto begin = m_intervals.begin() + (prior - m_intervals.cbegin());
+  if (begin == m_intervals.end() || !before(*begin, interval.lower()))
+  {
+    begin = m_intervals.begin();
+  }
+  auto first = std::lower_bound(begin, m_intervals.end(), interval.lower(), before);
+
+  // Find the end of the run of intervals that are not separated from
+  // <interval> on the right.
+  auto last = first;
+  while (last != m_intervals.end() && !separated(interval.upper(), last->lower()))
+  {
+    ++last;
+  }
+
+  if (first == last)
+  {
+    m_size += length(interval);
+    return m_intervals.insert(first, interval);
+  }
+
+  Handle lower = std::min(interval.lower(), first->lower());
+  Handle upper = std::max(interval.upper(), (last - 1)->upper());
+  for (auto it = first; it != last; ++it)
+  {
+    m_size -= length(*it);
+  }
+  *first = HandleInterval(lower, upper);
+  m_size += length(*first);
+  auto offset = first - m_intervals.begin();
+  m_intervals.erase(first + 1, last);
+  return m_intervals.begin() + offset;
+}
+
+HandleRange& HandleRange::add(const HandleRange& range)
+{
+  if (range.empty())
+  {
+    return *this;
+  }
+  if (
+    m_intervals.empty() ||
+    separated(m_intervals.back().upper(), range.m_intervals.front().lower()))
+  {
+    m_intervals.insert(m_intervals.end(), range.m_intervals.begin(), range.m_intervals.end());
+    m_size += range.m_size;
+    return *this;
+  }
+  if (range.m_intervals.size() == 1)
+  {
+    return this->add(range.m_intervals.front());
+  }
+
+  // Merge the two sorted lists of intervals.
+  std::vector<HandleInterval> merged;
+  merged.reserve(m_intervals.size() + range.m_intervals.size());
+  auto i = m_intervals.cbegin();
+  auto j = range.m_intervals.cbegin();
+  while (i != m_intervals.cend() || j != range.m_intervals.cend())
+  {
+    if (j == range.m_intervals.cend() || (i != m_intervals.cend() && i->lower() < j->lower()))
+    {
+      append(merged, *i++);
+    }
+    else
+    {
+      append(merged, *j++);
+    }
+  }
+  m_intervals.swap(merged);
+  m_size = count(m_intervals);
+  return *this;
+}
+
+HandleRange& HandleRange::subtract(const HandleInterval& interval)
+{
+  if (interval.upper() < interval.lower() || m_intervals.empty())
+  {
+    return *this;
+  }
+
+  auto first = std::lower_bound(
+    m_intervals.begin(),
+    m_intervals.end(),
+    interval.lower(),
+    [](const HandleInterval& existing, Handle lower) { return existing.upper() < lower; });
+  if (first == m_intervals.end() || first->lower() > interval.upper())
+  {
+    return *this;
+  }
+
+  // A single interval that strictly contains <interval> is split in two.
+  if (first->lower() < interval.lower() && first->upper() > interval.upper())
+  {
+    HandleInterval right(interval.upper() + 1, first->upper());
+    *first = HandleInterval(first->lower(), interval.lower() - 1);
+    m_intervals.insert(first + 1, right);
+    m_size -= length(interval);
+    return *this;
+  }
+
+  auto last = first;
+  while (last != m_intervals.end() && last->lower() <= interval.upper())
+  {
+    m_size -= length(*last);
+    ++last;
+  }
+
+  // Keep the parts of the first and last intervals that lie outside of
+  // <interval>.
+  Handle firstLower = first->lower();
+  Handle lastUpper = (last - 1)->upper();
+  auto it = first;
+  if (firstLower < interval.lower())
+  {
+    *it++ = HandleInterval(firstLower, interval.lower() - 1);
+    m_size += interval.lower() - firstLower;
+  }
+  if (lastUpper > interval.upper())
+  {
+    *it++ = HandleInterval(interval.upper() + 1, lastUpper);
+    m_size += lastUpper - interval.upper();
+  }
+  m_intervals.erase(it, last);
+  return *this;
+}
+
+HandleRange& HandleRange::subtract(const HandleRange& range)
+{
+  if (range.empty() || m_intervals.empty())
+  {
+    return *this;
+  }
+  if (range.m_intervals.size() == 1)
+  {
+    return this->subtract(range.m_intervals.front());
+  }
+
+  std::vector<HandleInterval> difference;
+  difference.reserve(m_intervals.size() + range.m_intervals.size());
+  auto j = range.m_intervals.cbegin();
+  for (const auto& interval : m_intervals)
+  {
+    Handle lower = interval.lower();
+    bool remaining = true;
+    while (j != range.m_intervals.cend() && j->upper() < lower)
+    {
+      ++j;
+    }
+    for (auto k = j; remaining && k != range.m_intervals.cend() && k->lower() <= interval.upper();
+         ++k)
+    {
+      if (k->lower() > lower)
+      {
+        difference.emplace_back(lower, k->lower() - 1);
+      }
+      if (k->upper() >= interval.upper())
+      {
+        remaining = false;
+      }
+      else
+      {
+        lower = k->upper() + 1;
+      }
+    }
+    if (remaining)
+    {
+      difference.emplace_back(lower, interval.upper());
+    }
+  }
+  m_intervals.swap(difference);
+  m_size = count(m_intervals);
+  return *this;
+}
+
+HandleRange& HandleRange::intersect(const HandleRange& range)
+{
+  std::vector<HandleInterval> intersection;
+  auto i = m_intervals.cbegin();
+  auto j = range.m_intervals.cbegin();
+  while (i != m_intervals.cend() && j != range.m_intervals.cend())
+  {
+    Handle lower = std::max(i->lower(), j->lower());
+    Handle upper = std::min(i->upper(), j->upper());
+    if (lower <= upper)
+    {
+      intersection.emplace_back(lower, upper);
+    }
+    if (i->upper() < j->upper())
+    {
+      ++i;
+    }
+    else
+    {
+      ++j;
+    }
+  }
+  m_intervals.swap(intersection);
+  m_size = count(m_intervals);
+  return *this;
+}
+
+HandleRange& HandleRange::flip(const HandleRange& range)
+{
+  HandleRange common(*this);
+  common.intersect(range);
+  this->add(range);
+  return this->subtract(common);
+}
+
+bool HandleRange::operator==(const HandleRange& rhs) const
+{
+  return m_size == rhs.m_size && rangesEqual(*this, rhs);
+}
+
+bool HandleRange::operator<(const HandleRange& rhs) const
+{
+  return std::lexicographical_compare(
+    m_intervals.begin(),
+    m_intervals.end(),
+    rhs.m_intervals.begin(),
+    rhs.m_intervals.end(),
+    [](const HandleInterval& a, const HandleInterval& b) {
+      return a.lower() < b.lower() || (a.lower() == b.lower() && a.upper() < b.upper());
+    });
+}
+
 const_element_iterator rangeElementsBegin(const HandleRange& range)
 {
-  return boost::icl::elements_begin(range);
+  return range.elements_begin();
 }
 
 const_element_iterator rangeElementsEnd(const HandleRange& range)
 {
-  return boost::icl::elements_end(range);
+  return range.elements_end();
 }
 
 Handle rangeElement(const HandleRange& range, std::size_t i)
 {
-  return *std::next(boost::icl::elements_begin(range), i);
+  for (const auto& interval : range)
+  {
+    std::size_t n = length(interval);
+    if (i < n)
+    {
+      return interval.lower() + i;
+    }
+    i -= n;
+  }
+  return 0;
 }
 
 bool rangeContains(const HandleRange& range, Handle i)
 {
-  return boost::icl::contains(range, i);
+  return range.find(i) != range.end();
 }
 
 bool rangeContains(const HandleRange& range, const HandleInterval& i)
 {
-  return boost::icl::contains(range, i);
+  if (i.upper() < i.lower())
+  {
+    return true;
+  }
+  auto interval = range.find(i.lower());
+  return interval != range.end() && interval->upper() >= i.upper();
 }
 
 bool rangeContains(const HandleRange& super, const HandleRange& sub)
 {
-  return boost::icl::contains(super, sub);
+  if (sub.size() > super.size())
+  {
+    return false;
+  }
+  auto i = super.begin();
+  for (const auto& interval : sub)
+  {
+    while (i != super.end() && i->upper() < interval.lower())
+    {
+      ++i;
+    }
+    if (i == super.end() || i->lower() > interval.lower() || i->upper() < interval.upper())
+    {
+      return false;
+    }
+  }
+  return true;
 }
 
 std::size_t rangeIndex(const HandleRange& range, Handle i)
@@ -62,7 +409,7 @@ std::size_t rangeIndex(const HandleRange& range, Handle i)
 
 std::size_t rangeIntervalCount(const HandleRange& range)
 {
-  return boost::icl::interval_count(range);
+  return range.iterative_size();
 }
 
 bool rangesEqual(const HandleRange& lhs, const HandleRange& rhs)
@@ -83,6 +430,28 @@ bool rangesEqual(const HandleRange& lhs, const HandleRange& rhs)
   }
   return true;
 }
+
+bool rangesIntersect(const HandleRange& lhs, const HandleRange& rhs)
+{
+  auto i = lhs.begin();
+  auto j = rhs.begin();
+  while (i != lhs.end() && j != rhs.end())
+  {
+    if (i->upper() < j->lower())
+    {
+      ++i;
+    }
+    else if (j->upper() < i->lower())
+    {
+      ++j;
+    }
+    else
+    {
+      return true;
+    }
+  }
+  return false;
+}
 } // namespace mesh
 } // namespace smtk
 
@@ -16,11 +16,14 @@
 #include "smtk/common/CompilerInformation.h"
 
 SMTK_THIRDPARTY_PRE_INCLUDE
-#include <boost/icl/interval_set.hpp>
+#include <boost/icl/closed_interval.hpp>
 SMTK_THIRDPARTY_POST_INCLUDE
 
+#include <cstddef>
 #include <functional>
+#include <iterator>
 #include <ostream>
+#include <vector>
 
 namespace smtk
 {
@@ -34,18 +37,276 @@ typedef std::size_t Handle;
 // TODO: use extern template declaration to prevent consuming libraries from
 // generating these template specializations.
 template class SMTKCORE_EXPORT boost::icl::closed_interval<smtk::mesh::Handle>;
-template class SMTKCORE_EXPORT boost::icl::
-  interval_set<smtk::mesh::Handle, std::less, boost::icl::closed_interval<smtk::mesh::Handle>>;
 
 namespace smtk
 {
 namespace mesh
 {
 typedef boost::icl::closed_interval<Handle> HandleInterval;
-typedef boost::icl::interval_set<Handle, std::less, HandleInterval> HandleRange;
 
-typedef decltype(
-  boost::icl::elements_begin(std::declval<const HandleRange>())) const_element_iterator;
+/// A set of handles, held as a sorted vector of disjoint closed intervals.
+///
+/// Adjacent intervals are always joined, so each interval is separated from
+/// the next by at least one handle. The interface follows that of
+/// boost::icl::interval_set (which HandleRange used to be): iteration visits
+/// intervals, size() is the number of handles and iterative_size() is the
+/// number of intervals. Set operations between ranges are linear merges,
+/// size() is constant-time and inserting intervals in increasing order
+/// appends to the vector.
+class SMTKCORE_EXPORT HandleRange
+{
+public:
+  typedef Handle domain_type;
+  typedef Handle element_type;
+  typedef HandleInterval interval_type;
+  typedef HandleInterval segment_type;
+  typedef HandleInterval value_type;
+  typedef std::size_t size_type;
+  typedef std::vector<HandleInterval>::const_iterator const_iterator;
+  typedef const_iterator iterator;
+  typedef std::vector<HandleInterval>::const_reverse_iterator const_reverse_iterator;
+  typedef const_reverse_iterator reverse_iterator;
+
+  /// Iterate over the individual handles of a range without allocating.
+  class SMTKCORE_EXPORT element_const_iterator
+  {
+  public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef Handle value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const Handle* pointer;
+    typedef const Handle& reference;
+
+    element_const_iterator() = default;
+    element_const_iterator(const_iterator interval, const_iterator end)
+      : m_interval(interval)
+      , m_end(end)
+      , m_handle(interval == end ? 0 : interval->lower())
+    {
+    }
+
+    reference operator*() const { return m_handle; }
+    pointer operator->() const { return &m_handle; }
+
+    element_const_iterator& operator++()
+    {
+      if (m_handle == m_interval->upper())
+      {
+        ++m_interval;
+        m_handle = m_interval == m_end ? 0 : m_interval->lower();
+      }
+      else
+      {
+        ++m_handle;
+      }
+      return *this;
+    }
+
+    element_const_iterator operator++(int)
+    {
+      element_const_iterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+
+    element_const_iterator& operator--()
+    {
+      if (m_interval == m_end || m_handle == m_interval->lower())
+      {
+        --m_interval;
+        m_handle = m_interval->upper();
+      }
+      else
+      {
+        --m_handle;
+      }
+      return *this;
+    }
+
+    element_const_iterator operator--(int)
+    {
+      element_const_iterator tmp(*this);
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const element_const_iterator& rhs) const
+    {
+      return m_interval == rhs.m_interval && m_handle == rhs.m_handle;
+    }
+    bool operator!=(const element_const_iterator& rhs) const { return !(*this == rhs); }
+
+  private:
+    const_iterator m_interval;
+    const_iterator m_end;
+    Handle m_handle{ 0 };
+  };
+
+  HandleRange() = default;
+  explicit HandleRange(Handle handle) { this->add(handle); }
+  explicit HandleRange(const HandleInterval& interval) { this->add(interval); }
+  HandleRange(const HandleRange&) = default;
+  HandleRange(HandleRange&&) = default;
+
+  HandleRange& operator=(HandleRange other)
+  {
+    this->swap(other);
+    return *this;
+  }
+
+  const_iterator begin() const { return m_intervals.begin(); }
+  const_iterator end() const { return m_intervals.end(); }
+  const_reverse_iterator rbegin() const { return m_intervals.rbegin(); }
+  const_reverse_iterator rend() const { return m_intervals.rend(); }
+
+  element_const_iterator elements_begin() const
+  {
+    return element_const_iterator(m_intervals.begin(), m_intervals.end());
+  }
+  element_const_iterator elements_end() const
+  {
+    return element_const_iterator(m_intervals.end(), m_intervals.end());
+  }
+
+  /// The number of handles in the range.
+  std::size_t size() const { return m_size; }
+  /// The number of intervals in the range.
+  std::size_t iterative_size() const { return m_intervals.size(); }
+  bool empty() const { return m_intervals.empty(); }
+
+  void clear()
+  {
+    m_intervals.clear();
+    m_size = 0;
+  }
+
+  void swap(HandleRange& other)
+  {
+    m_intervals.swap(other.m_intervals);
+    std::swap(m_size, other.m_size);
+  }
+
+  /// Reserve storage for \a numberOfIntervals intervals.
+  void reserve(std::size_t numberOfIntervals) { m_intervals.reserve(numberOfIntervals); }
+
+  /// Return the interval containing \a handle, or end() if there is none.
+  const_iterator find(Handle handle) const;
+  /// Return the first interval that overlaps \a interval, or end() if there
+  /// is none.
+  const_iterator find(const HandleInterval& interval) const;
+
+  ///@{
+  /// Add handles to the range.
+  HandleRange& add(Handle handle) { return this->add(HandleInterval(handle, handle)); }
+  HandleRange& add(const HandleInterval& interval);
+  HandleRange& add(const HandleRange& range);
+  /// Add an interval, using \a prior as a hint to where it belongs. Returns
+  /// the interval that contains it.
+  const_iterator add(const_iterator prior, const HandleInterval& interval);
+
+  HandleRange& insert(Handle handle) { return this->add(handle); }
+  HandleRange& insert(const HandleInterval& interval) { return this->add(interval); }
+  HandleRange& insert(const HandleRange& range) { return this->add(range); }
+  const_iterator insert(const_iterator prior, const HandleInterval& interval)
+  {
+    return this->add(prior, interval);
+  }
+  ///@}
+
+  ///@{
+  /// Remove handles from the range.
+  HandleRange& subtract(Handle handle) { return this->subtract(HandleInterval(handle, handle)); }
+  HandleRange& subtract(const HandleInterval& interval);
+  HandleRange& subtract(const HandleRange& range);
+
+  HandleRange& erase(Handle handle) { return this->subtract(handle); }
+  HandleRange& erase(const HandleInterval& interval) { return this->subtract(interval); }
+  HandleRange& erase(const HandleRange& range) { return this->subtract(range); }
+  ///@}
+
+  /// Keep only the handles that are also in \a range.
+  HandleRange& intersect(const HandleRange& range);
+  /// Keep the handles that are in exactly one of this range and \a range.
+  HandleRange& flip(const HandleRange& range);
+
+  template<typename T>
+  HandleRange& operator+=(const T& rhs)
+  {
+    return this->add(rhs);
+  }
+  template<typename T>
+  HandleRange& operator|=(const T& rhs)
+  {
+    return this->add(rhs);
+  }
+  template<typename T>
+  HandleRange& operator-=(const T& rhs)
+  {
+    return this->subtract(rhs);
+  }
+  template<typename T>
+  HandleRange& operator&=(const T& rhs)
+  {
+    return this->intersect(HandleRange(rhs));
+  }
+  template<typename T>
+  HandleRange& operator^=(const T& rhs)
+  {
+    return this->flip(HandleRange(rhs));
+  }
+
+  bool operator==(const HandleRange& rhs) const;
+  bool operator!=(const HandleRange& rhs) const { return !(*this == rhs); }
+  bool operator<(const HandleRange& rhs) const;
+
+private:
+  std::vector<HandleInterval> m_intervals;
+  std::size_t m_size{ 0 };
+};
+
+template<>
+inline HandleRange& HandleRange::operator&=(const HandleRange& rhs)
+{
+  return this->intersect(rhs);
+}
+
+template<>
+inline HandleRange& HandleRange::operator^=(const HandleRange& rhs)
+{
+  return this->flip(rhs);
+}
+
+template<typename T>
+HandleRange operator+(HandleRange lhs, const T& rhs)
+{
+  return lhs += rhs;
+}
+
+template<typename T>
+HandleRange operator|(HandleRange lhs, const T& rhs)
+{
+  return lhs |= rhs;
+}
+
+template<typename T>
+HandleRange operator-(HandleRange lhs, const T& rhs)
+{
+  return lhs -= rhs;
+}
+
+template<typename T>
+HandleRange operator&(HandleRange lhs, const T& rhs)
+{
+  return lhs &= rhs;
+}
+
+template<typename T>
+HandleRange operator^(HandleRange lhs, const T& rhs)
+{
+  return lhs ^= rhs;
+}
+
+typedef HandleRange::element_const_iterator const_element_iterator;
 
 /// Return an iterator to the first element in the range
 SMTKCORE_EXPORT const_element_iterator rangeElementsBegin(const HandleRange&);
@@ -74,6 +335,9 @@ SMTKCORE_EXPORT std::size_t rangeIntervalCount(const HandleRange&);
 
 /// Determine whether two ranges are equal
 SMTKCORE_EXPORT bool rangesEqual(const HandleRange&, const HandleRange&);
+
+/// Return true if the two ranges have at least one handle in common
+SMTKCORE_EXPORT bool rangesIntersect(const HandleRange&, const HandleRange&);
 } // namespace mesh
 } // namespace smtk
 
@@ -412,6 +412,12 @@ public:
   //given a handle to a cell, return its dimension-equivalent neighbors.
   virtual smtk::mesh::HandleRange neighbors(const smtk::mesh::Handle& cell) const = 0;
 
+  //returns a counter that changes whenever existing cells are removed or
+  //have their connectivity changed. It may also change for other edits.
+  //Structures derived from the connectivity, like smtk::mesh::CellAdjacency,
+  //compare it to the value they were built with to detect that they are stale.
+  virtual std::size_t connectivityRevision() const = 0;
+
   // Note: Will mark the interface as modified when successful
   virtual bool setDomain(const smtk::mesh::HandleRange& meshsets, const smtk::mesh::Domain& domain)
     const = 0;
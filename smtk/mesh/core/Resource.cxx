@@ -10,6 +10,7 @@
 
 #include "smtk/mesh/core/Resource.h"
 
+#include "smtk/mesh/core/CellAdjacency.h"
 #include "smtk/mesh/core/Component.h"
 
 #include "smtk/mesh/core/queries/BoundingBox.h"
@@ -19,6 +20,8 @@
 #include "smtk/common/UUIDGenerator.h"
 #include "smtk/model/EntityIterator.h"
 
+#include <mutex>
+
 namespace smtk
 {
 namespace mesh
@@ -43,6 +46,11 @@ public:
 
   smtk::mesh::Handle mesh_root_handle() const { return this->Interface->getRoot(); }
 
+  // The cell adjacency is derived from this interface, so it is kept (and
+  // swapped) alongside it.
+  std::mutex AdjacencyMutex;
+  std::shared_ptr<const smtk::mesh::CellAdjacency> Adjacency;
+
 private:
   smtk::mesh::InterfacePtr Interface;
 };
@@ -138,6 +146,21 @@ const smtk::mesh::InterfacePtr& Resource::interface() const
   return m_internals->mesh_iface();
 }
 
+std::shared_ptr<const smtk::mesh::CellAdjacency> Resource::cellAdjacency(
+  const smtk::mesh::CellSet& cells) const
+{
+  const smtk::mesh::InterfacePtr& iface = m_internals->mesh_iface();
+  std::lock_guard<std::mutex> guard(m_internals->AdjacencyMutex);
+  auto& adjacency = m_internals->Adjacency;
+  if (
+    !adjacency || adjacency->revision() != iface->connectivityRevision() ||
+    adjacency->cells() != cells.range())
+  {
+    adjacency = std::make_shared<smtk::mesh::CellAdjacency>(iface, cells.range());
+  }
+  return adjacency;
+}
+
 void Resource::swapInterfaces(smtk::mesh::ResourcePtr& other)
 {
   smtk::mesh::Resource::InternalImpl* temp = other->m_internals;
@@ -50,6 +50,7 @@ class EntityIterator;
 }
 namespace mesh
 {
+class CellAdjacency;
 
 //Flyweight interface around a moab database of meshes.
 class SMTKCORE_EXPORT Resource
@@ -305,6 +306,13 @@ public:
 
   const smtk::mesh::InterfacePtr& interface() const;
 
+  //return the dimension-equivalent neighbors of the given cells, restricted
+  //to those cells. The most recently built adjacency is cached and returned
+  //again while it covers the same cells and the interface's connectivity
+  //revision is unchanged.
+  std::shared_ptr<const smtk::mesh::CellAdjacency> cellAdjacency(
+    const smtk::mesh::CellSet& cells) const;
+
   void setModelResource(smtk::model::ResourcePtr resource) { m_modelResource = resource; }
   smtk::model::ResourcePtr modelResource() const { return m_modelResource.lock(); }
 
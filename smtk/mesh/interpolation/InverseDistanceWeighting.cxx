@@ -13,120 +13,489 @@
 #include "smtk/mesh/interpolation/PointCloud.h"
 #include "smtk/mesh/interpolation/StructuredGrid.h"
 
+#include "smtk/common/ThreadPool.h"
+
+#include <algorithm>
 #include <cmath>
+#include <future>
+#include <limits>
+#include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace
 {
 // We use inverse distance weighting via Shepard's method, implmented below.
 const double EPSILON = 1.e-10;
 
-double euclideanDistance(const std::array<double, 3>& p1, const std::array<double, 3>& p2)
+// The number of points evaluated by each task of a batched evaluation.
+const std::size_t BlockSize = 1024;
+
+// Scratch space used to evaluate a single point. It is reused across points
+// to avoid allocating memory for each evaluation.
+struct Scratch
+{
+  std::vector<double> sqDistances;
+  std::vector<double> values;
+  std::vector<std::pair<double, double>> heap;
+};
+
+// Return the weighted average of <values> using the inverse of their
+// distances (given here squared) raised to <power>. The weights are computed
+// in a single pass over contiguous arrays so the loop can be vectorized.
+double shepard(const double* sqDistances, const double* values, std::size_t n, double power)
 {
-  std::array<double, 3> diff = { { p1[0] - p2[0], p1[1] - p2[1], p1[2] - p2[2] } };
-  return std::sqrt(diff[0] * diff[0] + diff[1] * diff[1] + diff[2] * diff[2]);
+  if (n == 0)
+  {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+
+  // If a distance is zero, then return the value associated with the source.
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    if (sqDistances[i] < EPSILON * EPSILON)
+    {
+      return values[i];
+    }
+  }
+
+  // Otherwise, sum the contribution from each source. d^-p is computed as
+  // (d^2)^(-p/2), avoiding a square root for the common powers.
+  double num = 0., denom = 0.;
+  if (power == 2.)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      double w = 1. / sqDistances[i];
+      num += w * values[i];
+      denom += w;
+    }
+  }
+  else if (power == 1.)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      double w = 1. / std::sqrt(sqDistances[i]);
+      num += w * values[i];
+      denom += w;
+    }
+  }
+  else
+  {
+    const double exponent = -0.5 * power;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      double w = std::pow(sqDistances[i], exponent);
+      num += w * values[i];
+      denom += w;
+    }
+  }
+  return num / denom;
 }
 
-class InverseDistanceWeightingForPointCloud
+// The sources of an interpolation held in a uniform grid of bins. Coordinates
+// and values are sorted by bin into separate contiguous arrays, so the sources
+// in a row of bins are adjacent in memory and their distances to a query point
+// can be computed in a single loop.
+class SourceIndex
 {
 public:
-  InverseDistanceWeightingForPointCloud(
-    const smtk::mesh::PointCloud& pointcloud,
+  static const std::size_t PointsPerBin = 8;
+  static const std::size_t MaximumBinsPerAxis = 1024;
+
+  SourceIndex(const std::vector<std::array<double, 3>>& points, const std::vector<double>& values);
+
+  double evaluate(
+    const double* p,
     double power,
-    std::function<bool(double)> prefilter)
-    : m_pointcloud(pointcloud)
-    , m_power(power)
-    , m_prefilter(prefilter)
+    std::size_t numberOfNeighbors,
+    double radius,
+    Scratch& scratch) const;
+
+private:
+  std::size_t bin(int axis, double coordinate) const
   {
+    double b = std::floor((coordinate - m_origin[axis]) / m_binSize[axis]);
+    return b <= 0. ? 0 : std::min(static_cast<std::size_t>(b), m_resolution[axis] - 1);
   }
 
-  // Return the interpolated value at <p> as a weighted sum of the sources
-  double operator()(const std::array<double, 3>& p) const
+  std::size_t binId(std::size_t i, std::size_t j, std::size_t k) const
   {
-    double d = 0., w = 0., num = 0., denom = 0.;
-    for (std::size_t i = 0; i < m_pointcloud.size(); i++)
+    return i + m_resolution[0] * (j + m_resolution[1] * k);
+  }
+
+  double evaluateAll(const double* p, double power, Scratch& scratch) const;
+  double evaluateWithin(const double* p, double power, double radius, Scratch& scratch) const;
+  double evaluateNearest(
+    const double* p,
+    double power,
+    std::size_t numberOfNeighbors,
+    double radius,
+    Scratch& scratch) const;
+
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+  std::vector<double> m_values;
+  std::vector<std::size_t> m_offsets;
+  std::array<double, 3> m_origin;
+  std::array<double, 3> m_binSize;
+  std::array<std::size_t, 3> m_resolution;
+};
+
+SourceIndex::SourceIndex(
+  const std::vector<std::array<double, 3>>& points,
+  const std::vector<double>& values)
+{
+  const std::size_t n = points.size();
+
+  // Compute the bounds of the sources.
+  std::array<double, 3> upper;
+  for (int a = 0; a < 3; ++a)
+  {
+    m_origin[a] = n > 0 ? points[0][a] : 0.;
+    upper[a] = m_origin[a];
+  }
+  for (const auto& point : points)
+  {
+    for (int a = 0; a < 3; ++a)
     {
-      if (m_pointcloud.containsIndex(i))
+      m_origin[a] = std::min(m_origin[a], point[a]);
+      upper[a] = std::max(upper[a], point[a]);
+    }
+  }
+
+  // Choose cubic bins holding roughly PointsPerBin sources each, spanning
+  // only the axes along which the sources are spread (LIDAR data is often
+  // flat).
+  double volume = 1.;
+  int dimension = 0;
+  for (int a = 0; a < 3; ++a)
+  {
+    if (upper[a] > m_origin[a])
+    {
+      volume *= upper[a] - m_origin[a];
+      ++dimension;
+    }
+  }
+  const double numberOfBins = std::max(1., static_cast<double>(n / PointsPerBin));
+  const double binSize = dimension > 0 ? std::pow(volume / numberOfBins, 1. / dimension) : 1.;
+  for (int a = 0; a < 3; ++a)
+  {
+    const double extent = upper[a] - m_origin[a];
+    const double resolution =
+      extent > 0. ? std::min(std::ceil(extent / binSize), double(MaximumBinsPerAxis)) : 1.;
+    m_resolution[a] = std::max(std::size_t(1), static_cast<std::size_t>(resolution));
+    m_binSize[a] = extent > 0. ? extent / m_resolution[a] : 1.;
+  }
+
+  // Sort the sources by bin.
+  std::vector<std::size_t> bins(n);
+  m_offsets.assign(m_resolution[0] * m_resolution[1] * m_resolution[2] + 1, 0);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    bins[i] = this->binId(
+      this->bin(0, points[i][0]), this->bin(1, points[i][1]), this->bin(2, points[i][2]));
+    ++m_offsets[bins[i] + 1];
+  }
+  for (std::size_t i = 1; i < m_offsets.size(); ++i)
+  {
+    m_offsets[i] += m_offsets[i - 1];
+  }
+
+  m_x.resize(n);
+  m_y.resize(n);
+  m_z.resize(n);
+  m_values.resize(n);
+  std::vector<std::size_t> position(m_offsets.begin(), m_offsets.end() - 1);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    std::size_t j = position[bins[i]]++;
+    m_x[j] = points[i][0];
+    m_y[j] = points[i][1];
+    m_z[j] = points[i][2];
+    m_values[j] = values[i];
+  }
+}
+
+double SourceIndex::evaluate(
+  const double* p,
+  double power,
+  std::size_t numberOfNeighbors,
+  double radius,
+  Scratch& scratch) const
+{
+  if (numberOfNeighbors > 0)
+  {
+    return this->evaluateNearest(p, power, numberOfNeighbors, radius, scratch);
+  }
+  if (radius > 0.)
+  {
+    return this->evaluateWithin(p, power, radius, scratch);
+  }
+  return this->evaluateAll(p, power, scratch);
+}
+
+double SourceIndex::evaluateAll(const double* p, double power, Scratch& scratch) const
+{
+  const std::size_t n = m_values.size();
+  scratch.sqDistances.resize(n);
+  double* d2 = scratch.sqDistances.data();
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    d2[i] = (m_x[i] - p[0]) * (m_x[i] - p[0]) + (m_y[i] - p[1]) * (m_y[i] - p[1]) +
+      (m_z[i] - p[2]) * (m_z[i] - p[2]);
+  }
+  return shepard(d2, m_values.data(), n, power);
+}
+
+double SourceIndex::evaluateWithin(const double* p, double power, double radius, Scratch& scratch)
+  const
+{
+  const double r2 = radius * radius;
+  std::array<std::size_t, 3> lower;
+  std::array<std::size_t, 3> upper;
+  for (int a = 0; a < 3; ++a)
+  {
+    lower[a] = this->bin(a, p[a] - radius);
+    upper[a] = this->bin(a, p[a] + radius);
+  }
+
+  scratch.sqDistances.clear();
+  scratch.values.clear();
+  for (std::size_t k = lower[2]; k <= upper[2]; ++k)
+  {
+    for (std::size_t j = lower[1]; j <= upper[1]; ++j)
+    {
+      // The sources of a row of bins are contiguous.
+      const std::size_t begin = m_offsets[this->binId(lower[0], j, k)];
+      const std::size_t end = m_offsets[this->binId(upper[0], j, k) + 1];
+      for (std::size_t i = begin; i < end; ++i)
       {
-        d = euclideanDistance(p, m_pointcloud.coordinates()(i));
-        // If d is zero, then return the value associated with the source point.
-        if (d < EPSILON)
+        double d2 = (m_x[i] - p[0]) * (m_x[i] - p[0]) + (m_y[i] - p[1]) * (m_y[i] - p[1]) +
+          (m_z[i] - p[2]) * (m_z[i] - p[2]);
+        if (d2 <= r2)
         {
-          return m_pointcloud.data()(i);
+          scratch.sqDistances.push_back(d2);
+          scratch.values.push_back(m_values[i]);
         }
-        // Otherwise, sum the contribution from each point.
-        w = std::pow(d, -1. * m_power);
-        num += w * m_pointcloud.data()(i);
-        denom += w;
       }
     }
+  }
+  return shepard(
+    scratch.sqDistances.data(), scratch.values.data(), scratch.sqDistances.size(), power);
+}
+
+double SourceIndex::evaluateNearest(
+  const double* p,
+  double power,
+  std::size_t numberOfNeighbors,
+  double radius,
+  Scratch& scratch) const
+{
+  const double bound =
+    radius > 0. ? radius * radius : std::numeric_limits<double>::infinity();
+
+  // The nearest sources are held in a max-heap keyed on squared distance.
+  auto& heap = scratch.heap;
+  heap.clear();
+  auto visit = [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      double d2 = (m_x[i] - p[0]) * (m_x[i] - p[0]) + (m_y[i] - p[1]) * (m_y[i] - p[1]) +
+        (m_z[i] - p[2]) * (m_z[i] - p[2]);
+      if (d2 > bound || (heap.size() == numberOfNeighbors && d2 >= heap.front().first))
+      {
+        continue;
+      }
+      if (heap.size() == numberOfNeighbors)
+      {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.pop_back();
+      }
+      heap.emplace_back(d2, m_values[i]);
+      std::push_heap(heap.begin(), heap.end());
+    }
+  };
 
-    return num / denom;
+  // Visit shells of bins of increasing distance from the bin containing the
+  // point until no unvisited bin can hold a closer source.
+  std::array<long long, 3> center;
+  std::array<long long, 3> resolution;
+  for (int a = 0; a < 3; ++a)
+  {
+    center[a] = static_cast<long long>(this->bin(a, p[a]));
+    resolution[a] = static_cast<long long>(m_resolution[a]);
   }
+  for (long long ring = 0;; ++ring)
+  {
+    std::array<long long, 3> lower;
+    std::array<long long, 3> upper;
+    for (int a = 0; a < 3; ++a)
+    {
+      lower[a] = std::max(center[a] - ring, 0LL);
+      upper[a] = std::min(center[a] + ring, resolution[a] - 1);
+    }
 
-private:
-  const smtk::mesh::PointCloud m_pointcloud;
-  double m_power;
-  std::function<bool(double)> m_prefilter;
-};
+    for (long long k = lower[2]; k <= upper[2]; ++k)
+    {
+      for (long long j = lower[1]; j <= upper[1]; ++j)
+      {
+        if (std::abs(k - center[2]) == ring || std::abs(j - center[1]) == ring)
+        {
+          visit(
+            m_offsets[this->binId(lower[0], j, k)], m_offsets[this->binId(upper[0], j, k) + 1]);
+        }
+        else
+        {
+          if (center[0] - ring >= 0)
+          {
+            std::size_t b = this->binId(center[0] - ring, j, k);
+            visit(m_offsets[b], m_offsets[b + 1]);
+          }
+          if (center[0] + ring < resolution[0])
+          {
+            std::size_t b = this->binId(center[0] + ring, j, k);
+            visit(m_offsets[b], m_offsets[b + 1]);
+          }
+        }
+      }
+    }
+
+    // Compute a lower bound on the distance from the point to the bins of the
+    // next shell.
+    double gap = std::numeric_limits<double>::infinity();
+    for (int a = 0; a < 3; ++a)
+    {
+      if (center[a] - ring > 0)
+      {
+        double edge = m_origin[a] + (center[a] - ring) * m_binSize[a];
+        gap = std::min(gap, std::max(p[a] - edge, 0.));
+      }
+      if (center[a] + ring < resolution[a] - 1)
+      {
+        double edge = m_origin[a] + (center[a] + ring + 1) * m_binSize[a];
+        gap = std::min(gap, std::max(edge - p[a], 0.));
+      }
+    }
+    const double gap2 = gap * gap;
+    if (
+      gap == std::numeric_limits<double>::infinity() || gap2 > bound ||
+      (heap.size() == numberOfNeighbors && gap2 >= heap.front().first))
+    {
+      break;
+    }
+  }
 
-class InverseDistanceWeightingForStructuredGrid
+  scratch.sqDistances.resize(heap.size());
+  scratch.values.resize(heap.size());
+  for (std::size_t i = 0; i < heap.size(); ++i)
+  {
+    scratch.sqDistances[i] = heap[i].first;
+    scratch.values[i] = heap[i].second;
+  }
+  return shepard(scratch.sqDistances.data(), scratch.values.data(), heap.size(), power);
+}
+
+// The evaluator shares its (immutable) index between copies, so it can be
+// held by std::function and evaluated from several threads.
+class InverseDistanceWeightingForSources
 {
 public:
-  InverseDistanceWeightingForStructuredGrid(
-    const smtk::mesh::StructuredGrid& structuredgrid,
+  InverseDistanceWeightingForSources(
+    const std::vector<std::array<double, 3>>& points,
+    const std::vector<double>& values,
     double power,
-    std::function<bool(double)> prefilter)
-    : m_structuredgrid(structuredgrid)
+    std::size_t numberOfNeighbors,
+    double radius)
+    : m_index(std::make_shared<SourceIndex>(points, values))
     , m_power(power)
-    , m_prefilter(prefilter)
+    , m_numberOfNeighbors(numberOfNeighbors)
+    , m_radius(radius)
   {
   }
 
   // Return the interpolated value at <p> as a weighted sum of the sources
   double operator()(const std::array<double, 3>& p) const
   {
-    double d = 0., w = 0., num = 0., denom = 0.;
-    for (int i = m_structuredgrid.m_extent[0]; i < m_structuredgrid.m_extent[1]; i++)
+    static thread_local Scratch scratch;
+    return m_index->evaluate(p.data(), m_power, m_numberOfNeighbors, m_radius, scratch);
+  }
+
+  // Evaluate <n> points held contiguously in <xyz>
+  void operator()(std::size_t n, const double* xyz, double* values) const
+  {
+    Scratch scratch;
+    for (std::size_t i = 0; i < n; ++i)
     {
-      for (int j = m_structuredgrid.m_extent[2]; j < m_structuredgrid.m_extent[3]; j++)
-      {
-        if (m_structuredgrid.containsIndex(i, j))
-        {
-          std::array<double, 3> pij = {
-            { (m_structuredgrid.m_origin[0] +
-               (i - m_structuredgrid.m_extent[0]) * m_structuredgrid.m_spacing[0]),
-              (m_structuredgrid.m_origin[1] +
-               (j - m_structuredgrid.m_extent[2]) * m_structuredgrid.m_spacing[1]),
-              0. }
-          };
-
-          double value = m_structuredgrid.data()(i, j);
-          if (m_prefilter(value))
-          {
-            d = euclideanDistance(p, pij);
-            // If d is zero, then return the value associated with the source point.
-            if (d < EPSILON)
-            {
-              return value;
-            }
-            // Otherwise, sum the contribution from each point.
-            w = std::pow(d, -1. * m_power);
-            num += w * value;
-            denom += w;
-          }
-        }
-      }
+      values[i] =
+        m_index->evaluate(xyz + 3 * i, m_power, m_numberOfNeighbors, m_radius, scratch);
     }
-
-    return num / denom;
   }
 
 private:
-  const smtk::mesh::StructuredGrid m_structuredgrid;
+  std::shared_ptr<const SourceIndex> m_index;
   double m_power;
-  std::function<bool(double)> m_prefilter;
+  std::size_t m_numberOfNeighbors;
+  double m_radius;
 };
+
+InverseDistanceWeightingForSources fromPointCloud(
+  const smtk::mesh::PointCloud& pointcloud,
+  double power,
+  std::size_t numberOfNeighbors,
+  double radius,
+  const std::function<bool(double)>& prefilter)
+{
+  std::vector<std::array<double, 3>> points;
+  std::vector<double> values;
+  for (std::size_t i = 0; i < pointcloud.size(); i++)
+  {
+    if (pointcloud.containsIndex(i))
+    {
+      double value = pointcloud.data()(i);
+      if (prefilter(value))
+      {
+        points.push_back(pointcloud.coordinates()(i));
+        values.push_back(value);
+      }
+    }
+  }
+  return InverseDistanceWeightingForSources(points, values, power, numberOfNeighbors, radius);
+}
+
+InverseDistanceWeightingForSources fromStructuredGrid(
+  const smtk::mesh::StructuredGrid& structuredgrid,
+  double power,
+  std::size_t numberOfNeighbors,
+  double radius,
+  const std::function<bool(double)>& prefilter)
+{
+  std::vector<std::array<double, 3>> points;
+  std::vector<double> values;
+  for (int i = structuredgrid.m_extent[0]; i < structuredgrid.m_extent[1]; i++)
+  {
+    for (int j = structuredgrid.m_extent[2]; j < structuredgrid.m_extent[3]; j++)
+    {
+      if (structuredgrid.containsIndex(i, j))
+      {
+        double value = structuredgrid.data()(i, j);
+        if (prefilter(value))
+        {
+          points.push_back(
+            { { (structuredgrid.m_origin[0] +
+                 (i - structuredgrid.m_extent[0]) * structuredgrid.m_spacing[0]),
+                (structuredgrid.m_origin[1] +
+                 (j - structuredgrid.m_extent[2]) * structuredgrid.m_spacing[1]),
+                0. } });
+          values.push_back(value);
+        }
+      }
+    }
+  }
+  return InverseDistanceWeightingForSources(points, values, power, numberOfNeighbors, radius);
+}
 } // namespace
 
 namespace smtk
@@ -138,16 +507,74 @@ InverseDistanceWeighting::InverseDistanceWeighting(
   const PointCloud& pointcloud,
   double power,
   std::function<bool(double)> prefilter)
-  : m_function(InverseDistanceWeightingForPointCloud(pointcloud, power, prefilter))
+  : InverseDistanceWeighting(pointcloud, power, 0, 0., prefilter)
+{
+}
+
+InverseDistanceWeighting::InverseDistanceWeighting(
+  const StructuredGrid& structuredgrid,
+  double power,
+  std::function<bool(double)> prefilter)
+  : InverseDistanceWeighting(structuredgrid, power, 0, 0., prefilter)
+{
+}
+
+InverseDistanceWeighting::InverseDistanceWeighting(
+  const PointCloud& pointcloud,
+  double power,
+  std::size_t numberOfNeighbors,
+  double radius,
+  std::function<bool(double)> prefilter)
 {
+  auto idw = fromPointCloud(pointcloud, power, numberOfNeighbors, radius, prefilter);
+  m_function = idw;
+  m_block = idw;
 }
 
 InverseDistanceWeighting::InverseDistanceWeighting(
   const StructuredGrid& structuredgrid,
   double power,
+  std::size_t numberOfNeighbors,
+  double radius,
   std::function<bool(double)> prefilter)
-  : m_function(InverseDistanceWeightingForStructuredGrid(structuredgrid, power, prefilter))
 {
+  auto idw = fromStructuredGrid(structuredgrid, power, numberOfNeighbors, radius, prefilter);
+  m_function = idw;
+  m_block = idw;
+}
+
+void InverseDistanceWeighting::operator()(
+  std::size_t numberOfPoints,
+  const double* xyz,
+  double* values,
+  unsigned int numberOfThreads) const
+{
+  if (numberOfThreads == 0)
+  {
+    numberOfThreads = smtk::common::Executor::instance().numberOfThreads();
+  }
+
+  if (numberOfThreads == 1 || numberOfPoints <= BlockSize)
+  {
+    m_block(numberOfPoints, xyz, values);
+    return;
+  }
+
+  smtk::common::ThreadPool<> pool(numberOfThreads);
+  std::vector<std::future<void>> futures;
+  for (std::size_t begin = 0; begin < numberOfPoints; begin += BlockSize)
+  {
+    std::size_t count = std::min(BlockSize, numberOfPoints - begin);
+    futures.push_back(pool(
+      [this, count, xyz, values, begin]() { m_block(count, xyz + 3 * begin, values + begin); }));
+  }
+  for (auto& future : futures)
+  {
+    // Run other pending tasks while waiting in case this thread is itself an
+    // executor worker.
+    smtk::common::Executor::instance().wait(future);
+    future.get();
+  }
 }
 } // namespace mesh
 } // namespace smtk
@@ -33,6 +33,14 @@ class StructuredGrid;
    inverse distance weights of the data set. Shepard's method is used to perform
    the computation. Values from the input data set can be masked using the
    prefilter functor.
+
+   By default every source contributes to every value. The contributing
+   sources can instead be limited to the \a numberOfNeighbors sources nearest
+   to the input point and/or to those within \a radius of it (a value of 0
+   removes either bound). The sources are then held in a spatial index, so
+   each value costs time proportional to the number of nearby sources rather
+   than to the size of the data set. If no source lies within the bounds, the
+   value is NaN.
   */
 class SMTKCORE_EXPORT InverseDistanceWeighting
 {
@@ -46,10 +54,34 @@ public:
     double power = 1.,
     std::function<bool(double)> prefilter = [](double) { return true; });
 
+  InverseDistanceWeighting(
+    const PointCloud& pointcloud,
+    double power,
+    std::size_t numberOfNeighbors,
+    double radius,
+    std::function<bool(double)> prefilter = [](double) { return true; });
+  InverseDistanceWeighting(
+    const StructuredGrid& structuredgrid,
+    double power,
+    std::size_t numberOfNeighbors,
+    double radius,
+    std::function<bool(double)> prefilter = [](double) { return true; });
+
   double operator()(std::array<double, 3> x) const { return m_function(x); }
 
+  /// Evaluate the function at \a numberOfPoints points whose coordinates are
+  /// held contiguously in \a xyz (x0, y0, z0, x1, ...), writing one value per
+  /// point to \a values. Points are evaluated in blocks distributed across
+  /// \a numberOfThreads threads (0 for one per core).
+  void operator()(
+    std::size_t numberOfPoints,
+    const double* xyz,
+    double* values,
+    unsigned int numberOfThreads = 1) const;
+
 private:
   std::function<double(std::array<double, 3>)> m_function;
+  std::function<void(std::size_t, const double*, double*)> m_block;
 };
 } // namespace mesh
 } // namespace smtk
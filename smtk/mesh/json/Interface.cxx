@@ -523,6 +523,11 @@ smtk::mesh::HandleRange Interface::neighbors(const smtk::mesh::Handle& cellId) c
   return smtk::mesh::HandleRange();
 }
 
+std::size_t Interface::connectivityRevision() const
+{
+  return 0;
+}
+
 bool Interface::setDomain(
   const smtk::mesh::HandleRange& /*meshsets*/,
   const smtk::mesh::Domain& /*domain*/) const
@@ -222,6 +222,8 @@ public:
   //given a handle to a cell, return its dimension-equivalent neighbors.
   smtk::mesh::HandleRange neighbors(const smtk::mesh::Handle& cell) const override;
 
+  std::size_t connectivityRevision() const override;
+
   //merge any duplicate points used by the cells that have been passed
   bool mergeCoincidentContactPoints(const smtk::mesh::HandleRange& meshes, double tolerance)
     override;
@@ -262,7 +262,9 @@ bool Interface::isModified() const
 smtk::mesh::AllocatorPtr Interface::allocator()
 {
   //mark us as modified as the caller is going to add something to the database
+  //or change the connectivity of existing cells
   m_modified = true;
+  ++m_connectivityRevision;
   return m_alloc;
 }
 
@@ -270,6 +272,7 @@ smtk::mesh::BufferedCellAllocatorPtr Interface::bufferedCellAllocator()
 {
   //mark us as modified as the caller is going to add something to the database
   m_modified = true;
+  ++m_connectivityRevision;
   std::static_pointer_cast<smtk::mesh::moab::BufferedCellAllocator>(m_bcAlloc)->clear();
   return m_bcAlloc;
 }
@@ -278,6 +281,7 @@ smtk::mesh::IncrementalAllocatorPtr Interface::incrementalAllocator()
 {
   //mark us as modified as the caller is going to add something to the database
   m_modified = true;
+  ++m_connectivityRevision;
   static_cast<smtk::mesh::moab::IncrementalAllocator*>(m_iAlloc.get())->initialize();
   return m_iAlloc;
 }
@@ -501,7 +505,7 @@ smtk::mesh::HandleRange Interface::getCells(const smtk::mesh::HandleRange& meshs
 {
   // get all non-meshset entities in meshset, including in contained meshsets
   ::moab::Range entitiesCells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_handle appends to the range given
     m_iface->get_entities_by_handle(*i, entitiesCells, true);
@@ -519,7 +523,7 @@ smtk::mesh::HandleRange Interface::getCells(
   ::moab::Range entitiesCells;
 
   // get all non-meshset entities in meshset of a given cell type
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_type appends to the range given
     m_iface->get_entities_by_type(
@@ -578,7 +582,7 @@ smtk::mesh::HandleRange Interface::getCells(
 
   //get all non-meshset entities of a given dimension
   ::moab::Range entitiesCells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_dimension appends to the range given
     m_iface->get_entities_by_dimension(*i, dimension, entitiesCells, true);
@@ -731,7 +735,7 @@ std::vector<std::string> Interface::computeNames(const smtk::mesh::HandleRange&
   tag::QueryNameTag query_name(this->moabInterface());
 
   std::set<std::string> unique_names;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     const bool has_name = query_name.fetch_name(*i);
     if (has_name)
@@ -846,7 +850,7 @@ bool Interface::computeShell(const smtk::mesh::HandleRange& meshes, smtk::mesh::
   {
     --dimension;
     // get all non-meshset entities in meshset of a given cell type
-    for (auto i = boost::icl::elements_begin(meshes); i != boost::icl::elements_end(meshes); ++i)
+    for (auto i = meshes.elements_begin(); i != meshes.elements_end(); ++i)
     {
       //get_entities_by_dimension appends to the range given
       m_iface->get_entities_by_dimension(*i, dimension, cells, true);
@@ -871,6 +875,9 @@ bool Interface::computeShell(const smtk::mesh::HandleRange& meshes, smtk::mesh::
   ::moab::Range moabShell;
   ::moab::ErrorCode rval = skinner.find_skin(this->getRoot(), cells, skinDim, moabShell);
 
+  //the cells deleted below free handles that moab may reuse
+  ++m_connectivityRevision;
+
   if (rval != ::moab::MB_SUCCESS)
   {
     //if the skin extraction failed remove all cells we created
@@ -899,7 +906,7 @@ bool Interface::computeAdjacenciesOfDimension(
   }
 
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshes); i != boost::icl::elements_end(meshes); ++i)
+  for (auto i = meshes.elements_begin(); i != meshes.elements_end(); ++i)
   {
     //get_entities_by_handle appends to the range given
     m_iface->get_entities_by_handle(*i, cells, true);
@@ -957,6 +964,7 @@ bool Interface::mergeCoincidentContactPoints(
   if (rval == ::moab::MB_SUCCESS)
   {
     m_modified = true;
+    ++m_connectivityRevision;
     return true;
   }
   return false;
@@ -995,6 +1003,11 @@ smtk::mesh::HandleRange Interface::neighbors(const smtk::mesh::Handle& cellId) c
   return neighborsRange;
 }
 
+std::size_t Interface::connectivityRevision() const
+{
+  return m_connectivityRevision;
+}
+
 bool Interface::setDomain(const smtk::mesh::HandleRange& meshsets, const smtk::mesh::Domain& domain)
   const
 {
@@ -1025,7 +1038,7 @@ bool Interface::setDirichlet(
 
   //get all non-meshset entities of a given dimension
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_dimension appends to the range given
     m_iface->get_entities_by_dimension(*i, static_cast<int>(smtk::mesh::Dims0), cells, true);
@@ -1064,8 +1077,7 @@ bool Interface::setNeumann(
   {
     ::moab::Range cells;
     --dimension;
-    for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets);
-         ++i)
+    for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
     {
       m_iface->get_entities_by_dimension(*i, dimension, cells, true);
     }
@@ -1078,8 +1090,7 @@ bool Interface::setNeumann(
   {
     ::moab::Range cells;
     --dimension;
-    for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets);
-         ++i)
+    for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
     {
       m_iface->get_entities_by_dimension(*i, dimension, cells, true);
     }
@@ -1266,7 +1277,7 @@ bool Interface::createCellField(
 
   // We first construct the data set for the cells associated with the meshsets.
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_handle appends to the range given
     m_iface->get_entities_by_handle(*i, cells, true);
@@ -1422,7 +1433,7 @@ bool Interface::getCellField(
   }
 
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_handle appends to the range given
     m_iface->get_entities_by_handle(*i, cells, true);
@@ -1453,7 +1464,7 @@ bool Interface::setCellField(
   }
 
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_handle appends to the range given
     m_iface->get_entities_by_handle(*i, cells, true);
@@ -1566,7 +1577,7 @@ bool Interface::deleteCellField(
   }
 
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     m_iface->get_entities_by_handle(*i, cells, true);
   }
@@ -1624,7 +1635,7 @@ bool Interface::createPointField(
 
   // We first construct the data set for the points associated with the meshsets.
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_handle appends to the range given
     m_iface->get_entities_by_handle(*i, cells, true);
@@ -1782,7 +1793,7 @@ bool Interface::getPointField(
   }
 
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_handle appends to the range given
     m_iface->get_entities_by_handle(*i, cells, true);
@@ -1816,7 +1827,7 @@ bool Interface::setPointField(
   }
 
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_handle appends to the range given
     m_iface->get_entities_by_handle(*i, cells, true);
@@ -1932,7 +1943,7 @@ bool Interface::deletePointField(
   }
 
   ::moab::Range cells;
-  for (auto i = boost::icl::elements_begin(meshsets); i != boost::icl::elements_end(meshsets); ++i)
+  for (auto i = meshsets.elements_begin(); i != meshsets.elements_end(); ++i)
   {
     //get_entities_by_handle appends to the range given
     m_iface->get_entities_by_handle(*i, cells, true);
@@ -2005,7 +2016,7 @@ smtk::mesh::HandleRange Interface::pointIntersect(
     int size = 0;
     const smtk::mesh::Handle* connectivity;
     bpc.initCellTraversal();
-    for (auto i = boost::icl::elements_begin(b); i != boost::icl::elements_end(b); ++i)
+    for (auto i = b.elements_begin(); i != b.elements_end(); ++i)
     {
       const bool validCell = bpc.fetchNextCell(size, connectivity);
       if (validCell)
@@ -2055,7 +2066,7 @@ smtk::mesh::HandleRange Interface::pointDifference(
     int size = 0;
     const smtk::mesh::Handle* connectivity;
     bpc.initCellTraversal();
-    for (auto i = boost::icl::elements_begin(b); i != boost::icl::elements_end(b); ++i)
+    for (auto i = b.elements_begin(); i != b.elements_end(); ++i)
     {
       const bool validCell = bpc.fetchNextCell(size, connectivity);
       if (validCell)
@@ -2192,7 +2203,7 @@ void Interface::cellForEach(
     int size = 0;
     const smtk::mesh::Handle* points;
 
-    auto currentCell = boost::icl::elements_begin(cells);
+    auto currentCell = cells.elements_begin();
     if (filter.wantsCoordinates())
     {
       std::vector<double> coords;
@@ -2226,7 +2237,7 @@ void Interface::meshForEach(const smtk::mesh::HandleRange& meshes, smtk::mesh::M
 {
   if (!meshes.empty())
   {
-    for (auto i = boost::icl::elements_begin(meshes); i != boost::icl::elements_end(meshes); ++i)
+    for (auto i = meshes.elements_begin(); i != meshes.elements_end(); ++i)
     {
 
       smtk::mesh::HandleRange singleHandle;
@@ -2282,6 +2293,7 @@ bool Interface::deleteHandles(const smtk::mesh::HandleRange& toDel)
 
     //we have zero entity sets so we must be all cells/coords
     const ::moab::ErrorCode rval = m_iface->delete_entities(otherCells);
+    ++m_connectivityRevision;
 
     //we don't delete the vertices, as those can't be explicitly deleted
     //instead they are deleted when the mesh goes away
@@ -236,6 +236,8 @@ public:
   //given a handle to a cell, return its dimension-equivalent neighbors.
   smtk::mesh::HandleRange neighbors(const smtk::mesh::Handle& cell) const override;
 
+  std::size_t connectivityRevision() const override;
+
   bool setDomain(const smtk::mesh::HandleRange& meshsets, const smtk::mesh::Domain& domain)
     const override;
 
@@ -398,6 +400,7 @@ private:
   smtk::mesh::BufferedCellAllocatorPtr m_bcAlloc;
   smtk::mesh::IncrementalAllocatorPtr m_iAlloc;
   mutable bool m_modified{ false };
+  mutable std::size_t m_connectivityRevision{ 0 };
 };
 } // namespace moab
 } // namespace mesh
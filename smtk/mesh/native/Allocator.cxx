@@ -0,0 +1,117 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#include "smtk/mesh/native/Allocator.h"
+#include "smtk/mesh/native/Storage.h"
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+Allocator::Allocator(Storage* storage)
+  : m_storage(storage)
+{
+}
+
+Allocator::~Allocator()
+{
+  //don't de-allocate the storage, the Interface that created us really
+  //manages this memory
+  m_storage = nullptr;
+}
+
+bool Allocator::allocatePoints(
+  std::size_t numPointsToAlloc,
+  smtk::mesh::Handle& firstVertexHandle,
+  std::vector<double*>& coordinateMemory)
+{
+  std::size_t first;
+  if (m_storage == nullptr || !m_storage->allocatePoints(numPointsToAlloc, first))
+  {
+    return false;
+  }
+
+  firstVertexHandle = Storage::handle(Storage::Kind::Point, first);
+  coordinateMemory.clear();
+  coordinateMemory.push_back(m_storage->x().data() + first);
+  coordinateMemory.push_back(m_storage->y().data() + first);
+  coordinateMemory.push_back(m_storage->z().data() + first);
+  return true;
+}
+
+bool Allocator::allocateCells(
+  smtk::mesh::CellType cellType,
+  std::size_t numCellsToAlloc,
+  int numVertsPerCell,
+  smtk::mesh::HandleRange& createdCellIds,
+  smtk::mesh::Handle*& connectivityArray)
+{
+  std::size_t first;
+  if (
+    m_storage == nullptr ||
+    !m_storage->allocateCells(cellType, numCellsToAlloc, numVertsPerCell, first))
+  {
+    return false;
+  }
+
+  std::unique_ptr<smtk::mesh::Handle[]> staging(
+    new smtk::mesh::Handle[numCellsToAlloc * numVertsPerCell]());
+  connectivityArray = staging.get();
+  m_staging[connectivityArray] = std::move(staging);
+
+  createdCellIds =
+    smtk::mesh::HandleRange(Storage::interval(Storage::Kind::Cell, first, numCellsToAlloc));
+  return true;
+}
+
+bool Allocator::connectivityModified(
+  const smtk::mesh::HandleRange& cellsToUpdate,
+  int numVertsPerCell,
+  const smtk::mesh::Handle* connectivityArray)
+{
+  if (m_storage == nullptr || connectivityArray == nullptr)
+  {
+    return false;
+  }
+
+  const smtk::mesh::Handle* points = connectivityArray;
+  for (const auto& interval : cellsToUpdate)
+  {
+    if (Storage::kind(interval.lower()) != Storage::Kind::Cell)
+    {
+      return false;
+    }
+    for (std::size_t cell = Storage::index(interval.lower());
+         cell <= Storage::index(interval.upper());
+         ++cell)
+    {
+      if (cell >= m_storage->numberOfCells() || m_storage->cellSize(cell) != numVertsPerCell)
+      {
+        return false;
+      }
+      for (int i = 0; i < numVertsPerCell; ++i)
+      {
+        m_storage->setPointIndex(cell, i, Storage::index(*points++));
+      }
+    }
+  }
+  m_storage->connectivityModified();
+
+  //the staging buffer is no longer needed once it has been copied
+  m_staging.erase(connectivityArray);
+  return true;
+}
+} // namespace native
+} // namespace mesh
+} // namespace smtk
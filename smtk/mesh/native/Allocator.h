@@ -0,0 +1,74 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#ifndef smtk_mesh_native_Allocator_h
+#define smtk_mesh_native_Allocator_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/mesh/native/Interface.h"
+
+#include <map>
+#include <memory>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+class Storage;
+
+/// Cells are allocated directly in the storage, but since the storage holds
+/// point indices rather than handles, the connectivity array handed to the
+/// caller is a staging buffer. It is copied into the storage (and released)
+/// when the caller reports it through connectivityModified().
+class SMTKCORE_EXPORT Allocator : public smtk::mesh::Allocator
+{
+public:
+  Allocator(Storage* storage);
+
+  ~Allocator() override;
+
+  Allocator(const Allocator& other) = delete;
+  Allocator& operator=(const Allocator& other) = delete;
+
+  bool allocatePoints(
+    std::size_t numPointsToAlloc,
+    smtk::mesh::Handle& firstVertexHandle,
+    std::vector<double*>& coordinateMemory) override;
+
+  bool allocateCells(
+    smtk::mesh::CellType cellType,
+    std::size_t numCellsToAlloc,
+    int numVertsPerCell,
+    smtk::mesh::HandleRange& createdCellIds,
+    smtk::mesh::Handle*& connectivityArray) override;
+
+  bool connectivityModified(
+    const smtk::mesh::HandleRange& cellsToUpdate,
+    int numVertsPerCell,
+    const smtk::mesh::Handle* connectivityArray) override;
+
+protected:
+  //holds a reference to the storage of the interface that created us
+  Storage* m_storage;
+
+private:
+  std::map<const smtk::mesh::Handle*, std::unique_ptr<smtk::mesh::Handle[]>> m_staging;
+};
+} // namespace native
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -0,0 +1,147 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#include "smtk/mesh/native/BufferedCellAllocator.h"
+#include "smtk/mesh/native/Storage.h"
+
+#include "smtk/mesh/core/CellTypes.h"
+
+#include <cassert>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+BufferedCellAllocator::BufferedCellAllocator(Storage* storage)
+  : Allocator(storage)
+  , m_firstCoordinate(0)
+  , m_nCoordinates(0)
+  , m_activeCellType(smtk::mesh::CellType_MAX)
+  , m_nCoords(0)
+{
+}
+
+BufferedCellAllocator::~BufferedCellAllocator()
+{
+  this->flush();
+}
+
+bool BufferedCellAllocator::reserveNumberOfCoordinates(std::size_t nCoordinates)
+{
+  // Can only reserve coordinates once
+  if (m_nCoordinates != 0 || m_storage == nullptr)
+  {
+    return false;
+  }
+
+  m_validState = m_storage->allocatePoints(nCoordinates, m_firstCoordinate);
+
+  if (m_validState)
+  {
+    m_nCoordinates = nCoordinates;
+  }
+
+  return m_validState;
+}
+
+bool BufferedCellAllocator::setCoordinate(std::size_t coord, double* xyz)
+{
+  if (!m_validState)
+  {
+    return false;
+  }
+  assert(coord < m_nCoordinates);
+
+  const std::size_t point = this->pointIndex(static_cast<std::int64_t>(coord));
+  m_storage->x()[point] = xyz[0];
+  m_storage->y()[point] = xyz[1];
+  m_storage->z()[point] = xyz[2];
+
+  return m_validState;
+}
+
+bool BufferedCellAllocator::flush()
+{
+  if (!m_validState)
+  {
+    return false;
+  }
+
+  if (m_localConnectivity.empty())
+  {
+    return true;
+  }
+
+  if (m_activeCellType == smtk::mesh::CellType_MAX)
+  {
+    return false;
+  }
+
+  if (m_activeCellType == smtk::mesh::Vertex)
+  {
+    // Points are their own vertex cells, so rather than allocating cells we
+    // explicitly add those points to the cells range
+    for (auto&& ptCoordinate : m_localConnectivity)
+    {
+      m_cells.insert(Storage::handle(Storage::Kind::Point, this->pointIndex(ptCoordinate)));
+    }
+
+    m_localConnectivity.clear();
+
+    return m_validState;
+  }
+
+  const std::size_t numberOfCells = m_localConnectivity.size() / m_nCoords;
+  std::size_t firstCell;
+  m_validState = m_storage->allocateCells(m_activeCellType, numberOfCells, m_nCoords, firstCell);
+
+  if (m_validState)
+  {
+    // the storage holds point indices, so we can write the connectivity
+    // directly without a staging buffer
+    std::size_t index = 0;
+    for (std::size_t cell = firstCell; cell < firstCell + numberOfCells; ++cell)
+    {
+      for (int i = 0; i < m_nCoords; ++i)
+      {
+        m_storage->setPointIndex(cell, i, this->pointIndex(m_localConnectivity[index++]));
+      }
+    }
+    m_storage->connectivityModified();
+
+    m_cells.insert(Storage::interval(Storage::Kind::Cell, firstCell, numberOfCells));
+  }
+
+  m_localConnectivity.clear();
+
+  return m_validState;
+}
+
+smtk::mesh::HandleRange BufferedCellAllocator::cells()
+{
+  return m_cells;
+}
+
+void BufferedCellAllocator::clear()
+{
+  m_firstCoordinate = 0;
+  m_nCoordinates = 0;
+  m_activeCellType = smtk::mesh::CellType_MAX;
+  m_nCoords = 0;
+  m_localConnectivity.clear();
+  m_cells.clear();
+}
+} // namespace native
+} // namespace mesh
+} // namespace smtk
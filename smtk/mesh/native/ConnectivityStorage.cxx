@@ -0,0 +1,157 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#include "smtk/mesh/native/ConnectivityStorage.h"
+#include "smtk/mesh/native/Storage.h"
+
+#ifndef NDEBUG
+#include <iostream>
+#endif
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+ConnectivityStorage::ConnectivityStorage(
+  const Storage* storage,
+  const smtk::mesh::HandleRange& cells)
+  : StoragePtr(storage)
+  , Cells(cells)
+  , NumberOfCells(0)
+{
+  //start a new run whenever the cell type or size changes
+  auto addCell = [this](smtk::mesh::CellType cellType, int numVerts) {
+    if (
+      this->RunTypes.empty() || this->RunTypes.back() != cellType ||
+      this->RunVertsPerCell.back() != numVerts)
+    {
+      this->RunStartPositions.push_back(this->Connectivity.size());
+      this->RunLengths.push_back(0);
+      this->RunVertsPerCell.push_back(numVerts);
+      this->RunTypes.push_back(cellType);
+    }
+    ++this->RunLengths.back();
+    ++this->NumberOfCells;
+  };
+
+  for (const auto& interval : cells)
+  {
+    const Storage::Kind kind = Storage::kind(interval.lower());
+    if (kind == Storage::Kind::Point)
+    {
+      //points are their own vertex cells
+      for (smtk::mesh::Handle point = interval.lower(); point <= interval.upper(); ++point)
+      {
+        addCell(smtk::mesh::Vertex, 1);
+        this->Connectivity.push_back(point);
+      }
+    }
+    else if (kind == Storage::Kind::Cell)
+    {
+      const std::size_t last = Storage::index(interval.upper());
+      for (std::size_t cell = Storage::index(interval.lower()); cell <= last; ++cell)
+      {
+        const int numVerts = storage->cellSize(cell);
+        addCell(storage->cellType(cell), numVerts);
+        const std::size_t position = this->Connectivity.size();
+        this->Connectivity.resize(position + numVerts);
+        storage->connectivity(cell, &this->Connectivity[position]);
+      }
+    }
+    else
+    {
+//we shouldn't presume all ids coming in have connectivity. Meshsets
+//have none, so we skip them
+#ifndef NDEBUG
+      std::cerr << "Passed range that contained non cell ids" << std::endl;
+      std::cerr << "Handle ids " << interval.lower() << " to " << interval.upper()
+                << " are not cell ids" << std::endl;
+#endif
+    }
+  }
+}
+
+ConnectivityStorage::~ConnectivityStorage() = default;
+
+void ConnectivityStorage::initTraversal(smtk::mesh::ConnectivityStorage::IterationState& state)
+{
+  state.whichConnectivityVector = 0;
+  state.ptrOffsetInVector = 0;
+}
+
+bool ConnectivityStorage::fetchNextCell(
+  smtk::mesh::ConnectivityStorage::IterationState& state,
+  smtk::mesh::CellType& cellType,
+  int& numPts,
+  const smtk::mesh::Handle*& points)
+{
+  if (state.whichConnectivityVector >= this->RunTypes.size())
+  { //we have iterated passed the end of the runs
+    return false;
+  }
+
+  const std::size_t index = state.whichConnectivityVector;
+  const std::size_t ptr = state.ptrOffsetInVector;
+
+  cellType = this->RunTypes[index];
+  numPts = this->RunVertsPerCell[index];
+  points = &this->Connectivity[this->RunStartPositions[index] + ptr];
+
+  //now determine if this is the last cell of the run
+  const std::size_t currentRunLength = this->RunLengths[index] * this->RunVertsPerCell[index];
+  if (ptr + numPts >= currentRunLength)
+  {
+    //move to the next run
+    ++state.whichConnectivityVector;
+    state.ptrOffsetInVector = 0;
+  }
+  else
+  {
+    state.ptrOffsetInVector += numPts;
+  }
+  return true;
+}
+
+bool ConnectivityStorage::equal(smtk::mesh::ConnectivityStorage* base_other) const
+{
+  if (this == base_other)
+  {
+    return true;
+  }
+  if (!base_other)
+  {
+    return false;
+  }
+
+  smtk::mesh::native::ConnectivityStorage* other =
+    dynamic_cast<smtk::mesh::native::ConnectivityStorage*>(base_other);
+  if (!other)
+  {
+    return false;
+  }
+
+  //two quick checks that can confirm two items aren't equal
+  if (
+    this->StoragePtr != other->StoragePtr || this->NumberOfCells != other->NumberOfCells ||
+    this->Connectivity.size() != other->Connectivity.size())
+  {
+    return false;
+  }
+
+  //connectivity describing the same cells of the same storage is equal
+  return smtk::mesh::rangesEqual(this->Cells, other->Cells);
+}
+} // namespace native
+} // namespace mesh
+} // namespace smtk
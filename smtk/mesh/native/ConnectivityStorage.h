@@ -0,0 +1,70 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#ifndef smtk_mesh_native_ConnectivityStorage_h
+#define smtk_mesh_native_ConnectivityStorage_h
+
+#include "smtk/PublicPointerDefs.h"
+#include "smtk/mesh/core/Handle.h"
+
+#include "smtk/mesh/native/Interface.h"
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+class Storage;
+
+/// The connectivity of a range of cells, expanded from point indices into
+/// point handles and grouped into runs of cells sharing a type and size.
+class SMTKCORE_EXPORT ConnectivityStorage : public smtk::mesh::ConnectivityStorage
+{
+public:
+  ConnectivityStorage(const Storage* storage, const smtk::mesh::HandleRange& cells);
+
+  ~ConnectivityStorage() override;
+
+  ConnectivityStorage(const ConnectivityStorage& other) = delete;
+  ConnectivityStorage& operator=(const ConnectivityStorage& other) = delete;
+
+  void initTraversal(smtk::mesh::ConnectivityStorage::IterationState& state) override;
+
+  bool fetchNextCell(
+    smtk::mesh::ConnectivityStorage::IterationState& state,
+    smtk::mesh::CellType& cellType,
+    int& numPts,
+    const smtk::mesh::Handle*& points) override;
+
+  bool equal(smtk::mesh::ConnectivityStorage* other) const override;
+
+  std::size_t cellSize() const override { return NumberOfCells; }
+
+  std::size_t vertSize() const override { return Connectivity.size(); }
+
+private:
+  const Storage* StoragePtr;
+  smtk::mesh::HandleRange Cells;
+
+  std::vector<smtk::mesh::Handle> Connectivity;
+  std::vector<std::size_t> RunStartPositions;
+  std::vector<std::size_t> RunLengths;
+  std::vector<int> RunVertsPerCell;
+  std::vector<smtk::mesh::CellType> RunTypes;
+  std::size_t NumberOfCells;
+};
+} // namespace native
+} // namespace mesh
+} // namespace smtk
+
+#endif
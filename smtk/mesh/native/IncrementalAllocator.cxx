@@ -0,0 +1,94 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#include "smtk/mesh/native/IncrementalAllocator.h"
+#include "smtk/mesh/native/Storage.h"
+
+#include <algorithm>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+IncrementalAllocator::IncrementalAllocator(Storage* storage)
+  : BufferedCellAllocator(storage)
+{
+}
+
+IncrementalAllocator::~IncrementalAllocator()
+{
+  //flush while our coordinate mapping is still available
+  this->flush();
+}
+
+void IncrementalAllocator::initialize()
+{
+  this->BufferedCellAllocator::clear();
+  m_runs.clear();
+  m_validState = (m_storage != nullptr);
+}
+
+std::size_t IncrementalAllocator::addCoordinate(double* xyz)
+{
+  if (!m_validState)
+  {
+    return false;
+  }
+
+  const std::size_t point = m_storage->addPoint(xyz);
+  if (m_runs.empty() || m_runs.back().second + (m_nCoordinates - m_runs.back().first) != point)
+  {
+    m_runs.emplace_back(m_nCoordinates, point);
+  }
+
+  return m_nCoordinates++;
+}
+
+bool IncrementalAllocator::setCoordinate(std::size_t coord, double* xyz)
+{
+  if (!m_validState)
+  {
+    return false;
+  }
+
+  if (coord >= m_nCoordinates)
+  {
+    return false;
+  }
+
+  return BufferedCellAllocator::setCoordinate(coord, xyz);
+}
+
+std::size_t IncrementalAllocator::pointIndex(std::int64_t coord) const
+{
+  const std::size_t index = static_cast<std::size_t>(coord);
+
+  //find the last run that starts at or before <index>
+  auto run = std::upper_bound(
+    m_runs.begin(),
+    m_runs.end(),
+    index,
+    [](std::size_t value, const std::pair<std::size_t, std::size_t>& r) {
+      return value < r.first;
+    });
+  if (run == m_runs.begin())
+  {
+    return index;
+  }
+  --run;
+  return run->second + (index - run->first);
+}
+} // namespace native
+} // namespace mesh
+} // namespace smtk
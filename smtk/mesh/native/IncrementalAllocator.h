@@ -0,0 +1,86 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#ifndef smtk_mesh_native_IncrementalAllocator_h
+#define smtk_mesh_native_IncrementalAllocator_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/mesh/native/BufferedCellAllocator.h"
+#include "smtk/mesh/native/Interface.h"
+
+#include <cstdint>
+#include <utility>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+/// Coordinates are appended directly to the storage's coordinate arrays. If
+/// other points are allocated in between, the coordinates added here are no
+/// longer contiguous, so we record the start of each contiguous run of
+/// coordinates to map the caller's coordinate indices to point indices.
+class SMTKCORE_EXPORT IncrementalAllocator
+  : public smtk::mesh::IncrementalAllocator
+  , protected smtk::mesh::native::BufferedCellAllocator
+{
+public:
+  IncrementalAllocator(Storage* storage);
+
+  ~IncrementalAllocator() override;
+
+  IncrementalAllocator(const IncrementalAllocator& other) = delete;
+  IncrementalAllocator& operator=(const IncrementalAllocator& other) = delete;
+
+  std::size_t addCoordinate(double* xyz) override;
+  bool setCoordinate(std::size_t coord, double* xyz) override;
+
+  bool addCell(smtk::mesh::CellType ctype, long long int* pointIds, std::size_t nCoordinates = 0)
+    override
+  {
+    return BufferedCellAllocator::addCell(ctype, pointIds, nCoordinates);
+  }
+  bool addCell(smtk::mesh::CellType ctype, long int* pointIds, std::size_t nCoordinates = 0)
+    override
+  {
+    return BufferedCellAllocator::addCell(ctype, pointIds, nCoordinates);
+  }
+  bool addCell(smtk::mesh::CellType ctype, int* pointIds, std::size_t nCoordinates = 0) override
+  {
+    return BufferedCellAllocator::addCell(ctype, pointIds, nCoordinates);
+  }
+
+  bool flush() override { return BufferedCellAllocator::flush(); }
+
+  smtk::mesh::HandleRange cells() override { return BufferedCellAllocator::cells(); }
+
+  bool isValid() const override { return BufferedCellAllocator::isValid(); }
+
+protected:
+  std::size_t pointIndex(std::int64_t coord) const override;
+
+  friend class Interface;
+  void initialize();
+
+private:
+  //pairs of (first coordinate index, first point index) for each contiguous
+  //run of coordinates
+  std::vector<std::pair<std::size_t, std::size_t>> m_runs;
+};
+} // namespace native
+} // namespace mesh
+} // namespace smtk
+
+#endif
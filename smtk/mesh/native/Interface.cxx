@@ -0,0 +1,2170 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#include "smtk/mesh/native/Interface.h"
+
+#include "smtk/mesh/core/MeshSet.h"
+#include "smtk/mesh/core/PointConnectivity.h"
+#include "smtk/mesh/core/QueryTypes.h"
+#include "smtk/mesh/core/Resource.h"
+
+#include "smtk/mesh/native/Allocator.h"
+#include "smtk/mesh/native/BufferedCellAllocator.h"
+#include "smtk/mesh/native/ConnectivityStorage.h"
+#include "smtk/mesh/native/IncrementalAllocator.h"
+#include "smtk/mesh/native/PointLocatorImpl.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+namespace
+{
+typedef Storage::Kind Kind;
+
+//The sides of each cell type, in the canonical order MOAB (and Exodus) use
+//so that canonicalIndex() and the shell match those of the MOAB interface.
+struct Side
+{
+  int size;
+  int vertices[4];
+};
+
+const Side TriangleEdges[] = { { 2, { 0, 1 } }, { 2, { 1, 2 } }, { 2, { 2, 0 } } };
+const Side QuadEdges[] = { { 2, { 0, 1 } }, { 2, { 1, 2 } }, { 2, { 2, 3 } }, { 2, { 3, 0 } } };
+const Side TetrahedronEdges[] = { { 2, { 0, 1 } }, { 2, { 1, 2 } }, { 2, { 2, 0 } },
+                                  { 2, { 0, 3 } }, { 2, { 1, 3 } }, { 2, { 2, 3 } } };
+const Side TetrahedronFaces[] = {
+  { 3, { 0, 1, 3 } }, { 3, { 1, 2, 3 } }, { 3, { 0, 3, 2 } }, { 3, { 0, 2, 1 } }
+};
+const Side PyramidEdges[] = { { 2, { 0, 1 } }, { 2, { 1, 2 } }, { 2, { 2, 3 } }, { 2, { 3, 0 } },
+                              { 2, { 0, 4 } }, { 2, { 1, 4 } }, { 2, { 2, 4 } }, { 2, { 3, 4 } } };
+const Side PyramidFaces[] = { { 3, { 0, 1, 4 } },
+                              { 3, { 1, 2, 4 } },
+                              { 3, { 2, 3, 4 } },
+                              { 3, { 3, 0, 4 } },
+                              { 4, { 0, 3, 2, 1 } } };
+const Side WedgeEdges[] = { { 2, { 0, 1 } }, { 2, { 1, 2 } }, { 2, { 2, 0 } },
+                            { 2, { 0, 3 } }, { 2, { 1, 4 } }, { 2, { 2, 5 } },
+                            { 2, { 3, 4 } }, { 2, { 4, 5 } }, { 2, { 5, 3 } } };
+const Side WedgeFaces[] = { { 4, { 0, 1, 4, 3 } },
+                            { 4, { 1, 2, 5, 4 } },
+                            { 4, { 0, 3, 5, 2 } },
+                            { 3, { 0, 2, 1 } },
+                            { 3, { 3, 4, 5 } } };
+const Side HexahedronEdges[] = { { 2, { 0, 1 } }, { 2, { 1, 2 } }, { 2, { 2, 3 } },
+                                 { 2, { 3, 0 } }, { 2, { 0, 4 } }, { 2, { 1, 5 } },
+                                 { 2, { 2, 6 } }, { 2, { 3, 7 } }, { 2, { 4, 5 } },
+                                 { 2, { 5, 6 } }, { 2, { 6, 7 } }, { 2, { 7, 4 } } };
+const Side HexahedronFaces[] = { { 4, { 0, 1, 5, 4 } }, { 4, { 1, 2, 6, 5 } },
+                                 { 4, { 2, 3, 7, 6 } }, { 4, { 3, 0, 4, 7 } },
+                                 { 4, { 0, 3, 2, 1 } }, { 4, { 4, 5, 6, 7 } } };
+
+template<std::size_t N>
+void assignSides(std::vector<Side>& sides, const Side (&table)[N])
+{
+  sides.assign(table, table + N);
+}
+
+//fill <sides> with the sides of dimension <dimension> of a cell. The sides of
+//dimension 0 are the cell's vertices.
+void sidesOf(
+  smtk::mesh::CellType cellType,
+  int numVerts,
+  int dimension,
+  std::vector<Side>& sides)
+{
+  sides.clear();
+  if (dimension == 0)
+  {
+    for (int i = 0; i < numVerts; ++i)
+    {
+      sides.push_back(Side{ 1, { i, 0, 0, 0 } });
+    }
+    return;
+  }
+
+  if (dimension == 1)
+  {
+    switch (cellType)
+    {
+      case smtk::mesh::Triangle:
+        assignSides(sides, TriangleEdges);
+        break;
+      case smtk::mesh::Quad:
+        assignSides(sides, QuadEdges);
+        break;
+      case smtk::mesh::Polygon:
+        for (int i = 0; i < numVerts; ++i)
+        {
+          sides.push_back(Side{ 2, { i, (i + 1) % numVerts, 0, 0 } });
+        }
+        break;
+      case smtk::mesh::Tetrahedron:
+        assignSides(sides, TetrahedronEdges);
+        break;
+      case smtk::mesh::Pyramid:
+        assignSides(sides, PyramidEdges);
+        break;
+      case smtk::mesh::Wedge:
+        assignSides(sides, WedgeEdges);
+        break;
+      case smtk::mesh::Hexahedron:
+        assignSides(sides, HexahedronEdges);
+        break;
+      default:
+        break;
+    }
+  }
+  else if (dimension == 2)
+  {
+    switch (cellType)
+    {
+      case smtk::mesh::Tetrahedron:
+        assignSides(sides, TetrahedronFaces);
+        break;
+      case smtk::mesh::Pyramid:
+        assignSides(sides, PyramidFaces);
+        break;
+      case smtk::mesh::Wedge:
+        assignSides(sides, WedgeFaces);
+        break;
+      case smtk::mesh::Hexahedron:
+        assignSides(sides, HexahedronFaces);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+//the cell type used to represent a created side
+smtk::mesh::CellType sideType(int dimension, int size)
+{
+  if (dimension == 1)
+  {
+    return smtk::mesh::Line;
+  }
+  return size == 3 ? smtk::mesh::Triangle : (size == 4 ? smtk::mesh::Quad : smtk::mesh::Polygon);
+}
+
+//sides are identified by their sorted point indices
+typedef std::array<std::size_t, 4> SideKey;
+
+struct SideKeyHash
+{
+  std::size_t operator()(const SideKey& key) const
+  {
+    std::size_t seed = 0;
+    for (std::size_t value : key)
+    {
+      seed ^= std::hash<std::size_t>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+
+SideKey sideKey(const Storage& storage, std::size_t cell, const Side& side)
+{
+  SideKey key;
+  key.fill(std::numeric_limits<std::size_t>::max());
+  for (int i = 0; i < side.size; ++i)
+  {
+    key[i] = storage.pointIndex(cell, side.vertices[i]);
+  }
+  std::sort(key.begin(), key.begin() + side.size);
+  return key;
+}
+
+int dimensionOf(const Storage& storage, smtk::mesh::Handle handle)
+{
+  const Kind kind = Storage::kind(handle);
+  if (kind == Kind::Point)
+  {
+    return 0;
+  }
+  return kind == Kind::Cell ? storage.cellDimension(Storage::index(handle)) : -1;
+}
+
+//the point indices of a point (as a vertex cell) or a cell
+void pointsOf(const Storage& storage, smtk::mesh::Handle handle, std::vector<std::size_t>& points)
+{
+  points.clear();
+  if (Storage::kind(handle) == Kind::Point)
+  {
+    points.push_back(Storage::index(handle));
+    return;
+  }
+  const std::size_t cell = Storage::index(handle);
+  const int size = storage.cellSize(cell);
+  for (int i = 0; i < size; ++i)
+  {
+    points.push_back(storage.pointIndex(cell, i));
+  }
+}
+
+bool cellHasPoint(const Storage& storage, std::size_t cell, std::size_t point)
+{
+  const int size = storage.cellSize(cell);
+  for (int i = 0; i < size; ++i)
+  {
+    if (storage.pointIndex(cell, i) == point)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//append to <cells> the live cells of dimension <dimension> that use all of
+//the given points, in increasing order
+void cellsContaining(
+  const Storage& storage,
+  const std::size_t* points,
+  std::size_t numPoints,
+  int dimension,
+  std::vector<std::size_t>& cells)
+{
+  if (numPoints == 0 || points[0] >= storage.numberOfPoints())
+  {
+    return;
+  }
+  const std::size_t numCandidates = storage.numberOfCellsOfPoint(points[0]);
+  for (std::size_t i = 0; i < numCandidates; ++i)
+  {
+    const std::size_t candidate = storage.cellOfPoint(points[0], i);
+    if (
+      storage.cellDimension(candidate) != dimension ||
+      (!cells.empty() && cells.back() == candidate))
+    {
+      continue;
+    }
+    bool containsAll = true;
+    for (std::size_t j = 1; j < numPoints && containsAll; ++j)
+    {
+      containsAll = cellHasPoint(storage, candidate, points[j]);
+    }
+    if (containsAll)
+    {
+      cells.push_back(candidate);
+    }
+  }
+}
+
+//convert a mask over point indices into a range of point handles
+smtk::mesh::HandleRange pointsFromMask(const std::vector<bool>& mask)
+{
+  smtk::mesh::HandleRange result;
+  const std::size_t size = mask.size();
+  for (std::size_t i = 0; i < size;)
+  {
+    if (!mask[i])
+    {
+      ++i;
+      continue;
+    }
+    std::size_t j = i + 1;
+    while (j < size && mask[j])
+    {
+      ++j;
+    }
+    result.insert(result.end(), Storage::interval(Kind::Point, i, j - i));
+    i = j;
+  }
+  return result;
+}
+
+//mark the points used by the given points and cells
+void markPoints(
+  const Storage& storage,
+  const smtk::mesh::HandleRange& cells,
+  std::vector<bool>& mask)
+{
+  mask.assign(storage.numberOfPoints(), false);
+  for (const auto& interval : cells)
+  {
+    const Kind kind = Storage::kind(interval.lower());
+    const std::size_t first = Storage::index(interval.lower());
+    const std::size_t last = Storage::index(interval.upper());
+    if (kind == Kind::Point)
+    {
+      for (std::size_t point = first; point <= last && point < mask.size(); ++point)
+      {
+        mask[point] = true;
+      }
+    }
+    else if (kind == Kind::Cell)
+    {
+      for (std::size_t cell = first; cell <= last; ++cell)
+      {
+        const int size = storage.cellSize(cell);
+        for (int i = 0; i < size; ++i)
+        {
+          mask[storage.pointIndex(cell, i)] = true;
+        }
+      }
+    }
+  }
+}
+
+smtk::mesh::HandleRange handlesOfKind(const smtk::mesh::HandleRange& range, Kind kind)
+{
+  smtk::mesh::HandleRange all;
+  all.insert(Storage::interval(kind));
+  return range & all;
+}
+
+struct MeshSetData
+{
+  smtk::mesh::HandleRange entities;
+  std::string name;
+  bool hasName{ false };
+  int domain{ 0 };
+  int dirichlet{ 0 };
+  int neumann{ 0 };
+  bool hasDomain{ false };
+  bool hasDirichlet{ false };
+  bool hasNeumann{ false };
+  smtk::common::UUID id;
+  smtk::common::UUID association;
+  std::set<std::string> cellFields;
+  std::set<std::string> pointFields;
+};
+
+//Field values are held in one contiguous array for points and one for cells,
+//each indexed by the entity's index and holding <dimension> values per entity.
+struct FieldData
+{
+  std::size_t dimension;
+  smtk::mesh::FieldType type;
+  std::array<std::vector<unsigned char>, 2> values;
+  smtk::mesh::HandleRange defined;
+
+  std::size_t valueSize() const
+  {
+    return dimension *
+      (type == smtk::mesh::FieldType::Integer ? sizeof(int) : sizeof(double));
+  }
+
+  static int slot(smtk::mesh::Handle handle)
+  {
+    const Kind kind = Storage::kind(handle);
+    return kind == Kind::Point ? 0 : (kind == Kind::Cell ? 1 : -1);
+  }
+
+  bool read(const smtk::mesh::HandleRange& handles, void* data) const
+  {
+    if (!smtk::mesh::rangeContains(this->defined, handles))
+    {
+      return false;
+    }
+    const std::size_t size = this->valueSize();
+    unsigned char* out = static_cast<unsigned char*>(data);
+    for (const auto& interval : handles)
+    {
+      const int s = FieldData::slot(interval.lower());
+      const std::size_t count = interval.upper() - interval.lower() + 1;
+      std::memcpy(out, &this->values[s][Storage::index(interval.lower()) * size], count * size);
+      out += count * size;
+    }
+    return true;
+  }
+
+  bool write(const smtk::mesh::HandleRange& handles, const void* data)
+  {
+    const std::size_t size = this->valueSize();
+    const unsigned char* in = static_cast<const unsigned char*>(data);
+    for (const auto& interval : handles)
+    {
+      const int s = FieldData::slot(interval.lower());
+      if (s < 0)
+      {
+        return false;
+      }
+      const std::size_t count = interval.upper() - interval.lower() + 1;
+      const std::size_t end = (Storage::index(interval.upper()) + 1) * size;
+      if (this->values[s].size() < end)
+      {
+        this->values[s].resize(end);
+      }
+      std::memcpy(&this->values[s][Storage::index(interval.lower()) * size], in, count * size);
+      in += count * size;
+    }
+    this->defined += handles;
+    return true;
+  }
+};
+
+typedef std::map<std::string, FieldData> FieldMap;
+
+bool createField(
+  FieldMap& fields,
+  const std::string& name,
+  std::size_t dimension,
+  const smtk::mesh::FieldType& type,
+  const smtk::mesh::HandleRange& handles,
+  const void* data)
+{
+  if (dimension == 0 || type == smtk::mesh::FieldType::MaxFieldType)
+  {
+    return false;
+  }
+  auto it = fields.find(name);
+  if (it == fields.end())
+  {
+    FieldData field;
+    field.dimension = dimension;
+    field.type = type;
+    it = fields.emplace(name, std::move(field)).first;
+  }
+  else if (it->second.dimension != dimension || it->second.type != type)
+  {
+    //a field may not be redefined with a different layout
+    return false;
+  }
+  return it->second.write(handles, data);
+}
+
+const std::size_t numPointsPerCall = 65536; //selected so that buffer is ~1MB
+} // namespace
+
+struct Interface::Internals
+{
+  std::vector<MeshSetData> meshsets;
+  smtk::mesh::HandleRange liveMeshsets;
+  smtk::common::UUID rootId;
+  smtk::common::UUID rootAssociation;
+  FieldMap cellFields;
+  FieldMap pointFields;
+
+  MeshSetData* find(smtk::mesh::Handle handle)
+  {
+    if (
+      Storage::kind(handle) != Kind::MeshSet ||
+      !smtk::mesh::rangeContains(this->liveMeshsets, handle))
+    {
+      return nullptr;
+    }
+    return &this->meshsets[Storage::index(handle)];
+  }
+
+  //visit the live meshsets held by the given handle (only the root holds
+  //meshsets)
+  template<typename Functor>
+  void visitMeshsets(smtk::mesh::Handle handle, Functor functor)
+  {
+    if (handle != 0)
+    {
+      return;
+    }
+    for (const auto& interval : this->liveMeshsets)
+    {
+      for (smtk::mesh::Handle meshset = interval.lower(); meshset <= interval.upper(); ++meshset)
+      {
+        functor(meshset, this->meshsets[Storage::index(meshset)]);
+      }
+    }
+  }
+
+  //visit the live meshsets in the given range
+  template<typename Functor>
+  void visitMeshsets(const smtk::mesh::HandleRange& range, Functor functor)
+  {
+    smtk::mesh::HandleRange live = range & this->liveMeshsets;
+    for (const auto& interval : live)
+    {
+      for (smtk::mesh::Handle meshset = interval.lower(); meshset <= interval.upper(); ++meshset)
+      {
+        functor(meshset, this->meshsets[Storage::index(meshset)]);
+      }
+    }
+  }
+};
+
+//construct an empty interface instance
+smtk::mesh::native::InterfacePtr make_interface(IndexWidth width)
+{
+  return std::make_shared<smtk::mesh::native::Interface>(width);
+}
+
+Interface::Interface(IndexWidth width)
+  : m_storage(new Storage(width))
+  , m_internals(new Internals())
+{
+  m_alloc.reset(new smtk::mesh::native::Allocator(m_storage.get()));
+  m_bcAlloc.reset(new smtk::mesh::native::BufferedCellAllocator(m_storage.get()));
+  m_iAlloc.reset(new smtk::mesh::native::IncrementalAllocator(m_storage.get()));
+}
+
+Interface::~Interface() = default;
+
+bool Interface::isModified() const
+{
+  return m_modified;
+}
+
+smtk::mesh::AllocatorPtr Interface::allocator()
+{
+  //mark us as modified as the caller is going to add something to the database
+  m_modified = true;
+  return m_alloc;
+}
+
+smtk::mesh::BufferedCellAllocatorPtr Interface::bufferedCellAllocator()
+{
+  //mark us as modified as the caller is going to add something to the database
+  m_modified = true;
+  std::static_pointer_cast<smtk::mesh::native::BufferedCellAllocator>(m_bcAlloc)->clear();
+  return m_bcAlloc;
+}
+
+smtk::mesh::IncrementalAllocatorPtr Interface::incrementalAllocator()
+{
+  //mark us as modified as the caller is going to add something to the database
+  m_modified = true;
+  static_cast<smtk::mesh::native::IncrementalAllocator*>(m_iAlloc.get())->initialize();
+  return m_iAlloc;
+}
+
+smtk::mesh::ConnectivityStoragePtr Interface::connectivityStorage(
+  const smtk::mesh::HandleRange& cells)
+{
+  return smtk::mesh::ConnectivityStoragePtr(
+    new smtk::mesh::native::ConnectivityStorage(m_storage.get(), cells));
+}
+
+smtk::mesh::PointLocatorImplPtr Interface::pointLocator(const smtk::mesh::HandleRange& points)
+{
+  return smtk::mesh::PointLocatorImplPtr(new smtk::mesh::native::PointLocatorImpl(
+    m_storage.get(), handlesOfKind(points, Kind::Point)));
+}
+
+smtk::mesh::PointLocatorImplPtr Interface::pointLocator(
+  std::size_t numPoints,
+  const std::function<std::array<double, 3>(std::size_t)>& coordinates)
+{
+  if (numPoints == 0)
+  {
+    return smtk::mesh::PointLocatorImplPtr();
+  }
+  return smtk::mesh::PointLocatorImplPtr(
+    new smtk::mesh::native::PointLocatorImpl(numPoints, coordinates));
+}
+
+smtk::mesh::Handle Interface::getRoot() const
+{
+  return Storage::handle(Kind::Root, 0);
+}
+
+void Interface::registerQueries(smtk::mesh::Resource&) const {}
+
+bool Interface::createMesh(const smtk::mesh::HandleRange& cells, smtk::mesh::Handle& meshHandle)
+{
+  if (cells.empty())
+  {
+    return false;
+  }
+
+  //make sure the cells are actually points or live cells instead of meshsets.
+  //we currently don't want this allow adding sub meshsets
+  smtk::mesh::HandleRange points = handlesOfKind(cells, Kind::Point);
+  smtk::mesh::HandleRange cellsOnly = handlesOfKind(cells, Kind::Cell);
+  if (points.size() + cellsOnly.size() != cells.size())
+  {
+    return false;
+  }
+  if (
+    (!points.empty() && Storage::index(points.rbegin()->upper()) >= m_storage->numberOfPoints()) ||
+    !smtk::mesh::rangeContains(m_storage->cells(), cellsOnly))
+  {
+    return false;
+  }
+
+  MeshSetData meshset;
+  meshset.entities = cells;
+  meshHandle = Storage::handle(Kind::MeshSet, m_internals->meshsets.size());
+  m_internals->meshsets.push_back(std::move(meshset));
+  m_internals->liveMeshsets.insert(meshHandle);
+
+  m_modified = true;
+  return true;
+}
+
+std::size_t Interface::numMeshes(smtk::mesh::Handle handle) const
+{
+  return handle == this->getRoot() ? m_internals->liveMeshsets.size() : 0;
+}
+
+smtk::mesh::HandleRange Interface::getMeshsets(smtk::mesh::Handle handle) const
+{
+  return handle == this->getRoot() ? m_internals->liveMeshsets : smtk::mesh::HandleRange();
+}
+
+smtk::mesh::HandleRange Interface::getMeshsets(smtk::mesh::Handle handle, int dimension) const
+{
+  //add all meshsets that have at least a single cell of the given dimension
+  smtk::mesh::HandleRange cellsOfDim = this->cellsOfDimension(dimension);
+  smtk::mesh::HandleRange result;
+  m_internals->visitMeshsets(handle, [&](smtk::mesh::Handle meshset, const MeshSetData& data) {
+    if (smtk::mesh::rangesIntersect(data.entities, cellsOfDim))
+    {
+      result.insert(result.end(), smtk::mesh::HandleInterval(meshset, meshset));
+    }
+  });
+  return result;
+}
+
+//find all entity sets that have this exact name tag
+smtk::mesh::HandleRange Interface::getMeshsets(smtk::mesh::Handle handle, const std::string& name)
+  const
+{
+  smtk::mesh::HandleRange result;
+  m_internals->visitMeshsets(handle, [&](smtk::mesh::Handle meshset, const MeshSetData& data) {
+    if (data.hasName && data.name == name)
+    {
+      result.insert(result.end(), smtk::mesh::HandleInterval(meshset, meshset));
+    }
+  });
+  return result;
+}
+
+//find all entity sets that have this exact domain tag
+smtk::mesh::HandleRange Interface::getMeshsets(
+  smtk::mesh::Handle handle,
+  const smtk::mesh::Domain& domain) const
+{
+  smtk::mesh::HandleRange result;
+  m_internals->visitMeshsets(handle, [&](smtk::mesh::Handle meshset, const MeshSetData& data) {
+    if (data.hasDomain && data.domain == domain.value())
+    {
+      result.insert(result.end(), smtk::mesh::HandleInterval(meshset, meshset));
+    }
+  });
+  return result;
+}
+
+//find all entity sets that have this exact dirichlet tag
+smtk::mesh::HandleRange Interface::getMeshsets(
+  smtk::mesh::Handle handle,
+  const smtk::mesh::Dirichlet& dirichlet) const
+{
+  smtk::mesh::HandleRange result;
+  m_internals->visitMeshsets(handle, [&](smtk::mesh::Handle meshset, const MeshSetData& data) {
+    if (data.hasDirichlet && data.dirichlet == dirichlet.value())
+    {
+      result.insert(result.end(), smtk::mesh::HandleInterval(meshset, meshset));
+    }
+  });
+  return result;
+}
+
+//find all entity sets that have this exact neumann tag
+smtk::mesh::HandleRange Interface::getMeshsets(
+  smtk::mesh::Handle handle,
+  const smtk::mesh::Neumann& neumann) const
+{
+  smtk::mesh::HandleRange result;
+  m_internals->visitMeshsets(handle, [&](smtk::mesh::Handle meshset, const MeshSetData& data) {
+    if (data.hasNeumann && data.neumann == neumann.value())
+    {
+      result.insert(result.end(), smtk::mesh::HandleInterval(meshset, meshset));
+    }
+  });
+  return result;
+}
+
+smtk::mesh::HandleRange Interface::cellsOfDimension(int dimension) const
+{
+  smtk::mesh::HandleRange result;
+  if (dimension == 0)
+  {
+    result.insert(Storage::interval(Kind::Point));
+    return result;
+  }
+  for (int i = 1; i < smtk::mesh::CellType_MAX; ++i)
+  {
+    const smtk::mesh::CellType cellType = static_cast<smtk::mesh::CellType>(i);
+    if (Storage::dimension(cellType) == dimension)
+    {
+      result += m_storage->cells(cellType);
+    }
+  }
+  return result;
+}
+
+smtk::mesh::HandleRange Interface::cellsOf(const smtk::mesh::HandleRange& meshsets) const
+{
+  smtk::mesh::HandleRange result;
+  if (!meshsets.empty() && meshsets.begin()->lower() == this->getRoot())
+  {
+    //the root holds every point and cell
+    if (m_storage->numberOfPoints() > 0)
+    {
+      result.insert(Storage::interval(Kind::Point, 0, m_storage->numberOfPoints()));
+    }
+    result += m_storage->cells();
+  }
+  m_internals->visitMeshsets(
+    meshsets, [&](smtk::mesh::Handle, const MeshSetData& data) { result += data.entities; });
+  return result;
+}
+
+smtk::mesh::CellTypes Interface::typesOf(const smtk::mesh::HandleRange& cells) const
+{
+  smtk::mesh::CellTypes cellTypes;
+  smtk::mesh::HandleRange points;
+  points.insert(Storage::interval(Kind::Point));
+  cellTypes[smtk::mesh::Vertex] = smtk::mesh::rangesIntersect(cells, points);
+  for (int i = 1; i < smtk::mesh::CellType_MAX; ++i)
+  {
+    cellTypes[i] =
+      smtk::mesh::rangesIntersect(cells, m_storage->cells(static_cast<smtk::mesh::CellType>(i)));
+  }
+  return cellTypes;
+}
+
+//get all cells held by this range
+smtk::mesh::HandleRange Interface::getCells(const smtk::mesh::HandleRange& meshsets) const
+{
+  return this->cellsOf(meshsets);
+}
+
+//get all cells held by this range handle of a given cell type
+smtk::mesh::HandleRange Interface::getCells(
+  const smtk::mesh::HandleRange& meshsets,
+  smtk::mesh::CellType cellType) const
+{
+  if (cellType < smtk::mesh::Vertex || cellType >= smtk::mesh::CellType_MAX)
+  {
+    return smtk::mesh::HandleRange();
+  }
+  smtk::mesh::HandleRange cells = this->cellsOf(meshsets);
+  if (cellType == smtk::mesh::Vertex)
+  {
+    return handlesOfKind(cells, Kind::Point);
+  }
+  return cells & m_storage->cells(cellType);
+}
+
+//get all cells held by this range handle of a given cell type(s)
+smtk::mesh::HandleRange Interface::getCells(
+  const smtk::mesh::HandleRange& meshsets,
+  const smtk::mesh::CellTypes& cellTypes) const
+{
+  const std::size_t cellTypesToFind = cellTypes.count();
+  if (cellTypesToFind == cellTypes.size())
+  {
+    return this->getCells(meshsets);
+  }
+  else if (cellTypesToFind == 0)
+  {
+    return smtk::mesh::HandleRange();
+  }
+
+  smtk::mesh::HandleRange cells = this->cellsOf(meshsets);
+  smtk::mesh::HandleRange wanted;
+  if (cellTypes[smtk::mesh::Vertex])
+  {
+    wanted.insert(Storage::interval(Kind::Point));
+  }
+  for (int i = 1; i < smtk::mesh::CellType_MAX; ++i)
+  {
+    if (cellTypes[i])
+    {
+      wanted += m_storage->cells(static_cast<smtk::mesh::CellType>(i));
+    }
+  }
+  return cells & wanted;
+}
+
+//get all cells held by this range handle of a given dimension
+smtk::mesh::HandleRange Interface::getCells(
+  const smtk::mesh::HandleRange& meshsets,
+  smtk::mesh::DimensionType dim) const
+{
+  return this->cellsOf(meshsets) & this->cellsOfDimension(static_cast<int>(dim));
+}
+
+//get all points held by this range of cells. We don't hold higher order
+//points, so boundary_only has no effect.
+smtk::mesh::HandleRange Interface::getPoints(
+  const smtk::mesh::HandleRange& cells,
+  bool /*boundary_only*/) const
+{
+  std::vector<bool> mask;
+  markPoints(*m_storage, cells, mask);
+  return pointsFromMask(mask);
+}
+
+namespace
+{
+template<typename T>
+bool copyCoordinates(const Storage& storage, const smtk::mesh::HandleRange& points, T* xyz)
+{
+  const std::vector<double>& x = storage.x();
+  const std::vector<double>& y = storage.y();
+  const std::vector<double>& z = storage.z();
+  for (const auto& interval : points)
+  {
+    const std::size_t last = Storage::index(interval.upper());
+    if (Storage::kind(interval.lower()) != Kind::Point || last >= storage.numberOfPoints())
+    {
+      return false;
+    }
+    for (std::size_t i = Storage::index(interval.lower()); i <= last; ++i)
+    {
+      *xyz++ = static_cast<T>(x[i]);
+      *xyz++ = static_cast<T>(y[i]);
+      *xyz++ = static_cast<T>(z[i]);
+    }
+  }
+  return true;
+}
+
+template<typename T>
+bool assignCoordinates(Storage& storage, const smtk::mesh::HandleRange& points, const T* xyz)
+{
+  std::vector<double>& x = storage.x();
+  std::vector<double>& y = storage.y();
+  std::vector<double>& z = storage.z();
+  for (const auto& interval : points)
+  {
+    const std::size_t last = Storage::index(interval.upper());
+    if (Storage::kind(interval.lower()) != Kind::Point || last >= storage.numberOfPoints())
+    {
+      return false;
+    }
+    for (std::size_t i = Storage::index(interval.lower()); i <= last; ++i)
+    {
+      x[i] = static_cast<double>(*xyz++);
+      y[i] = static_cast<double>(*xyz++);
+      z[i] = static_cast<double>(*xyz++);
+    }
+  }
+  return true;
+}
+} // namespace
+
+bool Interface::getCoordinates(const smtk::mesh::HandleRange& points, double* xyz) const
+{
+  return copyCoordinates(*m_storage, points, xyz);
+}
+
+bool Interface::getCoordinates(const smtk::mesh::HandleRange& points, float* xyz) const
+{
+  return copyCoordinates(*m_storage, points, xyz);
+}
+
+bool Interface::setCoordinates(const smtk::mesh::HandleRange& points, const double* xyz)
+{
+  const bool set = assignCoordinates(*m_storage, points, xyz);
+  m_modified = m_modified || set;
+  return set;
+}
+
+bool Interface::setCoordinates(const smtk::mesh::HandleRange& points, const float* xyz)
+{
+  const bool set = assignCoordinates(*m_storage, points, xyz);
+  m_modified = m_modified || set;
+  return set;
+}
+
+std::string Interface::name(const smtk::mesh::Handle& meshset) const
+{
+  const MeshSetData* data = m_internals->find(meshset);
+  return data ? data->name : std::string();
+}
+
+bool Interface::setName(const smtk::mesh::Handle& meshset, const std::string& name)
+{
+  MeshSetData* data = m_internals->find(meshset);
+  if (!data)
+  {
+    return false;
+  }
+  data->name = name;
+  data->hasName = true;
+  m_modified = true;
+  return true;
+}
+
+std::vector<std::string> Interface::computeNames(const smtk::mesh::HandleRange& meshsets) const
+{
+  std::set<std::string> unique_names;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, const MeshSetData& data) {
+    if (data.hasName)
+    {
+      unique_names.insert(data.name);
+    }
+  });
+  //return a vector of the unique names
+  return std::vector<std::string>(unique_names.begin(), unique_names.end());
+}
+
+std::vector<smtk::mesh::Domain> Interface::computeDomainValues(
+  const smtk::mesh::HandleRange& meshsets) const
+{
+  std::set<int> values;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, const MeshSetData& data) {
+    if (data.hasDomain)
+    {
+      values.insert(data.domain);
+    }
+  });
+  return std::vector<smtk::mesh::Domain>(values.begin(), values.end());
+}
+
+std::vector<smtk::mesh::Dirichlet> Interface::computeDirichletValues(
+  const smtk::mesh::HandleRange& meshsets) const
+{
+  std::set<int> values;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, const MeshSetData& data) {
+    if (data.hasDirichlet)
+    {
+      values.insert(data.dirichlet);
+    }
+  });
+  return std::vector<smtk::mesh::Dirichlet>(values.begin(), values.end());
+}
+
+std::vector<smtk::mesh::Neumann> Interface::computeNeumannValues(
+  const smtk::mesh::HandleRange& meshsets) const
+{
+  std::set<int> values;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, const MeshSetData& data) {
+    if (data.hasNeumann)
+    {
+      values.insert(data.neumann);
+    }
+  });
+  return std::vector<smtk::mesh::Neumann>(values.begin(), values.end());
+}
+
+/**\brief Return the set of all UUIDs set on all entities in the meshsets.
+  *
+  */
+smtk::common::UUIDArray Interface::computeModelEntities(
+  const smtk::mesh::HandleRange& meshsets) const
+{
+  smtk::common::UUIDArray result;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, const MeshSetData& data) {
+    if (data.association)
+    {
+      result.push_back(data.association);
+    }
+  });
+  return result;
+}
+
+smtk::mesh::TypeSet Interface::computeTypes(const smtk::mesh::HandleRange& range) const
+{
+  smtk::mesh::HandleRange meshes = handlesOfKind(range, Kind::MeshSet);
+  smtk::mesh::HandleRange cells = handlesOfKind(range, Kind::Point);
+  cells += handlesOfKind(range, Kind::Cell);
+
+  //compute the type of the meshes from the union of their cells
+  smtk::mesh::CellTypes ctypes = this->typesOf(this->cellsOf(meshes));
+  ctypes |= this->typesOf(cells);
+
+  const bool hasM = !(meshes.empty());
+  const bool hasC = ctypes.any();
+  return smtk::mesh::TypeSet(ctypes, hasM, hasC);
+}
+
+smtk::mesh::HandleRange Interface::sidesOfCells(
+  const smtk::mesh::HandleRange& cells,
+  int dimension,
+  bool shellOnly) const
+{
+  Storage& storage = *m_storage;
+
+  //count the uses of each side, remembering the first cell that uses it so the
+  //side can be created with that cell's orientation
+  struct Use
+  {
+    std::size_t cell;
+    Side side;
+    std::size_t count;
+  };
+  std::unordered_map<SideKey, std::size_t, SideKeyHash> indices;
+  std::vector<Use> uses;
+  std::vector<Side> sides;
+  for (const auto& interval : cells)
+  {
+    if (Storage::kind(interval.lower()) != Kind::Cell)
+    {
+      continue;
+    }
+    const std::size_t last = Storage::index(interval.upper());
+    for (std::size_t cell = Storage::index(interval.lower()); cell <= last; ++cell)
+    {
+      sidesOf(storage.cellType(cell), storage.cellSize(cell), dimension, sides);
+      for (const Side& side : sides)
+      {
+        auto inserted = indices.emplace(sideKey(storage, cell, side), uses.size());
+        if (inserted.second)
+        {
+          uses.push_back(Use{ cell, side, 0 });
+        }
+        ++uses[inserted.first->second].count;
+      }
+    }
+  }
+
+  //sides of dimension 0 are points. Others are found among the existing cells
+  //or are created, grouped by cell type so the new cells are contiguous.
+  smtk::mesh::HandleRange result;
+  std::map<int, std::vector<std::size_t>> toCreate;
+  std::vector<std::size_t> points;
+  std::vector<std::size_t> existing;
+  for (const Use& use : uses)
+  {
+    if (shellOnly && use.count != 1)
+    {
+      continue;
+    }
+    points.clear();
+    for (int i = 0; i < use.side.size; ++i)
+    {
+      points.push_back(storage.pointIndex(use.cell, use.side.vertices[i]));
+    }
+    if (dimension == 0)
+    {
+      result.insert(Storage::handle(Kind::Point, points[0]));
+      continue;
+    }
+
+    existing.clear();
+    cellsContaining(storage, points.data(), points.size(), dimension, existing);
+    auto match = std::find_if(existing.begin(), existing.end(), [&](std::size_t cell) {
+      return storage.cellSize(cell) == use.side.size;
+    });
+    if (match != existing.end())
+    {
+      result.insert(Storage::handle(Kind::Cell, *match));
+    }
+    else
+    {
+      std::vector<std::size_t>& group = toCreate[use.side.size];
+      group.insert(group.end(), points.begin(), points.end());
+    }
+  }
+
+  for (const auto& group : toCreate)
+  {
+    const int size = group.first;
+    const std::size_t numberOfCells = group.second.size() / size;
+    std::size_t first;
+    if (!storage.allocateCells(sideType(dimension, size), numberOfCells, size, first))
+    {
+      continue;
+    }
+    std::size_t index = 0;
+    for (std::size_t cell = first; cell < first + numberOfCells; ++cell)
+    {
+      for (int i = 0; i < size; ++i)
+      {
+        storage.setPointIndex(cell, i, group.second[index++]);
+      }
+    }
+    result.insert(Storage::interval(Kind::Cell, first, numberOfCells));
+    m_modified = true;
+  }
+  storage.connectivityModified();
+
+  return result;
+}
+
+bool Interface::computeShell(const smtk::mesh::HandleRange& meshes, smtk::mesh::HandleRange& shell)
+  const
+{
+  //step 1 get all the highest dimension cells for the meshes
+  smtk::mesh::HandleRange allCells = this->cellsOf(meshes);
+  smtk::mesh::HandleRange cells;
+  int dimension = 4;
+  while (cells.empty() && dimension > 0)
+  {
+    --dimension;
+    cells = allCells & this->cellsOfDimension(dimension);
+  }
+
+  if (cells.empty() || dimension == 0)
+  {
+    return false;
+  }
+
+  //step 2 the shell is made of the sides used by exactly one of those cells
+  shell = this->sidesOfCells(cells, dimension - 1, true);
+  return true;
+}
+
+bool Interface::computeAdjacenciesOfDimension(
+  const smtk::mesh::HandleRange& meshes,
+  int dimension,
+  smtk::mesh::HandleRange& adj) const
+{
+  if (dimension < smtk::mesh::Dims0 || dimension >= smtk::mesh::DimensionType_MAX)
+  {
+    return false;
+  }
+
+  smtk::mesh::HandleRange cells = this->cellsOf(meshes);
+
+  adj.clear();
+  std::vector<std::size_t> points;
+  std::vector<std::size_t> containing;
+  for (int d = 0; d < smtk::mesh::DimensionType_MAX; ++d)
+  {
+    smtk::mesh::HandleRange cellsOfDim = cells & this->cellsOfDimension(d);
+    if (cellsOfDim.empty())
+    {
+      continue;
+    }
+
+    if (d == dimension)
+    {
+      adj += cellsOfDim;
+    }
+    else if (dimension == 0)
+    {
+      adj += this->getPoints(cellsOfDim);
+    }
+    else if (dimension < d)
+    {
+      adj += this->sidesOfCells(cellsOfDim, dimension, false);
+    }
+    else
+    {
+      //higher dimension adjacencies are the existing cells that use all of
+      //a cell's points
+      for (auto i = smtk::mesh::rangeElementsBegin(cellsOfDim);
+           i != smtk::mesh::rangeElementsEnd(cellsOfDim);
+           ++i)
+      {
+        pointsOf(*m_storage, *i, points);
+        containing.clear();
+        cellsContaining(*m_storage, points.data(), points.size(), dimension, containing);
+        for (std::size_t cell : containing)
+        {
+          adj.insert(Storage::handle(Kind::Cell, cell));
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool Interface::canonicalIndex(
+  const smtk::mesh::Handle& cellId,
+  smtk::mesh::Handle& parent,
+  int& canonicalIndex) const
+{
+  const int dimension = dimensionOf(*m_storage, cellId);
+  if (dimension < 0 || dimension >= 3)
+  {
+    return false;
+  }
+
+  // Access the cell's parent cell
+  std::vector<std::size_t> points;
+  pointsOf(*m_storage, cellId, points);
+  std::vector<std::size_t> parents;
+  cellsContaining(*m_storage, points.data(), points.size(), dimension + 1, parents);
+
+  // Exit early if the cell's parent was not found
+  if (parents.empty())
+  {
+    return false;
+  }
+
+  // Assign the parent handle
+  const std::size_t parentCell = parents[0];
+  parent = Storage::handle(Kind::Cell, parentCell);
+
+  // Find the side of the parent with the cell's points
+  std::sort(points.begin(), points.end());
+  std::vector<Side> sides;
+  sidesOf(
+    m_storage->cellType(parentCell), m_storage->cellSize(parentCell), dimension, sides);
+  for (std::size_t i = 0; i < sides.size(); ++i)
+  {
+    if (static_cast<std::size_t>(sides[i].size) != points.size())
+    {
+      continue;
+    }
+    SideKey key = sideKey(*m_storage, parentCell, sides[i]);
+    if (std::equal(points.begin(), points.end(), key.begin()))
+    {
+      canonicalIndex = static_cast<int>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Interface::mergeCoincidentContactPoints(
+  const smtk::mesh::HandleRange& meshes,
+  double tolerance)
+{
+  if (meshes.empty())
+  {
+    //I can't see a reason why we should consider a merge of nothing to be a
+    //failure. So we return true.
+    return true;
+  }
+
+  Storage& storage = *m_storage;
+  const std::vector<double>& x = storage.x();
+  const std::vector<double>& y = storage.y();
+  const std::vector<double>& z = storage.z();
+
+  //bin the points so that coincident points are found among neighboring bins
+  typedef std::array<long long, 3> BinKey;
+  struct BinKeyHash
+  {
+    std::size_t operator()(const BinKey& key) const
+    {
+      std::size_t seed = 0;
+      for (long long value : key)
+      {
+        seed ^= std::hash<long long>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      }
+      return seed;
+    }
+  };
+  std::unordered_map<BinKey, std::vector<std::size_t>, BinKeyHash> bins;
+  const double binSize = tolerance > 0. ? tolerance : 1.;
+  const double sqTolerance = tolerance * tolerance;
+
+  std::vector<std::size_t> remap;
+  bool merged = false;
+  smtk::mesh::HandleRange points = this->getPoints(this->cellsOf(meshes));
+  for (auto i = smtk::mesh::rangeElementsBegin(points); i != smtk::mesh::rangeElementsEnd(points);
+       ++i)
+  {
+    const std::size_t p = Storage::index(*i);
+    const BinKey key = { static_cast<long long>(std::floor(x[p] / binSize)),
+                         static_cast<long long>(std::floor(y[p] / binSize)),
+                         static_cast<long long>(std::floor(z[p] / binSize)) };
+
+    bool found = false;
+    for (long long dx = -1; dx <= 1 && !found; ++dx)
+    {
+      for (long long dy = -1; dy <= 1 && !found; ++dy)
+      {
+        for (long long dz = -1; dz <= 1 && !found; ++dz)
+        {
+          auto bin = bins.find(BinKey{ key[0] + dx, key[1] + dy, key[2] + dz });
+          if (bin == bins.end())
+          {
+            continue;
+          }
+          for (std::size_t q : bin->second)
+          {
+            const double sqLen = (x[p] - x[q]) * (x[p] - x[q]) + (y[p] - y[q]) * (y[p] - y[q]) +
+              (z[p] - z[q]) * (z[p] - z[q]);
+            if (sqLen <= sqTolerance)
+            {
+              if (!merged)
+              {
+                remap.resize(storage.numberOfPoints());
+                for (std::size_t j = 0; j < remap.size(); ++j)
+                {
+                  remap[j] = j;
+                }
+                merged = true;
+              }
+              remap[p] = q;
+              found = true;
+              break;
+            }
+          }
+        }
+      }
+    }
+    if (!found)
+    {
+      bins[key].push_back(p);
+    }
+  }
+
+  if (!merged)
+  {
+    return true;
+  }
+
+  //replace the merged points in the connectivity of every cell
+  for (const auto& interval : storage.cells())
+  {
+    const std::size_t last = Storage::index(interval.upper());
+    for (std::size_t cell = Storage::index(interval.lower()); cell <= last; ++cell)
+    {
+      const int size = storage.cellSize(cell);
+      for (int j = 0; j < size; ++j)
+      {
+        const std::size_t p = storage.pointIndex(cell, j);
+        if (remap[p] != p)
+        {
+          storage.setPointIndex(cell, j, remap[p]);
+        }
+      }
+    }
+  }
+  storage.connectivityModified();
+
+  //and in meshsets that hold the merged points as vertex cells
+  for (auto& data : m_internals->meshsets)
+  {
+    smtk::mesh::HandleRange vertices = handlesOfKind(data.entities, Kind::Point);
+    for (auto i = smtk::mesh::rangeElementsBegin(vertices);
+         i != smtk::mesh::rangeElementsEnd(vertices);
+         ++i)
+    {
+      const std::size_t p = Storage::index(*i);
+      if (remap[p] != p)
+      {
+        data.entities.erase(*i);
+        data.entities.insert(Storage::handle(Kind::Point, remap[p]));
+      }
+    }
+  }
+
+  m_modified = true;
+  return true;
+}
+
+smtk::mesh::HandleRange Interface::neighbors(const smtk::mesh::Handle& cellId) const
+{
+  const int dimension = dimensionOf(*m_storage, cellId);
+  if (dimension <= 0)
+  {
+    return smtk::mesh::HandleRange();
+  }
+
+  // Neighbors share one of the cell's boundaries
+  const std::size_t cell = Storage::index(cellId);
+  std::vector<Side> sides;
+  sidesOf(m_storage->cellType(cell), m_storage->cellSize(cell), dimension - 1, sides);
+
+  smtk::mesh::HandleRange neighborsRange;
+  std::vector<std::size_t> points;
+  std::vector<std::size_t> neighbors;
+  for (const Side& side : sides)
+  {
+    points.clear();
+    for (int i = 0; i < side.size; ++i)
+    {
+      points.push_back(m_storage->pointIndex(cell, side.vertices[i]));
+    }
+    neighbors.clear();
+    cellsContaining(*m_storage, points.data(), points.size(), dimension, neighbors);
+    for (std::size_t neighbor : neighbors)
+    {
+      neighborsRange.insert(Storage::handle(Kind::Cell, neighbor));
+    }
+  }
+  neighborsRange.erase(cellId);
+
+  return neighborsRange;
+}
+
+std::size_t Interface::connectivityRevision() const
+{
+  return m_storage->revision();
+}
+
+bool Interface::setDomain(const smtk::mesh::HandleRange& meshsets, const smtk::mesh::Domain& domain)
+  const
+{
+  if (meshsets.empty())
+  {
+    return true;
+  }
+
+  bool tagged = false;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, MeshSetData& data) {
+    data.domain = domain.value();
+    data.hasDomain = tagged = true;
+  });
+  if (tagged)
+  {
+    m_modified = true;
+  }
+  return tagged;
+}
+
+bool Interface::setDirichlet(
+  const smtk::mesh::HandleRange& meshsets,
+  const smtk::mesh::Dirichlet& dirichlet) const
+{
+  if (meshsets.empty())
+  {
+    return true;
+  }
+
+  bool tagged = false;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, MeshSetData& data) {
+    data.dirichlet = dirichlet.value();
+    data.hasDirichlet = tagged = true;
+  });
+  if (tagged)
+  {
+    m_modified = true;
+  }
+  return tagged;
+}
+
+bool Interface::setNeumann(
+  const smtk::mesh::HandleRange& meshsets,
+  const smtk::mesh::Neumann& neumann) const
+{
+  if (meshsets.empty())
+  {
+    return true;
+  }
+
+  bool tagged = false;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, MeshSetData& data) {
+    data.neumann = neumann.value();
+    data.hasNeumann = tagged = true;
+  });
+  if (tagged)
+  {
+    m_modified = true;
+  }
+  return tagged;
+}
+
+/**\brief Set the id for a meshset to \a id.
+  */
+bool Interface::setId(const smtk::mesh::Handle& meshset, const smtk::common::UUID& id) const
+{
+  if (!id)
+  {
+    return false;
+  }
+
+  if (meshset == this->getRoot())
+  {
+    m_internals->rootId = id;
+  }
+  else
+  {
+    MeshSetData* data = m_internals->find(meshset);
+    if (!data)
+    {
+      return false;
+    }
+    data->id = id;
+  }
+  m_modified = true;
+  return true;
+}
+
+/**\brief Get the id for a meshset.
+  */
+smtk::common::UUID Interface::getId(const smtk::mesh::Handle& meshset) const
+{
+  if (meshset == this->getRoot())
+  {
+    return m_internals->rootId;
+  }
+  const MeshSetData* data = m_internals->find(meshset);
+  return data ? data->id : smtk::common::UUID::null();
+}
+
+/**\brief Find a mesh entity using its id.
+  *
+  */
+bool Interface::findById(
+  const smtk::mesh::Handle& root,
+  const smtk::common::UUID& id,
+  smtk::mesh::Handle& meshset) const
+{
+  if (!id)
+  {
+    return false;
+  }
+
+  bool found = false;
+  m_internals->visitMeshsets(root, [&](smtk::mesh::Handle handle, const MeshSetData& data) {
+    if (!found && data.id == id)
+    {
+      meshset = handle;
+      found = true;
+    }
+  });
+
+  if (!found && root == this->getRoot() && m_internals->rootId == id)
+  {
+    meshset = root;
+    found = true;
+  }
+  return found;
+}
+
+/**\brief Set the model entity assigned to each meshset member to \a ent.
+  */
+bool Interface::setAssociation(
+  const smtk::common::UUID& modelUUID,
+  const smtk::mesh::HandleRange& range) const
+{
+  if (range.empty() || !modelUUID)
+  { //if empty range or invalid uuid
+    return false;
+  }
+
+  bool tagged = false;
+  m_internals->visitMeshsets(range, [&](smtk::mesh::Handle, MeshSetData& data) {
+    data.association = modelUUID;
+    tagged = true;
+  });
+  if (tagged)
+  {
+    m_modified = true;
+  }
+  return tagged;
+}
+
+/**\brief Find mesh entities associated with the given model entity.
+  *
+  */
+smtk::mesh::HandleRange Interface::findAssociations(
+  const smtk::mesh::Handle& root,
+  const smtk::common::UUID& modelUUID) const
+{
+  smtk::mesh::HandleRange result;
+  if (!modelUUID)
+  {
+    return result;
+  }
+
+  m_internals->visitMeshsets(root, [&](smtk::mesh::Handle meshset, const MeshSetData& data) {
+    if (data.association == modelUUID)
+    {
+      result.insert(result.end(), smtk::mesh::HandleInterval(meshset, meshset));
+    }
+  });
+  return result;
+}
+
+// brief Set the model entity assigned to the root of this interface.
+//
+bool Interface::setRootAssociation(const smtk::common::UUID& modelUUID) const
+{
+  if (!modelUUID)
+  {
+    return false;
+  }
+
+  m_internals->rootAssociation = modelUUID;
+  m_modified = true;
+  return true;
+}
+
+/// brief Get the model entity assigned to the root of this interface.
+//
+smtk::common::UUID Interface::rootAssociation() const
+{
+  return m_internals->rootAssociation;
+}
+
+//create a data set named <name> with <dimension> values for each cell in
+//<meshsets>, and populate it with <data>
+bool Interface::createCellField(
+  const smtk::mesh::HandleRange& meshsets,
+  const std::string& name,
+  std::size_t dimension,
+  const smtk::mesh::FieldType& type,
+  const void* data)
+{
+  if (meshsets.empty())
+  {
+    // If there are no meshsets, then we return with failure
+    return false;
+  }
+
+  smtk::mesh::HandleRange cells = this->cellsOf(meshsets);
+  if (cells.empty())
+  {
+    // If there are no cells, then there we return with failure.
+    return false;
+  }
+
+  if (!createField(m_internals->cellFields, name, dimension, type, cells, data))
+  {
+    return false;
+  }
+
+  // Mark the meshsets as having the field
+  m_internals->visitMeshsets(
+    meshsets, [&](smtk::mesh::Handle, MeshSetData& meshset) { meshset.cellFields.insert(name); });
+
+  m_modified = true;
+  return true;
+}
+
+//get the dimension of a dataset.
+int Interface::getCellFieldDimension(const smtk::mesh::CellFieldTag& cfTag) const
+{
+  auto it = m_internals->cellFields.find(cfTag.name());
+  return it == m_internals->cellFields.end() ? 0 : static_cast<int>(it->second.dimension);
+}
+
+//get the type of a dataset.
+smtk::mesh::FieldType Interface::getCellFieldType(const smtk::mesh::CellFieldTag& cfTag) const
+{
+  auto it = m_internals->cellFields.find(cfTag.name());
+  return it == m_internals->cellFields.end() ? smtk::mesh::FieldType::MaxFieldType
+                                             : it->second.type;
+}
+
+//find all mesh sets that have this data set
+smtk::mesh::HandleRange Interface::getMeshsets(
+  smtk::mesh::Handle handle,
+  const smtk::mesh::CellFieldTag& cfTag) const
+{
+  smtk::mesh::HandleRange result;
+  m_internals->visitMeshsets(handle, [&](smtk::mesh::Handle meshset, const MeshSetData& data) {
+    if (data.cellFields.count(cfTag.name()))
+    {
+      result.insert(result.end(), smtk::mesh::HandleInterval(meshset, meshset));
+    }
+  });
+  return result;
+}
+
+bool Interface::hasCellField(
+  const smtk::mesh::HandleRange& meshsets,
+  const smtk::mesh::CellFieldTag& cfTag) const
+{
+  if (meshsets.empty())
+  {
+    // If there are no meshsets, then we return with failure
+    return false;
+  }
+
+  bool hasField = true;
+  std::size_t visited = 0;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, const MeshSetData& data) {
+    hasField = hasField && data.cellFields.count(cfTag.name()) != 0;
+    ++visited;
+  });
+  return hasField && visited == meshsets.size();
+}
+
+bool Interface::getCellField(
+  const smtk::mesh::HandleRange& meshsets,
+  const smtk::mesh::CellFieldTag& cfTag,
+  void* field) const
+{
+  if (meshsets.empty())
+  {
+    // If there are no meshsets, then we return with failure
+    return false;
+  }
+
+  return this->getField(this->cellsOf(meshsets), cfTag, field);
+}
+
+bool Interface::setCellField(
+  const smtk::mesh::HandleRange& meshsets,
+  const smtk::mesh::CellFieldTag& cfTag,
+  const void* field)
+{
+  if (meshsets.empty())
+  {
+    // If there are no meshsets, then we return with failure
+    return false;
+  }
+
+  return this->setField(this->cellsOf(meshsets), cfTag, field);
+}
+
+bool Interface::getField(
+  const smtk::mesh::HandleRange& cells,
+  const smtk::mesh::CellFieldTag& cfTag,
+  void* field) const
+{
+  if (cells.empty())
+  {
+    // If there are no cells, then there we return with failure.
+    return false;
+  }
+
+  auto it = m_internals->cellFields.find(cfTag.name());
+  return it != m_internals->cellFields.end() && it->second.read(cells, field);
+}
+
+bool Interface::setField(
+  const smtk::mesh::HandleRange& cells,
+  const smtk::mesh::CellFieldTag& cfTag,
+  const void* field)
+{
+  if (cells.empty())
+  {
+    // If there are no cells, then there we return with failure.
+    return false;
+  }
+
+  auto it = m_internals->cellFields.find(cfTag.name());
+  m_modified = (it != m_internals->cellFields.end() && it->second.write(cells, field));
+  return m_modified;
+}
+
+std::set<smtk::mesh::CellFieldTag> Interface::computeCellFieldTags(
+  const smtk::mesh::Handle& handle) const
+{
+  std::set<smtk::mesh::CellFieldTag> cellFieldTags;
+  auto collect = [&](smtk::mesh::Handle, const MeshSetData& data) {
+    for (const auto& name : data.cellFields)
+    {
+      cellFieldTags.insert(smtk::mesh::CellFieldTag(name));
+    }
+  };
+  m_internals->visitMeshsets(handle, collect);
+  m_internals->visitMeshsets(smtk::mesh::HandleRange(smtk::mesh::HandleInterval(handle)), collect);
+  return cellFieldTags;
+}
+
+bool Interface::deleteCellField(
+  const smtk::mesh::CellFieldTag& cfTag,
+  const smtk::mesh::HandleRange& meshsets)
+{
+  if (meshsets.empty())
+  {
+    return true;
+  }
+
+  auto it = m_internals->cellFields.find(cfTag.name());
+  if (it == m_internals->cellFields.end())
+  {
+    return false;
+  }
+
+  // Delete the data from the cells and the data flag from the meshsets
+  it->second.defined -= this->cellsOf(meshsets);
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, MeshSetData& data) {
+    data.cellFields.erase(cfTag.name());
+  });
+  return true;
+}
+
+//create a data set named <name> with <dimension> values for each point in
+//<meshsets>, and populate it with <data>
+bool Interface::createPointField(
+  const smtk::mesh::HandleRange& meshsets,
+  const std::string& name,
+  std::size_t dimension,
+  const smtk::mesh::FieldType& type,
+  const void* data)
+{
+  if (meshsets.empty())
+  {
+    // If there are no meshsets, then we return with failure
+    return false;
+  }
+
+  smtk::mesh::HandleRange points = this->getPoints(this->cellsOf(meshsets));
+  if (points.empty())
+  {
+    // If there are no points, then there we return with failure.
+    return false;
+  }
+
+  if (!createField(m_internals->pointFields, name, dimension, type, points, data))
+  {
+    return false;
+  }
+
+  // Mark the meshsets as having the field
+  m_internals->visitMeshsets(
+    meshsets, [&](smtk::mesh::Handle, MeshSetData& meshset) { meshset.pointFields.insert(name); });
+
+  m_modified = true;
+  return true;
+}
+
+//get the dimension of a dataset.
+int Interface::getPointFieldDimension(const smtk::mesh::PointFieldTag& pfTag) const
+{
+  auto it = m_internals->pointFields.find(pfTag.name());
+  return it == m_internals->pointFields.end() ? 0 : static_cast<int>(it->second.dimension);
+}
+
+//get the type of a dataset.
+smtk::mesh::FieldType Interface::getPointFieldType(const smtk::mesh::PointFieldTag& pfTag) const
+{
+  auto it = m_internals->pointFields.find(pfTag.name());
+  return it == m_internals->pointFields.end() ? smtk::mesh::FieldType::MaxFieldType
+                                              : it->second.type;
+}
+
+//find all mesh sets that have this data set
+smtk::mesh::HandleRange Interface::getMeshsets(
+  smtk::mesh::Handle handle,
+  const smtk::mesh::PointFieldTag& pfTag) const
+{
+  smtk::mesh::HandleRange result;
+  m_internals->visitMeshsets(handle, [&](smtk::mesh::Handle meshset, const MeshSetData& data) {
+    if (data.pointFields.count(pfTag.name()))
+    {
+      result.insert(result.end(), smtk::mesh::HandleInterval(meshset, meshset));
+    }
+  });
+  return result;
+}
+
+bool Interface::hasPointField(
+  const smtk::mesh::HandleRange& meshsets,
+  const smtk::mesh::PointFieldTag& pfTag) const
+{
+  if (meshsets.empty())
+  {
+    // If there are no meshsets, then we return with failure
+    return false;
+  }
+
+  bool hasField = true;
+  std::size_t visited = 0;
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, const MeshSetData& data) {
+    hasField = hasField && data.pointFields.count(pfTag.name()) != 0;
+    ++visited;
+  });
+  return hasField && visited == meshsets.size();
+}
+
+bool Interface::getPointField(
+  const smtk::mesh::HandleRange& meshsets,
+  const smtk::mesh::PointFieldTag& pfTag,
+  void* field) const
+{
+  if (meshsets.empty())
+  {
+    // If there are no meshsets, then we return with failure
+    return false;
+  }
+
+  return this->getField(this->getPoints(this->cellsOf(meshsets)), pfTag, field);
+}
+
+bool Interface::setPointField(
+  const smtk::mesh::HandleRange& meshsets,
+  const smtk::mesh::PointFieldTag& pfTag,
+  const void* field)
+{
+  if (meshsets.empty())
+  {
+    // If there are no meshsets, then we return with failure
+    return false;
+  }
+
+  return this->setField(this->getPoints(this->cellsOf(meshsets)), pfTag, field);
+}
+
+bool Interface::getField(
+  const smtk::mesh::HandleRange& points,
+  const smtk::mesh::PointFieldTag& pfTag,
+  void* field) const
+{
+  if (points.empty())
+  {
+    // If there are no points, then there we return with failure.
+    return false;
+  }
+
+  auto it = m_internals->pointFields.find(pfTag.name());
+  return it != m_internals->pointFields.end() && it->second.read(points, field);
+}
+
+bool Interface::setField(
+  const smtk::mesh::HandleRange& points,
+  const smtk::mesh::PointFieldTag& pfTag,
+  const void* field)
+{
+  if (points.empty())
+  {
+    // If there are no points, then there we return with failure.
+    return false;
+  }
+
+  auto it = m_internals->pointFields.find(pfTag.name());
+  m_modified = (it != m_internals->pointFields.end() && it->second.write(points, field));
+  return m_modified;
+}
+
+std::set<smtk::mesh::PointFieldTag> Interface::computePointFieldTags(
+  const smtk::mesh::Handle& handle) const
+{
+  std::set<smtk::mesh::PointFieldTag> pointFieldTags;
+  auto collect = [&](smtk::mesh::Handle, const MeshSetData& data) {
+    for (const auto& name : data.pointFields)
+    {
+      pointFieldTags.insert(smtk::mesh::PointFieldTag(name));
+    }
+  };
+  m_internals->visitMeshsets(handle, collect);
+  m_internals->visitMeshsets(smtk::mesh::HandleRange(smtk::mesh::HandleInterval(handle)), collect);
+  return pointFieldTags;
+}
+
+bool Interface::deletePointField(
+  const smtk::mesh::PointFieldTag& pfTag,
+  const smtk::mesh::HandleRange& meshsets)
+{
+  if (meshsets.empty())
+  {
+    return true;
+  }
+
+  auto it = m_internals->pointFields.find(pfTag.name());
+  if (it == m_internals->pointFields.end())
+  {
+    return false;
+  }
+
+  // Delete the data from the points and the data flag from the meshsets
+  it->second.defined -= this->getPoints(this->cellsOf(meshsets));
+  m_internals->visitMeshsets(meshsets, [&](smtk::mesh::Handle, MeshSetData& data) {
+    data.pointFields.erase(pfTag.name());
+  });
+  return true;
+}
+
+smtk::mesh::HandleRange Interface::pointIntersect(
+  const smtk::mesh::HandleRange& a,
+  const smtk::mesh::HandleRange& b,
+  smtk::mesh::PointConnectivity& bpc,
+  smtk::mesh::ContainmentType containmentType) const
+{
+  return this->pointContainment(a, b, bpc, containmentType, true);
+}
+
+smtk::mesh::HandleRange Interface::pointDifference(
+  const smtk::mesh::HandleRange& a,
+  const smtk::mesh::HandleRange& b,
+  smtk::mesh::PointConnectivity& bpc,
+  smtk::mesh::ContainmentType containmentType) const
+{
+  return this->pointContainment(a, b, bpc, containmentType, false);
+}
+
+smtk::mesh::HandleRange Interface::pointContainment(
+  const smtk::mesh::HandleRange& a,
+  const smtk::mesh::HandleRange& b,
+  smtk::mesh::PointConnectivity& bpc,
+  smtk::mesh::ContainmentType containmentType,
+  bool keepContained) const
+{
+  if (a.empty() || b.empty())
+  { //the intersection with nothing is nothing
+    return smtk::mesh::HandleRange();
+  }
+
+  //first mark all the points of a
+  std::vector<bool> a_points;
+  markPoints(*m_storage, a, a_points);
+
+  smtk::mesh::HandleRange result;
+  if (!bpc.is_empty())
+  {
+    int size = 0;
+    const smtk::mesh::Handle* connectivity;
+    bpc.initCellTraversal();
+    for (auto i = smtk::mesh::rangeElementsBegin(b); i != smtk::mesh::rangeElementsEnd(b); ++i)
+    {
+      const bool validCell = bpc.fetchNextCell(size, connectivity);
+      if (validCell)
+      {
+        bool exitCondition = (containmentType == smtk::mesh::PartiallyContained);
+        bool contains = !exitCondition;
+        for (int j = 0; j < size && contains != exitCondition; ++j)
+        {
+          const std::size_t point = Storage::index(connectivity[j]);
+          contains = point < a_points.size() && a_points[point];
+        }
+
+        if (contains == keepContained)
+        {
+          result.insert(result.end(), smtk::mesh::HandleInterval(*i, *i));
+        }
+      }
+    }
+  }
+  return result;
+}
+
+void Interface::pointForEach(const HandleRange& points, smtk::mesh::PointForEach& filter) const
+{
+  //call the filter on chunks of at most <numPointsPerCall> points
+  std::vector<double> coords;
+  smtk::mesh::HandleRange chunk;
+  std::size_t chunkSize = 0;
+
+  auto callFilter = [&]() {
+    coords.resize(3 * chunkSize);
+    copyCoordinates(*m_storage, chunk, coords.data());
+    bool shouldBeSaved = false;
+    filter.forPoints(chunk, coords, shouldBeSaved);
+    if (shouldBeSaved)
+    {
+      assignCoordinates(*m_storage, chunk, coords.data());
+    }
+    chunk.clear();
+    chunkSize = 0;
+  };
+
+  for (const auto& interval : handlesOfKind(points, Kind::Point))
+  {
+    smtk::mesh::Handle lower = interval.lower();
+    const smtk::mesh::Handle upper = std::min<smtk::mesh::Handle>(
+      interval.upper(), Storage::handle(Kind::Point, m_storage->numberOfPoints()) - 1);
+    while (lower <= upper)
+    {
+      const std::size_t count =
+        std::min<std::size_t>(upper - lower + 1, numPointsPerCall - chunkSize);
+      chunk.insert(chunk.end(), smtk::mesh::HandleInterval(lower, lower + count - 1));
+      chunkSize += count;
+      lower += count;
+      if (chunkSize == numPointsPerCall)
+      {
+        callFilter();
+      }
+    }
+  }
+  if (chunkSize > 0)
+  {
+    callFilter();
+  }
+}
+
+void Interface::cellForEach(
+  const HandleRange& cells,
+  smtk::mesh::PointConnectivity& pc,
+  smtk::mesh::CellForEach& filter) const
+{
+  if (!pc.is_empty())
+  {
+    smtk::mesh::CellType cellType;
+    int size = 0;
+    const smtk::mesh::Handle* points;
+
+    auto currentCell = smtk::mesh::rangeElementsBegin(cells);
+    if (filter.wantsCoordinates())
+    {
+      const std::vector<double>& x = m_storage->x();
+      const std::vector<double>& y = m_storage->y();
+      const std::vector<double>& z = m_storage->z();
+      std::vector<double> coords;
+      for (pc.initCellTraversal(); pc.fetchNextCell(cellType, size, points); ++currentCell)
+      {
+        coords.resize(size * 3);
+        for (int i = 0; i < size; ++i)
+        {
+          const std::size_t point = Storage::index(points[i]);
+          coords[3 * i] = x[point];
+          coords[3 * i + 1] = y[point];
+          coords[3 * i + 2] = z[point];
+        }
+        //call the custom filter
+        filter.pointIds(points);
+        filter.coordinates(&coords);
+        filter.forCell(*currentCell, cellType, size);
+      }
+    }
+    else
+    { //don't extract the coords
+      for (pc.initCellTraversal(); pc.fetchNextCell(cellType, size, points); ++currentCell)
+      {
+        filter.pointIds(points);
+        //call the custom filter
+        filter.forCell(*currentCell, cellType, size);
+      }
+    }
+  }
+}
+
+void Interface::meshForEach(const smtk::mesh::HandleRange& meshes, smtk::mesh::MeshForEach& filter)
+  const
+{
+  for (auto i = smtk::mesh::rangeElementsBegin(meshes); i != smtk::mesh::rangeElementsEnd(meshes);
+       ++i)
+  {
+    smtk::mesh::HandleRange singleHandle;
+    singleHandle += *i;
+    smtk::mesh::MeshSet singleMesh(filter.m_resource, *i, singleHandle);
+
+    //call the custom filter
+    filter.forMesh(singleMesh);
+  }
+}
+
+bool Interface::deleteHandles(const smtk::mesh::HandleRange& toDel)
+{
+  //step 1. verify HandleRange isnt empty
+  if (toDel.empty())
+  {
+    return true;
+  }
+
+  //step 2. verify HandleRange doesn't contain root Handle. Ranges are always
+  //sorted, and the root is always 0
+  if (toDel.begin()->lower() == this->getRoot())
+  {
+    return false;
+  }
+
+  //step 3. verify HandleRange is either all meshsets or cells/points
+  smtk::mesh::HandleRange meshsets = handlesOfKind(toDel, Kind::MeshSet);
+  if (meshsets.size() == toDel.size())
+  {
+    m_internals->visitMeshsets(
+      meshsets, [](smtk::mesh::Handle, MeshSetData& data) { data = MeshSetData(); });
+    m_internals->liveMeshsets -= meshsets;
+  }
+  else if (meshsets.empty())
+  {
+    //we don't delete points, as those can't be explicitly deleted. Instead
+    //they are deleted when the interface goes away
+    smtk::mesh::HandleRange cells = handlesOfKind(toDel, Kind::Cell);
+    m_storage->removeCells(cells);
+    for (auto& data : m_internals->meshsets)
+    {
+      data.entities -= cells;
+    }
+    for (auto& field : m_internals->cellFields)
+    {
+      field.second.defined -= cells;
+    }
+  }
+  else
+  {
+    return false;
+  }
+
+  m_modified = true;
+  return true;
+}
+} // namespace native
+} // namespace mesh
+} // namespace smtk
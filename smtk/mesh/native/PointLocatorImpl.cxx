@@ -0,0 +1,228 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#include "smtk/mesh/native/PointLocatorImpl.h"
+#include "smtk/mesh/native/Storage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+// the average number of points we aim to place in each bin
+const double PointsPerBin = 4.;
+
+// the largest number of bins we will allocate along a single axis
+const std::size_t MaximumBinsPerAxis = 1024;
+} // namespace
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+PointLocatorImpl::PointLocatorImpl(const Storage* storage, const smtk::mesh::HandleRange& points)
+  : m_points(points)
+{
+  std::vector<double> x, y, z;
+  x.reserve(points.size());
+  y.reserve(points.size());
+  z.reserve(points.size());
+  for (const auto& interval : points)
+  {
+    for (std::size_t i = Storage::index(interval.lower()); i <= Storage::index(interval.upper());
+         ++i)
+    {
+      x.push_back(storage->x()[i]);
+      y.push_back(storage->y()[i]);
+      z.push_back(storage->z()[i]);
+    }
+  }
+  this->build(x, y, z);
+}
+
+PointLocatorImpl::PointLocatorImpl(
+  std::size_t numPoints,
+  const std::function<std::array<double, 3>(std::size_t)>& coordinates)
+{
+  //the points are owned by the locator, so they have no handles
+  std::vector<double> x(numPoints), y(numPoints), z(numPoints);
+  for (std::size_t i = 0; i < numPoints; ++i)
+  {
+    std::array<double, 3> xyz = coordinates(i);
+    x[i] = xyz[0];
+    y[i] = xyz[1];
+    z[i] = xyz[2];
+  }
+  this->build(x, y, z);
+}
+
+PointLocatorImpl::~PointLocatorImpl() = default;
+
+void PointLocatorImpl::build(
+  const std::vector<double>& x,
+  const std::vector<double>& y,
+  const std::vector<double>& z)
+{
+  const std::size_t numPoints = x.size();
+  const std::vector<double>* coords[3] = { &x, &y, &z };
+
+  std::array<double, 3> upper;
+  for (int d = 0; d < 3; ++d)
+  {
+    m_origin[d] = numPoints > 0 ? *std::min_element(coords[d]->begin(), coords[d]->end()) : 0.;
+    upper[d] = numPoints > 0 ? *std::max_element(coords[d]->begin(), coords[d]->end()) : 0.;
+  }
+
+  //choose a bin size so that the non-degenerate axes hold about PointsPerBin
+  //points per bin
+  int numAxes = 0;
+  double volume = 1.;
+  for (int d = 0; d < 3; ++d)
+  {
+    if (upper[d] > m_origin[d])
+    {
+      ++numAxes;
+      volume *= upper[d] - m_origin[d];
+    }
+  }
+  const double binLength = numAxes > 0
+    ? std::pow(volume * PointsPerBin / static_cast<double>(numPoints), 1. / numAxes)
+    : 1.;
+
+  std::size_t numBins = 1;
+  for (int d = 0; d < 3; ++d)
+  {
+    const double extent = upper[d] - m_origin[d];
+    const double bins = std::min(static_cast<double>(MaximumBinsPerAxis), extent / binLength);
+    m_dimensions[d] = extent > 0. && bins >= 1. ? static_cast<std::size_t>(bins) : 1;
+    m_spacing[d] = extent > 0. ? extent / static_cast<double>(m_dimensions[d]) : 1.;
+    numBins *= m_dimensions[d];
+  }
+
+  auto binOf = [this](double px, double py, double pz) {
+    const double p[3] = { px, py, pz };
+    std::size_t ijk[3];
+    for (int d = 0; d < 3; ++d)
+    {
+      const double b = std::floor((p[d] - m_origin[d]) / m_spacing[d]);
+      ijk[d] = b <= 0. ? 0 : std::min(m_dimensions[d] - 1, static_cast<std::size_t>(b));
+    }
+    return ijk[0] + m_dimensions[0] * (ijk[1] + m_dimensions[1] * ijk[2]);
+  };
+
+  //count the points in each bin, then scatter the points into bin order
+  std::vector<std::size_t> bins(numPoints);
+  m_binOffsets.assign(numBins + 1, 0);
+  for (std::size_t i = 0; i < numPoints; ++i)
+  {
+    bins[i] = binOf(x[i], y[i], z[i]);
+    ++m_binOffsets[bins[i] + 1];
+  }
+  for (std::size_t b = 1; b <= numBins; ++b)
+  {
+    m_binOffsets[b] += m_binOffsets[b - 1];
+  }
+
+  std::vector<std::size_t> position(m_binOffsets.begin(), m_binOffsets.end() - 1);
+  m_ids.resize(numPoints);
+  m_x.resize(numPoints);
+  m_y.resize(numPoints);
+  m_z.resize(numPoints);
+  for (std::size_t i = 0; i < numPoints; ++i)
+  {
+    const std::size_t p = position[bins[i]]++;
+    m_ids[p] = i;
+    m_x[p] = x[i];
+    m_y[p] = y[i];
+    m_z[p] = z[i];
+  }
+}
+
+smtk::mesh::HandleRange PointLocatorImpl::range() const
+{
+  return m_points;
+}
+
+void PointLocatorImpl::locatePointsWithinRadius(
+  double x,
+  double y,
+  double z,
+  double radius,
+  Results& results)
+{
+  //clear any existing data from the arrays
+  results.pointIds.clear();
+  results.sqDistances.clear();
+  results.x_s.clear();
+  results.y_s.clear();
+  results.z_s.clear();
+
+  if (m_ids.empty())
+  {
+    return;
+  }
+
+  //find the range of bins that overlap the search sphere's bounding box
+  const double p[3] = { x, y, z };
+  std::size_t lower[3], upper[3];
+  for (int d = 0; d < 3; ++d)
+  {
+    const double lo = std::floor((p[d] - radius - m_origin[d]) / m_spacing[d]);
+    const double hi = std::floor((p[d] + radius - m_origin[d]) / m_spacing[d]);
+    if (hi < 0. || lo > static_cast<double>(m_dimensions[d] - 1))
+    {
+      return;
+    }
+    lower[d] = lo <= 0. ? 0 : static_cast<std::size_t>(lo);
+    upper[d] = std::min(m_dimensions[d] - 1, static_cast<std::size_t>(hi));
+  }
+
+  const double sqRadius = radius * radius;
+  const bool wantDistance = results.want_sqDistances;
+  const bool wantCoords = results.want_Coordinates;
+
+  for (std::size_t k = lower[2]; k <= upper[2]; ++k)
+  {
+    for (std::size_t j = lower[1]; j <= upper[1]; ++j)
+    {
+      //bins along x are adjacent, so each row of bins is one contiguous span
+      const std::size_t row = m_dimensions[0] * (j + m_dimensions[1] * k);
+      const std::size_t begin = m_binOffsets[row + lower[0]];
+      const std::size_t end = m_binOffsets[row + upper[0] + 1];
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        const double sqLen =
+          (x - m_x[i]) * (x - m_x[i]) + (y - m_y[i]) * (y - m_y[i]) + (z - m_z[i]) * (z - m_z[i]);
+        if (sqLen <= sqRadius)
+        {
+          results.pointIds.push_back(m_ids[i]);
+          if (wantDistance)
+          {
+            results.sqDistances.push_back(sqLen);
+          }
+          if (wantCoords)
+          {
+            results.x_s.push_back(m_x[i]);
+            results.y_s.push_back(m_y[i]);
+            results.z_s.push_back(m_z[i]);
+          }
+        }
+      }
+    }
+  }
+}
+} // namespace native
+} // namespace mesh
+} // namespace smtk
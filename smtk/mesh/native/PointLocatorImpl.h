@@ -0,0 +1,74 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#ifndef smtk_mesh_native_PointLocatorImpl_h
+#define smtk_mesh_native_PointLocatorImpl_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/PublicPointerDefs.h"
+
+#include "smtk/mesh/native/Interface.h"
+
+#include <array>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+class Storage;
+
+/// A point locator that bins a copy of its points' coordinates into a
+/// uniform grid. Bins are stored as offsets into a single array of point ids,
+/// and the coordinates are reordered by bin so a radius search reads
+/// contiguous memory.
+class SMTKCORE_EXPORT PointLocatorImpl : public smtk::mesh::PointLocatorImpl
+{
+public:
+  PointLocatorImpl(const Storage* storage, const smtk::mesh::HandleRange& points);
+
+  PointLocatorImpl(
+    std::size_t numPoints,
+    const std::function<std::array<double, 3>(std::size_t)>& coordinates);
+
+  ~PointLocatorImpl() override;
+
+  smtk::mesh::HandleRange range() const override;
+
+  //returns the set of points that are within the radius of a single point
+  void locatePointsWithinRadius(double x, double y, double z, double radius, Results& results)
+    override;
+
+private:
+  void build(
+    const std::vector<double>& x,
+    const std::vector<double>& y,
+    const std::vector<double>& z);
+
+  smtk::mesh::HandleRange m_points;
+
+  std::array<double, 3> m_origin;
+  std::array<double, 3> m_spacing;
+  std::array<std::size_t, 3> m_dimensions;
+
+  std::vector<std::size_t> m_binOffsets;
+  std::vector<std::size_t> m_ids;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+};
+} // namespace native
+} // namespace mesh
+} // namespace smtk
+
+#endif
@@ -0,0 +1,252 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#include "smtk/mesh/native/Storage.h"
+
+#include <limits>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+std::size_t IndexArray::maximum() const
+{
+  return m_width == IndexWidth::Bits32
+    ? static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max())
+    : std::numeric_limits<std::size_t>::max();
+}
+
+void IndexArray::push_back(std::size_t value)
+{
+  if (m_width == IndexWidth::Bits32)
+  {
+    m_32.push_back(static_cast<std::uint32_t>(value));
+  }
+  else
+  {
+    m_64.push_back(static_cast<std::uint64_t>(value));
+  }
+}
+
+void IndexArray::resize(std::size_t size, std::size_t value)
+{
+  if (m_width == IndexWidth::Bits32)
+  {
+    m_32.resize(size, static_cast<std::uint32_t>(value));
+  }
+  else
+  {
+    m_64.resize(size, static_cast<std::uint64_t>(value));
+  }
+}
+
+void IndexArray::reserve(std::size_t size)
+{
+  if (m_width == IndexWidth::Bits32)
+  {
+    m_32.reserve(size);
+  }
+  else
+  {
+    m_64.reserve(size);
+  }
+}
+
+void IndexArray::clear()
+{
+  m_32.clear();
+  m_64.clear();
+}
+
+std::size_t IndexArray::memoryUsage() const
+{
+  return m_32.capacity() * sizeof(std::uint32_t) + m_64.capacity() * sizeof(std::uint64_t);
+}
+
+smtk::mesh::HandleInterval Storage::interval(Kind kind)
+{
+  return smtk::mesh::HandleInterval(Storage::handle(kind, 0), Storage::handle(kind, IndexMask));
+}
+
+smtk::mesh::HandleInterval Storage::interval(Kind kind, std::size_t first, std::size_t size)
+{
+  return smtk::mesh::HandleInterval(
+    Storage::handle(kind, first), Storage::handle(kind, first + size - 1));
+}
+
+int Storage::dimension(smtk::mesh::CellType cellType)
+{
+  static const int dimensionByType[smtk::mesh::CellType_MAX] = { 0, 1, 2, 2, 2, 3, 3, 3, 3 };
+  return cellType >= 0 && cellType < smtk::mesh::CellType_MAX ? dimensionByType[cellType] : -1;
+}
+
+Storage::Storage(IndexWidth width)
+  : m_offsets(width)
+  , m_connectivity(width)
+  , m_pointCellOffsets(width)
+  , m_pointCells(width)
+{
+  m_offsets.push_back(0);
+}
+
+bool Storage::allocatePoints(std::size_t size, std::size_t& first)
+{
+  first = m_x.size();
+  if (size == 0 || first + size > m_connectivity.maximum())
+  {
+    return false;
+  }
+
+  m_x.resize(first + size, 0.);
+  m_y.resize(first + size, 0.);
+  m_z.resize(first + size, 0.);
+  this->connectivityModified();
+  return true;
+}
+
+std::size_t Storage::addPoint(const double* xyz)
+{
+  m_x.push_back(xyz[0]);
+  m_y.push_back(xyz[1]);
+  m_z.push_back(xyz[2]);
+  this->connectivityModified();
+  return m_x.size() - 1;
+}
+
+bool Storage::allocateCells(
+  smtk::mesh::CellType cellType,
+  std::size_t size,
+  int numVertsPerCell,
+  std::size_t& first)
+{
+  first = m_types.size();
+
+  //points are their own vertex cells, so they are never allocated here
+  if (
+    size == 0 || numVertsPerCell <= 0 || cellType <= smtk::mesh::Vertex ||
+    cellType >= smtk::mesh::CellType_MAX)
+  {
+    return false;
+  }
+
+  const std::size_t connectivitySize = m_connectivity.size();
+  const std::size_t newConnectivitySize =
+    connectivitySize + size * static_cast<std::size_t>(numVertsPerCell);
+  if (newConnectivitySize > m_connectivity.maximum())
+  {
+    return false;
+  }
+
+  m_types.resize(first + size, static_cast<unsigned char>(cellType));
+  m_offsets.reserve(first + size + 1);
+  for (std::size_t i = 1; i <= size; ++i)
+  {
+    m_offsets.push_back(connectivitySize + i * static_cast<std::size_t>(numVertsPerCell));
+  }
+  m_connectivity.resize(newConnectivitySize, 0);
+
+  smtk::mesh::HandleInterval created = Storage::interval(Kind::Cell, first, size);
+  m_cells.insert(created);
+  m_cellsByType[cellType].insert(created);
+  this->connectivityModified();
+  return true;
+}
+
+void Storage::connectivity(std::size_t cell, smtk::mesh::Handle* points) const
+{
+  const std::size_t begin = m_offsets[cell];
+  const std::size_t end = m_offsets[cell + 1];
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    *points++ = Storage::handle(Kind::Point, m_connectivity[i]);
+  }
+}
+
+void Storage::removeCells(const smtk::mesh::HandleRange& cells)
+{
+  m_cells -= cells;
+  for (auto& cellsOfType : m_cellsByType)
+  {
+    cellsOfType -= cells;
+  }
+  this->connectivityModified();
+}
+
+std::size_t Storage::numberOfCellsOfPoint(std::size_t point) const
+{
+  if (!m_adjacencyValid)
+  {
+    this->buildAdjacency();
+  }
+  return m_pointCellOffsets[point + 1] - m_pointCellOffsets[point];
+}
+
+void Storage::buildAdjacency() const
+{
+  const std::size_t numberOfPoints = m_x.size();
+
+  //count the uses of each point, then convert the counts into offsets
+  std::vector<std::size_t> counts(numberOfPoints + 1, 0);
+  for (const auto& interval : m_cells)
+  {
+    for (std::size_t cell = Storage::index(interval.lower());
+         cell <= Storage::index(interval.upper());
+         ++cell)
+    {
+      for (std::size_t i = m_offsets[cell]; i < m_offsets[cell + 1]; ++i)
+      {
+        ++counts[m_connectivity[i] + 1];
+      }
+    }
+  }
+  for (std::size_t i = 1; i <= numberOfPoints; ++i)
+  {
+    counts[i] += counts[i - 1];
+  }
+
+  m_pointCellOffsets.clear();
+  m_pointCellOffsets.resize(numberOfPoints + 1);
+  for (std::size_t i = 0; i <= numberOfPoints; ++i)
+  {
+    m_pointCellOffsets.set(i, counts[i]);
+  }
+
+  //scatter the cells, visiting them in order so each point's cells are sorted
+  m_pointCells.clear();
+  m_pointCells.resize(counts[numberOfPoints]);
+  for (const auto& interval : m_cells)
+  {
+    for (std::size_t cell = Storage::index(interval.lower());
+         cell <= Storage::index(interval.upper());
+         ++cell)
+    {
+      for (std::size_t i = m_offsets[cell]; i < m_offsets[cell + 1]; ++i)
+      {
+        m_pointCells.set(counts[m_connectivity[i]]++, cell);
+      }
+    }
+  }
+
+  m_adjacencyValid = true;
+}
+
+std::size_t Storage::memoryUsage() const
+{
+  return (m_x.capacity() + m_y.capacity() + m_z.capacity()) * sizeof(double) +
+    m_types.capacity() + m_offsets.memoryUsage() + m_connectivity.memoryUsage() +
+    m_pointCellOffsets.memoryUsage() + m_pointCells.memoryUsage();
+}
+} // namespace native
+} // namespace mesh
+} // namespace smtk
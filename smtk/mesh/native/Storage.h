@@ -0,0 +1,244 @@
+//=============================================================================
+//
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//
+//=============================================================================
+#ifndef smtk_mesh_native_Storage_h
+#define smtk_mesh_native_Storage_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/mesh/core/CellTypes.h"
+#include "smtk/mesh/core/DimensionTypes.h"
+#include "smtk/mesh/core/Handle.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace smtk
+{
+namespace mesh
+{
+namespace native
+{
+
+/// The width of the integers used to store point indices in cell
+/// connectivity. 32-bit indices halve the memory consumed by connectivity and
+/// adjacency arrays, but limit the storage to 2^32 - 1 points and
+/// connectivity entries.
+enum class IndexWidth
+{
+  Bits32,
+  Bits64
+};
+
+/// A contiguous array of unsigned indices whose width is chosen at run time.
+class SMTKCORE_EXPORT IndexArray
+{
+public:
+  explicit IndexArray(IndexWidth width = IndexWidth::Bits64)
+    : m_width(width)
+  {
+  }
+
+  IndexWidth width() const { return m_width; }
+
+  //the largest value that can be held by the array
+  std::size_t maximum() const;
+
+  std::size_t size() const { return m_width == IndexWidth::Bits32 ? m_32.size() : m_64.size(); }
+  bool empty() const { return this->size() == 0; }
+
+  std::size_t operator[](std::size_t i) const
+  {
+    return m_width == IndexWidth::Bits32 ? static_cast<std::size_t>(m_32[i])
+                                         : static_cast<std::size_t>(m_64[i]);
+  }
+
+  void set(std::size_t i, std::size_t value)
+  {
+    if (m_width == IndexWidth::Bits32)
+    {
+      m_32[i] = static_cast<std::uint32_t>(value);
+    }
+    else
+    {
+      m_64[i] = static_cast<std::uint64_t>(value);
+    }
+  }
+
+  void push_back(std::size_t value);
+  void resize(std::size_t size, std::size_t value = 0);
+  void reserve(std::size_t size);
+  void clear();
+
+  //the number of bytes held by the array
+  std::size_t memoryUsage() const;
+
+private:
+  IndexWidth m_width;
+  std::vector<std::uint32_t> m_32;
+  std::vector<std::uint64_t> m_64;
+};
+
+/// Storage holds the points and cells of a native mesh interface as flat,
+/// contiguous arrays (a structure of arrays). Point coordinates are held in
+/// separate x, y and z arrays. Cells are held as an array of cell types, an
+/// array of offsets and a single array of point indices (a compressed sparse
+/// row layout), so cells of mixed type and polygons share one allocation.
+///
+/// Handles encode the kind of entity they refer to in their high bits, so
+/// points order before cells and cells before meshsets. The root meshset is
+/// the handle 0.
+class SMTKCORE_EXPORT Storage
+{
+public:
+  enum class Kind : smtk::mesh::Handle
+  {
+    Root = 0,
+    Point = 1,
+    Cell = 2,
+    MeshSet = 3
+  };
+
+  static constexpr int KindShift = static_cast<int>(sizeof(smtk::mesh::Handle) * 8 - 4);
+  static constexpr smtk::mesh::Handle IndexMask = (smtk::mesh::Handle(1) << KindShift) - 1;
+
+  static Kind kind(smtk::mesh::Handle handle) { return static_cast<Kind>(handle >> KindShift); }
+  static std::size_t index(smtk::mesh::Handle handle)
+  {
+    return static_cast<std::size_t>(handle & IndexMask);
+  }
+  static smtk::mesh::Handle handle(Kind kind, std::size_t index)
+  {
+    return (static_cast<smtk::mesh::Handle>(kind) << KindShift) |
+      static_cast<smtk::mesh::Handle>(index);
+  }
+
+  //all handles of a given kind, or the handles [first, first + size) of a kind
+  static smtk::mesh::HandleInterval interval(Kind kind);
+  static smtk::mesh::HandleInterval interval(Kind kind, std::size_t first, std::size_t size);
+
+  //the topological dimension of a cell type
+  static int dimension(smtk::mesh::CellType cellType);
+
+  Storage(IndexWidth width = IndexWidth::Bits64);
+
+  Storage(const Storage& other) = delete;
+  Storage& operator=(const Storage& other) = delete;
+
+  IndexWidth indexWidth() const { return m_connectivity.width(); }
+
+  //Points
+  std::size_t numberOfPoints() const { return m_x.size(); }
+
+  //append <size> zero-initialized points, returning the index of the first.
+  //Pointers into the coordinate arrays remain valid until points are next
+  //allocated or added.
+  bool allocatePoints(std::size_t size, std::size_t& first);
+  std::size_t addPoint(const double* xyz);
+
+  std::vector<double>& x() { return m_x; }
+  std::vector<double>& y() { return m_y; }
+  std::vector<double>& z() { return m_z; }
+  const std::vector<double>& x() const { return m_x; }
+  const std::vector<double>& y() const { return m_y; }
+  const std::vector<double>& z() const { return m_z; }
+
+  //Cells
+  std::size_t numberOfCells() const { return m_types.size(); }
+
+  //append <size> cells of the given type, each with <numVertsPerCell> point
+  //indices initialized to 0, returning the index of the first.
+  bool allocateCells(
+    smtk::mesh::CellType cellType,
+    std::size_t size,
+    int numVertsPerCell,
+    std::size_t& first);
+
+  smtk::mesh::CellType cellType(std::size_t cell) const
+  {
+    return static_cast<smtk::mesh::CellType>(m_types[cell]);
+  }
+  int cellDimension(std::size_t cell) const { return Storage::dimension(this->cellType(cell)); }
+  int cellSize(std::size_t cell) const
+  {
+    return static_cast<int>(m_offsets[cell + 1] - m_offsets[cell]);
+  }
+
+  std::size_t pointIndex(std::size_t cell, int i) const
+  {
+    return m_connectivity[m_offsets[cell] + i];
+  }
+  void setPointIndex(std::size_t cell, int i, std::size_t point)
+  {
+    m_connectivity.set(m_offsets[cell] + i, point);
+  }
+
+  //write the point handles of a cell into <points>, which must hold
+  //cellSize(cell) handles
+  void connectivity(std::size_t cell, smtk::mesh::Handle* points) const;
+
+  //the live cells, in total and by type. Points are their own vertex cells and
+  //are not included.
+  const smtk::mesh::HandleRange& cells() const { return m_cells; }
+  const smtk::mesh::HandleRange& cells(smtk::mesh::CellType cellType) const
+  {
+    return m_cellsByType[cellType];
+  }
+
+  //remove cells from the live set. Their connectivity is left in place.
+  void removeCells(const smtk::mesh::HandleRange& cells);
+
+  //Point to cell adjacency, built on demand and discarded whenever the
+  //connectivity changes.
+  void connectivityModified()
+  {
+    m_adjacencyValid = false;
+    ++m_revision;
+  }
+
+  //a counter that is incremented whenever the connectivity changes
+  std::size_t revision() const { return m_revision; }
+
+  //the live cells that use a point
+  std::size_t numberOfCellsOfPoint(std::size_t point) const;
+  std::size_t cellOfPoint(std::size_t point, std::size_t i) const
+  {
+    return m_pointCells[m_pointCellOffsets[point] + i];
+  }
+
+  //the bytes held by the point, cell and adjacency arrays
+  std::size_t memoryUsage() const;
+
+private:
+  void buildAdjacency() const;
+
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+
+  std::vector<unsigned char> m_types;
+  IndexArray m_offsets;
+  IndexArray m_connectivity;
+
+  smtk::mesh::HandleRange m_cells;
+  std::array<smtk::mesh::HandleRange, smtk::mesh::CellType_MAX> m_cellsByType;
+
+  std::size_t m_revision{ 0 };
+  mutable bool m_adjacencyValid{ false };
+  mutable IndexArray m_pointCellOffsets;
+  mutable IndexArray m_pointCells;
+};
+} // namespace native
+} // namespace mesh
+} // namespace smtk
+
+#endif
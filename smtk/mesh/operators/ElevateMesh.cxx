@@ -85,13 +85,22 @@ std::function<double(std::array<double, 3>)> radialAverageFrom(
   return radialAverage;
 }
 
+// Inverse distance weighting is reentrant, so it is evaluated in blocks of
+// points that may be distributed across threads.
+smtk::mesh::utility::BatchMapping batched(const smtk::mesh::InverseDistanceWeighting& idw)
+{
+  return [idw](std::size_t n, const double* xyz, double* values) { idw(n, xyz, values); };
+}
+
 template<typename InputType>
-std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
+smtk::mesh::utility::BatchMapping inverseDistanceWeightingFrom(
   const InputType& input,
   double power,
+  std::size_t numberOfNeighbors,
+  double radius,
   const std::function<bool(double)>& prefilter)
 {
-  std::function<double(std::array<double, 3>)> idw;
+  smtk::mesh::utility::BatchMapping idw;
   {
     // Let's start by trying to make a structured grid, since they can be a
     // subset of point clouds.
@@ -99,7 +108,8 @@ std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
     smtk::mesh::StructuredGrid structuredgrid = sgg(input);
     if (structuredgrid.size() > 0)
     {
-      idw = smtk::mesh::InverseDistanceWeighting(structuredgrid, power, prefilter);
+      idw = batched(smtk::mesh::InverseDistanceWeighting(
+        structuredgrid, power, numberOfNeighbors, radius, prefilter));
     }
   }
 
@@ -110,7 +120,8 @@ std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
     smtk::mesh::PointCloud pointcloud = pcg(input);
     if (pointcloud.size() > 0)
     {
-      idw = smtk::mesh::InverseDistanceWeighting(pointcloud, power, prefilter);
+      idw = batched(smtk::mesh::InverseDistanceWeighting(
+        pointcloud, power, numberOfNeighbors, radius, prefilter));
     }
   }
 
@@ -152,6 +163,26 @@ ElevateMesh::Result ElevateMesh::operateInternal()
   // Access the power parameter
   smtk::attribute::DoubleItem::Ptr powerItem = this->parameters()->findDouble("power");
 
+  // Access the parameters bounding the sources weighted by inverse distance
+  // weighting (0 leaves them unbounded)
+  std::size_t numberOfNeighbors = 0;
+  double searchRadius = 0.;
+  {
+    smtk::attribute::IntItem::Ptr neighborsItem =
+      this->parameters()->findInt("number of neighbors");
+    if (neighborsItem && neighborsItem->isEnabled())
+    {
+      numberOfNeighbors = static_cast<std::size_t>(neighborsItem->value());
+    }
+
+    smtk::attribute::DoubleItem::Ptr searchRadiusItem =
+      this->parameters()->findDouble("search radius");
+    if (searchRadiusItem && searchRadiusItem->isEnabled())
+    {
+      searchRadius = searchRadiusItem->value();
+    }
+  }
+
   // Construct a prefilter for the input data
   std::function<bool(double)> prefilter = [](double /*unused*/) { return true; };
   {
@@ -194,6 +225,10 @@ ElevateMesh::Result ElevateMesh::operateInternal()
   // when projected onto the x-y plane, are within a radius of the input
   std::function<double(std::array<double, 3>)> interpolation;
 
+  // Reentrant interpolators are held as batched mappings instead, so they can
+  // be applied to the mesh in parallel.
+  smtk::mesh::utility::BatchMapping batchInterpolation;
+
   if (inputDataItem->value() == "auxiliary geometry")
   {
     // Access the external data to use in determining elevation values
@@ -211,11 +246,11 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation = inverseDistanceWeightingFrom<smtk::model::AuxiliaryGeometry>(
-        auxGeo, powerItem->value(), prefilter);
+      batchInterpolation = inverseDistanceWeightingFrom<smtk::model::AuxiliaryGeometry>(
+        auxGeo, powerItem->value(), numberOfNeighbors, searchRadius, prefilter);
     }
 
-    if (!interpolation)
+    if (!interpolation && !batchInterpolation)
     {
       smtkErrorMacro(this->log(), "Could not convert auxiliary geometry.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -235,11 +270,11 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation =
-        inverseDistanceWeightingFrom<std::string>(fileName, powerItem->value(), prefilter);
+      batchInterpolation = inverseDistanceWeightingFrom<std::string>(
+        fileName, powerItem->value(), numberOfNeighbors, searchRadius, prefilter);
     }
 
-    if (!interpolation)
+    if (!interpolation && !batchInterpolation)
     {
       smtkErrorMacro(this->log(), "Could not read file.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -277,10 +312,11 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation = smtk::mesh::InverseDistanceWeighting(pointcloud, powerItem->value());
+      batchInterpolation = batched(smtk::mesh::InverseDistanceWeighting(
+        pointcloud, powerItem->value(), numberOfNeighbors, searchRadius));
     }
 
-    if (!interpolation)
+    if (!interpolation && !batchInterpolation)
     {
       smtkErrorMacro(this->log(), "Could not read points.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -337,7 +373,7 @@ ElevateMesh::Result ElevateMesh::operateInternal()
   std::function<double(std::array<double, 3>)> externalDataPoint = [](std::array<double, 3> xyz) {
     return xyz[2];
   };
-  if (interpolationSchemeItem->value() == "radial average")
+  if (externalPointItem)
   {
     if (externalPointItem->value() == "set to NaN")
     {
@@ -363,6 +399,25 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     return std::array<double, 3>({ { x[0], x[1], z } });
   };
 
+  // The same, for a batch of points.
+  smtk::mesh::utility::BatchMapping batchFn =
+    [&](std::size_t n, const double* xyz, double* values) {
+      std::vector<double> z(n);
+      batchInterpolation(n, xyz, z.data());
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        const double* x = xyz + 3 * j;
+        double* warped = values + 3 * j;
+        warped[0] = x[0];
+        warped[1] = x[1];
+        warped[2] = postProcess(z[j]);
+        if (std::isnan(warped[2]))
+        {
+          warped[2] = externalDataPoint(std::array<double, 3>({ { x[0], x[1], x[2] } }));
+        }
+      }
+    };
+
   // Access the attribute associated with the modified meshes
   Result result = this->createResult(smtk::operation::Operation::Outcome::SUCCEEDED);
 
@@ -378,7 +433,15 @@ ElevateMesh::Result ElevateMesh::operateInternal()
     auto meshComponent = meshItem->valueAs<smtk::mesh::Component>(i);
     auto mesh = meshComponent->mesh();
 
-    smtk::mesh::utility::applyWarp(fn, mesh, true);
+    // Batched interpolators are evaluated on one thread per core.
+    if (batchInterpolation)
+    {
+      smtk::mesh::utility::applyWarp(batchFn, mesh, true, 0);
+    }
+    else
+    {
+      smtk::mesh::utility::applyWarp(fn, mesh, true);
+    }
 
     modified->appendValue(meshComponent);
     markGeometry.markModified(meshComponent);
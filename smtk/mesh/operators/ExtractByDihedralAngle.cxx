@@ -9,6 +9,7 @@
 //=========================================================================
 #include "smtk/mesh/operators/ExtractByDihedralAngle.h"
 
+#include "smtk/mesh/core/CellAdjacency.h"
 #include "smtk/mesh/core/CellSet.h"
 #include "smtk/mesh/core/Component.h"
 #include "smtk/mesh/core/ForEachTypes.h"
@@ -26,7 +27,9 @@
 
 #include "smtk/mesh/ExtractByDihedralAngle_xml.h"
 
+#include <array>
 #include <cmath>
+#include <vector>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846264338327950288
@@ -39,19 +42,22 @@ namespace mesh
 
 namespace
 {
-typedef std::unordered_map<smtk::mesh::Handle, std::array<double, 3>> NormalsMap;
-
-// For each cell, compute the cell's normal and add it to the map.
+// For each cell, compute the cell's unit normal and store it at the cell's
+// index in the adjacency.
 class ComputeNormals : public smtk::mesh::CellForEach
 {
 public:
-  ComputeNormals(NormalsMap& normsMap)
+  ComputeNormals(const smtk::mesh::CellAdjacency& adjacency)
     : smtk::mesh::CellForEach(true)
-    , m_normalsMap(normsMap)
+    , m_adjacency(adjacency)
+    , m_normals(adjacency.numberOfCells())
   {
   }
 
-  std::array<double, 3> unitNormal()
+  void forCell(
+    const smtk::mesh::Handle& cellId,
+    smtk::mesh::CellType /*cellType*/,
+    int /*numPointIds*/) override
   {
     const double* p0 = &(this->coordinates()[0]);
     const double* p1 = &(this->coordinates()[3]);
@@ -70,68 +76,14 @@ public:
       n[i] /= magnitude;
     }
 
-    return n;
+    m_normals[m_adjacency.index(cellId)] = n;
   }
 
-  void forCell(
-    const smtk::mesh::Handle& cellId,
-    smtk::mesh::CellType /*cellType*/,
-    int /*numPointIds*/) override
-  {
-    m_normalsMap[cellId] = this->unitNormal();
-  }
-
-protected:
-  NormalsMap& m_normalsMap;
-};
-
-// For each cell, check if the cell has a neighbor that (a) is in the normals
-// map and (b) whose dihedral angle with said neighbor is less than a user-
-// defined value. If so, add the cell to the list of new cells.
-class ExtendByDihedralAngle : public ComputeNormals
-{
-public:
-  ExtendByDihedralAngle(NormalsMap& normsMap, const InterfacePtr& iface, double angle)
-    : ComputeNormals(normsMap)
-    , m_interface(iface)
-    , m_cosDihedralAngle(std::cos(M_PI * angle / 180.))
-  {
-  }
-
-  smtk::mesh::HandleRange newCellHandles() const { return m_newCells; }
-
-  void clear() { m_newCells.clear(); }
-
-  void forCell(const smtk::mesh::Handle& cellId, smtk::mesh::CellType /*unused*/, int nPoints)
-    override
-  {
-    (void)nPoints;
-    assert(nPoints == 3);
-    std::array<double, 3> normal = this->unitNormal();
-    smtk::mesh::HandleRange neighborCells = m_interface->neighbors(cellId);
-    for (auto i = smtk::mesh::rangeElementsBegin(neighborCells);
-         i != smtk::mesh::rangeElementsEnd(neighborCells);
-         ++i)
-    {
-      auto it = m_normalsMap.find(*i);
-      if (it != m_normalsMap.end())
-      {
-        double dot =
-          normal[0] * it->second[0] + normal[1] * it->second[1] + normal[2] * it->second[2];
-        if (dot > m_cosDihedralAngle)
-        {
-          m_normalsMap[cellId] = normal;
-          m_newCells.insert(cellId);
-          break;
-        }
-      }
-    }
-  }
+  const std::vector<std::array<double, 3>>& normals() const { return m_normals; }
 
 private:
-  const InterfacePtr& m_interface;
-  double m_cosDihedralAngle;
-  smtk::mesh::HandleRange m_newCells;
+  const smtk::mesh::CellAdjacency& m_adjacency;
+  std::vector<std::array<double, 3>> m_normals;
 };
 } // namespace
 
@@ -164,7 +116,7 @@ smtk::mesh::ExtractByDihedralAngle::Result ExtractByDihedralAngle::operateIntern
 
   // For 2-dimensional mesh selections within a 3-dimensional mesh, we must take
   // care to restrict our algorithm to the surface mesh.
-  bool shellCreated;
+  bool shellCreated = false;
   if (smtk::mesh::utility::highestDimension(surfaceMesh) == smtk::mesh::Dims3)
   {
     surfaceMesh = resource->meshes().extractShell(shellCreated);
@@ -173,54 +125,37 @@ smtk::mesh::ExtractByDihedralAngle::Result ExtractByDihedralAngle::operateIntern
   // Access the dihedral angle.
   double dihedralAngle = this->parameters()->findDouble("dihedral angle")->value();
 
-  // The range of all cells to extract as a new meshset
-  smtk::mesh::HandleRange cells = meshset.cells().range();
-
-  // The range of cells to extract that were added during the most recent
-  // iteration
-  smtk::mesh::HandleRange newCells = cells;
-
-  NormalsMap normalsMap;
+  // The seed cells of the extraction
+  smtk::mesh::HandleRange seeds = meshset.cells().range();
 
-  // Start by computing normals for the seed cells.
-  ComputeNormals computeNormals(normalsMap);
-  smtk::mesh::for_each(smtk::mesh::CellSet(resource, cells), computeNormals);
+  // Grow the seeds across the surface mesh. The seeds are included in the
+  // adjacency in case they are not part of the surface.
+  smtk::mesh::HandleRange surface = surfaceMesh.cells().range();
+  auto adjacency = resource->cellAdjacency(smtk::mesh::CellSet(resource, surface | seeds));
 
-  ExtendByDihedralAngle extendByDihedralAngle(normalsMap, resource->interface(), dihedralAngle);
+  ComputeNormals computeNormals(*adjacency);
+  smtk::mesh::for_each(smtk::mesh::CellSet(resource, adjacency->cells()), computeNormals);
+  const std::vector<std::array<double, 3>>& normals = computeNormals.normals();
 
-  do
+  std::vector<bool> onSurface(adjacency->numberOfCells(), false);
+  for (std::size_t i = 0; i < adjacency->numberOfCells(); ++i)
   {
-    extendByDihedralAngle.clear();
-
-    // The cells to test for inclusion in the extraction set
-    smtk::mesh::HandleRange toCheck;
-
-    // Compute the next layer of neighbors to check for inclusion in the
-    // extraction set
-    for (auto i = smtk::mesh::rangeElementsBegin(newCells);
-         i != smtk::mesh::rangeElementsEnd(newCells);
-         ++i)
-    {
-      // Take the intersection of the cell's neighbors with the surface mesh.
-      toCheck += (resource->interface()->neighbors(*i) & surfaceMesh.cells().range());
-    }
-    toCheck -= cells;
-
-    // If there are no more cells to check, we are done
-    if (toCheck.empty())
-    {
-      break;
-    }
-
-    // Check the next layer of neighbors
-    smtk::mesh::for_each(smtk::mesh::CellSet(resource, toCheck), extendByDihedralAngle);
-
-    // Access the newest set of cells
-    newCells = extendByDihedralAngle.newCellHandles();
+    onSurface[i] = smtk::mesh::rangeContains(surface, adjacency->handle(i));
+  }
 
-    // Include the newest set of cells in the overall range of cells to extract
-    cells += newCells;
-  } while (!newCells.empty());
+  // A cell joins the extraction if it is on the surface and its dihedral
+  // angle with a neighbor already in the extraction is small enough.
+  const double cosDihedralAngle = std::cos(M_PI * dihedralAngle / 180.);
+  smtk::mesh::HandleRange cells =
+    adjacency->grow(seeds, [&](std::size_t cell, std::size_t neighbor) {
+      if (!onSurface[neighbor])
+      {
+        return false;
+      }
+      const std::array<double, 3>& a = normals[cell];
+      const std::array<double, 3>& b = normals[neighbor];
+      return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] > cosDihedralAngle;
+    });
 
   // If a shell was created to facilitate the algorithm, remove it.
   if (shellCreated)
@@ -91,13 +91,22 @@ std::function<double(std::array<double, 3>)> radialAverageFrom(
   return radialAverage;
 }
 
+// Inverse distance weighting is reentrant, so it is evaluated in blocks of
+// points that may be distributed across threads.
+smtk::mesh::utility::BatchMapping batched(const smtk::mesh::InverseDistanceWeighting& idw)
+{
+  return [idw](std::size_t n, const double* xyz, double* values) { idw(n, xyz, values); };
+}
+
 template<typename InputType>
-std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
+smtk::mesh::utility::BatchMapping inverseDistanceWeightingFrom(
   const InputType& input,
   double power,
+  std::size_t numberOfNeighbors,
+  double radius,
   const std::function<bool(double)>& prefilter)
 {
-  std::function<double(std::array<double, 3>)> idw;
+  smtk::mesh::utility::BatchMapping idw;
   {
     // Let's start by trying to make a structured grid, since they can be a
     // subset of point clouds.
@@ -105,7 +114,8 @@ std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
     smtk::mesh::StructuredGrid structuredgrid = sgg(input);
     if (structuredgrid.size() > 0)
     {
-      idw = smtk::mesh::InverseDistanceWeighting(structuredgrid, power, prefilter);
+      idw = batched(smtk::mesh::InverseDistanceWeighting(
+        structuredgrid, power, numberOfNeighbors, radius, prefilter));
     }
   }
 
@@ -116,7 +126,8 @@ std::function<double(std::array<double, 3>)> inverseDistanceWeightingFrom(
     smtk::mesh::PointCloud pointcloud = pcg(input);
     if (pointcloud.size() > 0)
     {
-      idw = smtk::mesh::InverseDistanceWeighting(pointcloud, power, prefilter);
+      idw = batched(smtk::mesh::InverseDistanceWeighting(
+        pointcloud, power, numberOfNeighbors, radius, prefilter));
     }
   }
 
@@ -158,6 +169,26 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
   // Access the power parameter
   smtk::attribute::DoubleItem::Ptr powerItem = this->parameters()->findDouble("power");
 
+  // Access the parameters bounding the sources weighted by inverse distance
+  // weighting (0 leaves them unbounded)
+  std::size_t numberOfNeighbors = 0;
+  double searchRadius = 0.;
+  {
+    smtk::attribute::IntItem::Ptr neighborsItem =
+      this->parameters()->findInt("number of neighbors");
+    if (neighborsItem && neighborsItem->isEnabled())
+    {
+      numberOfNeighbors = static_cast<std::size_t>(neighborsItem->value());
+    }
+
+    smtk::attribute::DoubleItem::Ptr searchRadiusItem =
+      this->parameters()->findDouble("search radius");
+    if (searchRadiusItem && searchRadiusItem->isEnabled())
+    {
+      searchRadius = searchRadiusItem->value();
+    }
+  }
+
   // Access the data set name
   smtk::attribute::StringItem::Ptr nameItem = this->parameters()->findString("dsname");
 
@@ -206,6 +237,10 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
   // when projected onto the x-y plane, are within a radius of the input
   std::function<double(std::array<double, 3>)> interpolation;
 
+  // Reentrant interpolators are held as batched mappings instead, so they can
+  // be applied to the mesh in parallel.
+  smtk::mesh::utility::BatchMapping batchInterpolation;
+
   if (inputDataItem->value() == "auxiliary geometry")
   {
     // Access the external data to use in determining value values
@@ -223,11 +258,11 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation = inverseDistanceWeightingFrom<smtk::model::AuxiliaryGeometry>(
-        auxGeo, powerItem->value(), prefilter);
+      batchInterpolation = inverseDistanceWeightingFrom<smtk::model::AuxiliaryGeometry>(
+        auxGeo, powerItem->value(), numberOfNeighbors, searchRadius, prefilter);
     }
 
-    if (!interpolation)
+    if (!interpolation && !batchInterpolation)
     {
       smtkErrorMacro(this->log(), "Could not convert auxiliary geometry.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -247,11 +282,11 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation =
-        inverseDistanceWeightingFrom<std::string>(fileName, powerItem->value(), prefilter);
+      batchInterpolation = inverseDistanceWeightingFrom<std::string>(
+        fileName, powerItem->value(), numberOfNeighbors, searchRadius, prefilter);
     }
 
-    if (!interpolation)
+    if (!interpolation && !batchInterpolation)
     {
       smtkErrorMacro(this->log(), "Could not read file.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -289,10 +324,11 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
     else if (interpolationSchemeItem->value() == "inverse distance weighting")
     {
       // Compute the inverse distance weighting function
-      interpolation = smtk::mesh::InverseDistanceWeighting(pointcloud, powerItem->value());
+      batchInterpolation = batched(smtk::mesh::InverseDistanceWeighting(
+        pointcloud, powerItem->value(), numberOfNeighbors, searchRadius));
     }
 
-    if (!interpolation)
+    if (!interpolation && !batchInterpolation)
     {
       smtkErrorMacro(this->log(), "Could not read points.");
       return this->createResult(smtk::operation::Operation::Outcome::FAILED);
@@ -346,7 +382,7 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
   std::function<double(std::array<double, 3>)> externalDataPoint = [](std::array<double, 3> xyz) {
     return xyz[2];
   };
-  if (interpolationSchemeItem->value() == "radial average")
+  if (externalPointItem)
   {
     if (externalPointItem->value() == "set to NaN")
     {
@@ -380,15 +416,42 @@ InterpolateOntoMesh::Result InterpolateOntoMesh::operateInternal()
     return f_x;
   };
 
+  // The same, for a batch of points.
+  smtk::mesh::utility::BatchMapping batchFn =
+    [&](std::size_t n, const double* xyz, double* values) {
+      batchInterpolation(n, xyz, values);
+      for (std::size_t j = 0; j < n; ++j)
+      {
+        values[j] = postProcess(values[j]);
+        if (std::isnan(values[j]))
+        {
+          const double* x = xyz + 3 * j;
+          values[j] = externalDataPoint(std::array<double, 3>({ { x[0], x[1], x[2] } }));
+        }
+      }
+    };
+
   // apply the interpolator to the meshes and populate the result attributes
   for (std::size_t i = 0; i < meshItem->numberOfValues(); i++)
   {
     smtk::mesh::Component::Ptr meshComponent = meshItem->valueAs<smtk::mesh::Component>(i);
     smtk::mesh::MeshSet mesh = meshComponent->mesh();
 
+    // Batched interpolators are evaluated on one thread per core.
     if (modeItem->value(0) == CELL_FIELD)
     {
-      smtk::mesh::utility::applyScalarCellField(fn, nameItem->value(), mesh);
+      if (batchInterpolation)
+      {
+        smtk::mesh::utility::applyScalarCellField(batchFn, nameItem->value(), mesh, 0);
+      }
+      else
+      {
+        smtk::mesh::utility::applyScalarCellField(fn, nameItem->value(), mesh);
+      }
+    }
+    else if (batchInterpolation)
+    {
+      smtk::mesh::utility::applyScalarPointField(batchFn, nameItem->value(), mesh, 0);
     }
     else
     {
@@ -0,0 +1,150 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/CellField.h"
+#include "smtk/mesh/core/PointField.h"
+#include "smtk/mesh/core/Resource.h"
+
+#include "smtk/mesh/native/Interface.h"
+
+#include "smtk/mesh/utility/ApplyToMesh.h"
+#include "smtk/mesh/utility/Create.h"
+
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace
+{
+
+smtk::mesh::MeshSet createVolume(std::size_t n)
+{
+  smtk::mesh::ResourcePtr resource =
+    smtk::mesh::Resource::create(smtk::mesh::native::make_interface());
+  smtk::mesh::utility::createUniformGrid(
+    resource, { { n, n, n } }, [](std::array<double, 3> x) { return x; });
+  return resource->meshes(smtk::mesh::Dims3);
+}
+
+double scalar(const double* x)
+{
+  return x[0] + 2. * x[1] + 3. * x[2];
+}
+
+std::array<double, 3> warp(const double* x)
+{
+  return { { 2. * x[0], x[1] + 1., x[2] * x[2] } };
+}
+
+void scalarBatch(std::size_t n, const double* xyz, double* values)
+{
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    values[i] = scalar(xyz + 3 * i);
+  }
+}
+
+void vectorBatch(std::size_t n, const double* xyz, double* values)
+{
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    std::array<double, 3> f_x = warp(xyz + 3 * i);
+    std::copy(f_x.begin(), f_x.end(), values + 3 * i);
+  }
+}
+
+void verify_point_fields()
+{
+  // enough points to span several blocks
+  smtk::mesh::MeshSet volume = createVolume(30);
+  std::vector<double> xyz;
+  volume.points().get(xyz);
+
+  test(
+    smtk::mesh::utility::applyScalarPointField(
+      [](std::array<double, 3> x) { return scalar(x.data()); }, "single", volume),
+    "per-point scalar field should be applied");
+  test(
+    smtk::mesh::utility::applyScalarPointField(scalarBatch, "batched", volume, 4),
+    "batched scalar field should be applied");
+
+  std::vector<double> single = volume.pointField("single").get<double>();
+  std::vector<double> batched = volume.pointField("batched").get<double>();
+  test(single.size() == volume.points().size(), "wrong scalar field size");
+  test(single == batched, "batched scalar field differs from per-point field");
+  for (std::size_t i = 0; i < single.size(); ++i)
+  {
+    test(single[i] == scalar(&xyz[3 * i]), "scalar field differs from its mapping");
+  }
+
+  test(
+    smtk::mesh::utility::applyVectorPointField(vectorBatch, "vector", volume, 0),
+    "batched vector field should be applied");
+  std::vector<double> vector = volume.pointField("vector").get<double>();
+  test(vector.size() == xyz.size(), "wrong vector field size");
+  for (std::size_t i = 0; i < vector.size(); i += 3)
+  {
+    std::array<double, 3> f_x = warp(&xyz[i]);
+    test(std::equal(f_x.begin(), f_x.end(), &vector[i]), "vector field differs from its mapping");
+  }
+}
+
+void verify_cell_fields()
+{
+  smtk::mesh::MeshSet volume = createVolume(10);
+
+  test(
+    smtk::mesh::utility::applyScalarCellField(
+      [](std::array<double, 3> x) { return scalar(x.data()); }, "single", volume),
+    "per-point scalar cell field should be applied");
+  test(
+    smtk::mesh::utility::applyScalarCellField(scalarBatch, "batched", volume, 2),
+    "batched scalar cell field should be applied");
+
+  std::vector<double> single = volume.cellField("single").get<double>();
+  std::vector<double> batched = volume.cellField("batched").get<double>();
+  test(single.size() == volume.cells().size(), "wrong cell field size");
+  test(single == batched, "batched cell field differs from per-point field");
+}
+
+void verify_warp()
+{
+  smtk::mesh::MeshSet volume = createVolume(30);
+  std::vector<double> xyz;
+  volume.points().get(xyz);
+
+  test(
+    smtk::mesh::utility::applyWarp(vectorBatch, volume, true, 4), "batched warp should be applied");
+
+  std::vector<double> warped;
+  volume.points().get(warped);
+  for (std::size_t i = 0; i < warped.size(); i += 3)
+  {
+    std::array<double, 3> f_x = warp(&xyz[i]);
+    test(std::equal(f_x.begin(), f_x.end(), &warped[i]), "point wasn't warped by its mapping");
+  }
+
+  test(smtk::mesh::utility::undoWarp(volume), "warp should be undone");
+  std::vector<double> restored;
+  volume.points().get(restored);
+  test(restored == xyz, "undoing the warp should restore the coordinates");
+}
+} // namespace
+
+int UnitTestApplyToMesh(int /*unused*/, char** const /*unused*/)
+{
+  verify_point_fields();
+  verify_cell_fields();
+  verify_warp();
+
+  return 0;
+}
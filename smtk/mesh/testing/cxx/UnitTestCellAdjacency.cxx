@@ -0,0 +1,125 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/CellAdjacency.h"
+#include "smtk/mesh/core/Resource.h"
+
+#include "smtk/mesh/native/Interface.h"
+
+#include "smtk/mesh/utility/Create.h"
+
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+
+smtk::mesh::ResourcePtr createSurface(std::size_t n)
+{
+  smtk::mesh::ResourcePtr resource =
+    smtk::mesh::Resource::create(smtk::mesh::native::make_interface());
+  smtk::mesh::utility::createUniformGrid(
+    resource, std::array<std::size_t, 2>{ { n, n } }, [](std::array<double, 3> x) { return x; });
+  return resource;
+}
+
+void verify_neighbors()
+{
+  smtk::mesh::ResourcePtr resource = createSurface(6);
+  smtk::mesh::CellSet quads = resource->cells(smtk::mesh::Dims2);
+  test(quads.size() == 36, "wrong number of quads");
+
+  auto adjacency = resource->cellAdjacency(quads);
+  test(adjacency->numberOfCells() == quads.size(), "adjacency should cover every cell");
+
+  for (std::size_t i = 0; i < adjacency->numberOfCells(); ++i)
+  {
+    smtk::mesh::Handle cell = adjacency->handle(i);
+    test(adjacency->index(cell) == i, "index and handle should be inverses");
+
+    smtk::mesh::HandleRange expected = resource->interface()->neighbors(cell) & quads.range();
+    smtk::mesh::HandleRange neighbors;
+    for (const std::size_t* n = adjacency->neighborsBegin(i); n != adjacency->neighborsEnd(i); ++n)
+    {
+      neighbors.insert(adjacency->handle(*n));
+    }
+    test(neighbors == expected, "adjacency differs from the interface's neighbors");
+    test(neighbors.size() >= 2 && neighbors.size() <= 4, "wrong number of grid neighbors");
+  }
+  test(
+    adjacency->index(resource->points().range().begin()->lower()) == adjacency->numberOfCells(),
+    "points should not be in the adjacency");
+}
+
+void verify_cache()
+{
+  smtk::mesh::ResourcePtr resource = createSurface(4);
+  smtk::mesh::CellSet quads = resource->cells(smtk::mesh::Dims2);
+
+  auto adjacency = resource->cellAdjacency(quads);
+  test(resource->cellAdjacency(quads) == adjacency, "adjacency should be cached");
+
+  smtk::mesh::Handle firstQuad = quads.range().begin()->lower();
+  smtk::mesh::HandleRange part(smtk::mesh::HandleInterval(firstQuad, firstQuad + 7));
+  auto partial = resource->cellAdjacency(smtk::mesh::CellSet(resource, part));
+  test(partial != adjacency, "different cells should rebuild the adjacency");
+  test(partial->numberOfCells() == 8, "adjacency should be restricted to its cells");
+
+  adjacency = resource->cellAdjacency(quads);
+  std::size_t revision = resource->interface()->connectivityRevision();
+  smtk::mesh::Handle first;
+  std::vector<double*> coordinates;
+  test(resource->interface()->allocator()->allocatePoints(1, first, coordinates));
+  test(resource->interface()->connectivityRevision() != revision, "revision should change");
+  test(
+    resource->cellAdjacency(quads) != adjacency, "connectivity edits should rebuild the adjacency");
+}
+
+void verify_grow()
+{
+  smtk::mesh::ResourcePtr resource = createSurface(5);
+  smtk::mesh::CellSet quads = resource->cells(smtk::mesh::Dims2);
+  auto adjacency = resource->cellAdjacency(quads);
+
+  smtk::mesh::HandleRange seed(quads.range().begin()->lower());
+  smtk::mesh::HandleRange all =
+    adjacency->grow(seed, [](std::size_t, std::size_t) { return true; });
+  test(all == quads.range(), "growing without limits should reach every cell");
+
+  smtk::mesh::HandleRange none =
+    adjacency->grow(seed, [](std::size_t, std::size_t) { return false; });
+  test(none == seed, "growing without accepting should leave the seeds");
+
+  // Only accept cells within two steps of the seed
+  std::vector<int> depth(adjacency->numberOfCells(), 0);
+  smtk::mesh::HandleRange near =
+    adjacency->grow(seed, [&depth](std::size_t cell, std::size_t neighbor) {
+      if (depth[cell] == 2)
+      {
+        return false;
+      }
+      depth[neighbor] = depth[cell] + 1;
+      return true;
+    });
+  // The corner cell of the grid, its 2 neighbors and their 3 neighbors
+  test(near.size() == 6, "wrong number of cells within two steps");
+}
+} // namespace
+
+int UnitTestCellAdjacency(int /*unused*/, char** const /*unused*/)
+{
+  verify_neighbors();
+  verify_cache();
+  verify_grow();
+
+  return 0;
+}
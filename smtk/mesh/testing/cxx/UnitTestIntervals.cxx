@@ -9,14 +9,142 @@
 //=========================================================================
 
 #include <iostream>
+#include <random>
 #include <typeinfo>
 
 #include "smtk/mesh/core/Handle.h"
 
 #include "smtk/mesh/json/jsonHandleRange.h"
 
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include <boost/icl/interval_set.hpp>
+
 using nlohmann::json;
 
+namespace
+{
+typedef boost::icl::interval_set<smtk::mesh::Handle, std::less, smtk::mesh::HandleInterval>
+  IntervalSet;
+
+bool same(const smtk::mesh::HandleRange& range, const IntervalSet& set)
+{
+  if (range.size() != set.size() || range.iterative_size() != set.iterative_size())
+  {
+    return false;
+  }
+  auto j = set.begin();
+  for (auto i = range.begin(); i != range.end(); ++i, ++j)
+  {
+    if (i->lower() != j->lower() || i->upper() != j->upper())
+    {
+      return false;
+    }
+  }
+  return std::equal(
+    range.elements_begin(),
+    range.elements_end(),
+    boost::icl::elements_begin(set),
+    boost::icl::elements_end(set));
+}
+
+// Apply the same random operations to a HandleRange and to the
+// boost::icl::interval_set it replaced, and check that they agree.
+void verify_against_interval_set()
+{
+  using namespace smtk::mesh;
+
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<Handle> handle(0, 200);
+  std::uniform_int_distribution<Handle> width(0, 8);
+  std::uniform_int_distribution<int> operation(0, 7);
+
+  HandleRange range;
+  IntervalSet set;
+  for (int i = 0; i < 5000; ++i)
+  {
+    HandleRange otherRange;
+    IntervalSet otherSet;
+    for (int j = 0; j < 4; ++j)
+    {
+      Handle lower = handle(generator);
+      HandleInterval interval(lower, lower + width(generator));
+      otherRange.insert(interval);
+      otherSet.insert(interval);
+    }
+    test(same(otherRange, otherSet), "ranges built by insertion differ");
+
+    Handle lower = handle(generator);
+    HandleInterval interval(lower, lower + width(generator));
+    switch (operation(generator))
+    {
+      case 0:
+        range.insert(interval);
+        set.insert(interval);
+        break;
+      case 1:
+        range.erase(interval);
+        set.erase(interval);
+        break;
+      case 2:
+        range += otherRange;
+        set += otherSet;
+        break;
+      case 3:
+        range -= otherRange;
+        set -= otherSet;
+        break;
+      case 4:
+        range &= otherRange + interval;
+        set &= otherSet + interval;
+        break;
+      case 5:
+        range ^= otherRange;
+        set ^= otherSet;
+        break;
+      case 6:
+        range.insert(lower);
+        set.insert(lower);
+        break;
+      default:
+        range.erase(lower);
+        set.erase(lower);
+        break;
+    }
+    test(same(range, set), "range differs from interval_set");
+
+    test(
+      rangeContains(range, lower) == boost::icl::contains(set, lower),
+      "rangeContains differs for a handle");
+    test(
+      rangeContains(range, interval) == boost::icl::contains(set, interval),
+      "rangeContains differs for an interval");
+    test(
+      rangeContains(range, otherRange) == boost::icl::contains(set, otherSet),
+      "rangeContains differs for a range");
+    test(
+      (range.find(interval) == range.end()) == (set.find(interval) == set.end()),
+      "find differs for an interval");
+    test(
+      rangesIntersect(range, otherRange) == boost::icl::intersects(set, otherSet),
+      "rangesIntersect differs");
+    test(
+      (range < otherRange || otherRange < range) == (set != otherSet),
+      "ranges are ordered inconsistently with equality");
+    test((range == otherRange) == (set == otherSet), "ranges compare differently");
+    if (!range.empty())
+    {
+      std::size_t index = handle(generator) % range.size();
+      Handle element = rangeElement(range, index);
+      test(
+        element == *std::next(boost::icl::elements_begin(set), index), "rangeElement differs");
+      test(rangeIndex(range, element) == index, "rangeIndex differs");
+      test(*std::prev(range.elements_end()) == set.rbegin()->upper(), "wrong last element");
+    }
+  }
+}
+} // namespace
+
 int UnitTestIntervals(int /*unused*/, char** const /*unused*/)
 {
   using namespace smtk::mesh;
@@ -56,6 +184,9 @@ int UnitTestIntervals(int /*unused*/, char** const /*unused*/)
 
   HandleRange range3 = j;
   std::cout << range3 << std::endl;
+  test(range3 == range1, "range should survive a round trip through json");
+
+  verify_against_interval_set();
 
   return 0;
 }
@@ -0,0 +1,184 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/interpolation/InverseDistanceWeighting.h"
+#include "smtk/mesh/interpolation/PointCloud.h"
+#include "smtk/mesh/interpolation/StructuredGrid.h"
+
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// Evaluate Shepard's method by visiting every source.
+double bruteForce(
+  const std::vector<double>& coordinates,
+  const std::vector<double>& data,
+  const double* p,
+  double power,
+  std::size_t numberOfNeighbors,
+  double radius)
+{
+  std::vector<std::pair<double, double>> sources;
+  for (std::size_t i = 0; i < data.size(); ++i)
+  {
+    double dx = coordinates[3 * i] - p[0];
+    double dy = coordinates[3 * i + 1] - p[1];
+    double dz = coordinates[3 * i + 2] - p[2];
+    double d = std::sqrt(dx * dx + dy * dy + dz * dz);
+    if (radius == 0. || d <= radius)
+    {
+      sources.emplace_back(d, data[i]);
+    }
+  }
+  std::sort(sources.begin(), sources.end());
+  if (numberOfNeighbors > 0 && sources.size() > numberOfNeighbors)
+  {
+    sources.resize(numberOfNeighbors);
+  }
+
+  double num = 0., denom = 0.;
+  for (const auto& source : sources)
+  {
+    double w = std::pow(source.first, -power);
+    num += w * source.second;
+    denom += w;
+  }
+  return sources.empty() ? std::numeric_limits<double>::quiet_NaN() : num / denom;
+}
+
+bool same(double a, double b)
+{
+  return (std::isnan(a) && std::isnan(b)) || std::abs(a - b) < 1.e-9;
+}
+
+void verify_point_cloud()
+{
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> uniform(0., 10.);
+
+  // A flat-ish cloud, similar to LIDAR data
+  const std::size_t numberOfSources = 2000;
+  std::vector<double> coordinates;
+  std::vector<double> data;
+  for (std::size_t i = 0; i < numberOfSources; ++i)
+  {
+    coordinates.push_back(uniform(generator));
+    coordinates.push_back(uniform(generator));
+    coordinates.push_back(0.1 * uniform(generator));
+    data.push_back(uniform(generator));
+  }
+  smtk::mesh::PointCloud pointcloud(numberOfSources, coordinates.data(), data.data());
+
+  // Query points inside and outside of the cloud's bounds
+  const std::size_t numberOfPoints = 2000;
+  std::vector<double> points;
+  for (std::size_t i = 0; i < 3 * numberOfPoints; ++i)
+  {
+    points.push_back(1.4 * uniform(generator) - 2.);
+  }
+
+  for (double power : { 1., 2., 3. })
+  {
+    for (std::size_t numberOfNeighbors : { 0, 1, 8 })
+    {
+      for (double radius : { 0., 0.5 })
+      {
+        smtk::mesh::InverseDistanceWeighting idw(pointcloud, power, numberOfNeighbors, radius);
+
+        std::vector<double> values(numberOfPoints);
+        idw(numberOfPoints, points.data(), values.data(), 4);
+
+        for (std::size_t i = 0; i < numberOfPoints; ++i)
+        {
+          const double* p = &points[3 * i];
+          double expected = bruteForce(coordinates, data, p, power, numberOfNeighbors, radius);
+          test(same(values[i], expected), "batched evaluation differs from brute force");
+          test(
+            same(idw({ { p[0], p[1], p[2] } }), expected),
+            "single evaluation differs from brute force");
+        }
+      }
+    }
+  }
+
+  // Sources rejected by the prefilter don't contribute, whether or not the
+  // sources are bounded
+  auto prefilter = [](double value) { return value < 5.; };
+  std::vector<double> filteredCoordinates;
+  std::vector<double> filteredData;
+  for (std::size_t i = 0; i < numberOfSources; ++i)
+  {
+    if (prefilter(data[i]))
+    {
+      filteredCoordinates.insert(
+        filteredCoordinates.end(), &coordinates[3 * i], &coordinates[3 * i] + 3);
+      filteredData.push_back(data[i]);
+    }
+  }
+
+  smtk::mesh::InverseDistanceWeighting unbounded(pointcloud, 2., prefilter);
+  smtk::mesh::InverseDistanceWeighting nearest(pointcloud, 2., 8, 0., prefilter);
+  for (std::size_t i = 0; i < numberOfPoints; ++i)
+  {
+    const double* p = &points[3 * i];
+    test(
+      same(
+        unbounded({ { p[0], p[1], p[2] } }),
+        bruteForce(filteredCoordinates, filteredData, p, 2., 0, 0.)),
+      "filtered sources should not contribute");
+    test(
+      same(
+        nearest({ { p[0], p[1], p[2] } }),
+        bruteForce(filteredCoordinates, filteredData, p, 2., 8, 0.)),
+      "filtered sources should not contribute to nearest neighbors");
+  }
+}
+
+void verify_structured_grid()
+{
+  int extent[4] = { 0, 10, 0, 10 };
+  double origin[2] = { 0., 0. };
+  double spacing[2] = { 1., 1. };
+  smtk::mesh::StructuredGrid structuredgrid(
+    extent, origin, spacing, [](int i, int j) { return static_cast<double>(i + j); });
+
+  smtk::mesh::InverseDistanceWeighting unbounded(structuredgrid, 2.);
+  smtk::mesh::InverseDistanceWeighting nearest(structuredgrid, 2., 4, 0.);
+
+  // Grid points return their own value
+  test(unbounded({ { 3., 4., 0. } }) == 7., "grid point should return its value");
+  test(nearest({ { 3., 4., 0. } }) == 7., "grid point should return its value");
+
+  // The center of a grid cell is the average of its four corners
+  test(std::abs(nearest({ { 3.5, 4.5, 0. } }) - 8.) < 1.e-12, "wrong value at cell center");
+
+  // Sources rejected by the prefilter don't contribute, and a point with no
+  // sources within the search radius has no value
+  smtk::mesh::InverseDistanceWeighting filtered(
+    structuredgrid, 2., 0, 0.6, [](double value) { return value > 100.; });
+  test(std::isnan(filtered({ { 3., 4., 0. } })), "filtered sources should not contribute");
+}
+} // namespace
+
+int UnitTestInverseDistanceWeighting(int /*unused*/, char** const /*unused*/)
+{
+  verify_point_cloud();
+  verify_structured_grid();
+
+  return 0;
+}
@@ -0,0 +1,183 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/mesh/core/CellField.h"
+#include "smtk/mesh/core/PointField.h"
+#include "smtk/mesh/core/PointLocator.h"
+#include "smtk/mesh/core/Resource.h"
+
+#include "smtk/mesh/native/Interface.h"
+
+#include "smtk/mesh/utility/Create.h"
+#include "smtk/mesh/utility/ExtractTessellation.h"
+
+#include "smtk/mesh/testing/cxx/helpers.h"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+
+smtk::mesh::ResourcePtr createGrid(smtk::mesh::native::IndexWidth width, std::size_t n)
+{
+  smtk::mesh::ResourcePtr resource =
+    smtk::mesh::Resource::create(smtk::mesh::native::make_interface(width));
+  smtk::mesh::utility::createUniformGrid(
+    resource, { { n, n, n } }, [](std::array<double, 3> x) { return x; });
+  return resource;
+}
+
+void verify_construction(smtk::mesh::native::IndexWidth width)
+{
+  smtk::mesh::InterfacePtr iface = smtk::mesh::native::make_interface(width);
+  smtk::mesh::ResourcePtr resource = smtk::mesh::Resource::create(iface);
+
+  test(resource->isValid(), "resource should be valid");
+  test(!resource->isModified(), "resource shouldn't be modified");
+  test(iface->name() == "native", "interface should be named native");
+
+  smtk::mesh::AllocatorPtr allocator = resource->interface()->allocator();
+  test(!!allocator, "native allocator should be valid");
+  test(resource->isModified(), "resource should be modified once the allocator is accessed");
+}
+
+void verify_uniform_grid(smtk::mesh::native::IndexWidth width)
+{
+  const std::size_t n = 4;
+  smtk::mesh::ResourcePtr resource = createGrid(width, n);
+
+  test(resource->numberOfMeshes() == 7, "uniform grid should have 7 meshsets");
+  test(resource->points().size() == (n + 1) * (n + 1) * (n + 1), "wrong number of points");
+  test(resource->cells(smtk::mesh::Dims3).size() == n * n * n, "wrong number of hexahedra");
+  test(resource->cells(smtk::mesh::Dims2).size() == 6 * n * n, "wrong number of quads");
+
+  //the coordinates are held in the unit cube
+  std::vector<double> xyz;
+  resource->points().get(xyz);
+  test(xyz.size() == 3 * resource->points().size(), "wrong number of coordinates");
+  for (double value : xyz)
+  {
+    test(value >= 0. && value <= 1., "coordinate outside of the unit cube");
+  }
+
+  //extracting the tessellation visits every cell of the volume
+  smtk::mesh::MeshSet volume = resource->meshes(smtk::mesh::Dims3);
+  std::int64_t connectivityLength = -1, numberOfCells = -1, numberOfPoints = -1;
+  smtk::mesh::utility::PreAllocatedTessellation::determineAllocationLengths(
+    volume, connectivityLength, numberOfCells, numberOfPoints);
+  test(numberOfCells == static_cast<std::int64_t>(n * n * n), "wrong tessellation cell count");
+  test(connectivityLength == static_cast<std::int64_t>(8 * n * n * n), "wrong connectivity length");
+}
+
+void verify_shell(smtk::mesh::native::IndexWidth width)
+{
+  const std::size_t n = 3;
+  smtk::mesh::ResourcePtr resource = createGrid(width, n);
+  const std::size_t numberOfCells = resource->cells().size();
+
+  //the boundary quads already exist, so extracting the shell reuses them
+  bool created = true;
+  smtk::mesh::MeshSet shell = resource->meshes(smtk::mesh::Dims3).extractShell(created);
+  test(shell.cells().size() == 6 * n * n, "wrong number of shell cells");
+  test(resource->cells().size() == numberOfCells, "shell extraction shouldn't create cells");
+
+  //the edges of the volume don't exist, so they are created
+  smtk::mesh::MeshSet edges =
+    resource->meshes(smtk::mesh::Dims3).extractAdjacenciesOfDimension(1, created);
+  const std::size_t numberOfEdges = 3 * n * (n + 1) * (n + 1);
+  test(edges.cells().size() == numberOfEdges, "wrong number of edges");
+  test(
+    resource->cells().size() == numberOfCells + numberOfEdges,
+    "edge extraction should create cells");
+
+  //a second extraction reuses the created edges
+  edges = resource->meshes(smtk::mesh::Dims3).extractAdjacenciesOfDimension(1, created);
+  test(
+    resource->cells().size() == numberOfCells + numberOfEdges,
+    "edge extraction should reuse existing cells");
+}
+
+void verify_fields(smtk::mesh::native::IndexWidth width)
+{
+  smtk::mesh::ResourcePtr resource = createGrid(width, 3);
+  smtk::mesh::MeshSet volume = resource->meshes(smtk::mesh::Dims3);
+
+  std::vector<double> cellValues(volume.cells().size());
+  for (std::size_t i = 0; i < cellValues.size(); ++i)
+  {
+    cellValues[i] = static_cast<double>(i);
+  }
+  smtk::mesh::CellField cellField =
+    volume.createCellField("cellData", 1, smtk::mesh::FieldType::Double, cellValues.data());
+  test(cellField.isValid(), "cell field should be valid");
+  test(cellField.get<double>() == cellValues, "cell field values should round trip");
+  test(volume.cellFields().size() == 1, "volume should have one cell field");
+
+  std::vector<int> pointValues(3 * volume.points().size());
+  for (std::size_t i = 0; i < pointValues.size(); ++i)
+  {
+    pointValues[i] = static_cast<int>(i);
+  }
+  smtk::mesh::PointField pointField =
+    volume.createPointField("pointData", 3, smtk::mesh::FieldType::Integer, pointValues.data());
+  test(pointField.isValid(), "point field should be valid");
+  test(pointField.get<int>() == pointValues, "point field values should round trip");
+
+  test(volume.removeCellField(cellField), "cell field should be removed");
+  test(volume.cellFields().empty(), "volume shouldn't have cell fields");
+}
+
+void verify_point_locator(smtk::mesh::native::IndexWidth width)
+{
+  const std::size_t n = 4;
+  smtk::mesh::ResourcePtr resource = createGrid(width, n);
+  smtk::mesh::PointLocator locator(resource->points());
+  test(locator.range().size() == resource->points().size(), "locator should hold every point");
+
+  //the origin and its three neighbors along the axes are within a cell width
+  smtk::mesh::PointLocator::LocatorResults results;
+  results.want_sqDistances = true;
+  locator.find(0., 0., 0., 1.01 / n, results);
+  test(results.pointIds.size() == 4, "wrong number of points near the origin");
+  test(results.sqDistances.size() == 4, "wrong number of distances near the origin");
+}
+
+void verify_delete_and_merge(smtk::mesh::native::IndexWidth width)
+{
+  smtk::mesh::ResourcePtr resource = createGrid(width, 2);
+  const std::size_t numberOfPoints = resource->points().size();
+
+  //merging a mesh without coincident points leaves the points in place
+  test(resource->meshes().mergeCoincidentContactPoints(), "merge should succeed");
+  test(resource->points().size() == numberOfPoints, "merge shouldn't remove points");
+
+  smtk::mesh::MeshSet faces = resource->meshes(smtk::mesh::Dims2);
+  const std::size_t numberOfMeshes = resource->numberOfMeshes();
+  test(resource->removeMeshes(faces), "faces should be removed");
+  test(resource->numberOfMeshes() == numberOfMeshes - 6, "wrong number of meshsets");
+}
+} // namespace
+
+int UnitTestNativeInterface(int /*unused*/, char** const /*unused*/)
+{
+  for (auto width :
+       { smtk::mesh::native::IndexWidth::Bits32, smtk::mesh::native::IndexWidth::Bits64 })
+  {
+    verify_construction(width);
+    verify_uniform_grid(width);
+    verify_shell(width);
+    verify_fields(width);
+    verify_point_locator(width);
+    verify_delete_and_merge(width);
+  }
+
+  return 0;
+}
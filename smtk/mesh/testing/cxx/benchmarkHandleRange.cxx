@@ -0,0 +1,164 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/mesh/core/Handle.h"
+
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include <boost/icl/interval_set.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using smtk::model::testing::Timer;
+
+// Compare smtk::mesh::HandleRange with the boost::icl::interval_set it
+// replaced when building ranges, combining them with set operations and
+// iterating over their handles. Ranges are either fragmented (many short
+// intervals, as produced by selections) or contiguous (a few long intervals,
+// as produced by mesh creation). Ranges are built in increasing order, which
+// is how the mesh interfaces produce them; a tenth of the intervals are also
+// inserted in random order, which costs HandleRange time proportional to the
+// number of intervals that follow each insertion. The number of intervals
+// per range may be passed as an argument.
+
+namespace
+{
+typedef boost::icl::interval_set<smtk::mesh::Handle, std::less, smtk::mesh::HandleInterval>
+  IntervalSet;
+
+std::vector<smtk::mesh::HandleInterval> intervals(std::size_t n, std::size_t width, unsigned seed)
+{
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<smtk::mesh::Handle> gap(1, 2 * width);
+  std::vector<smtk::mesh::HandleInterval> result;
+  smtk::mesh::Handle lower = 1;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    lower += gap(generator);
+    result.emplace_back(lower, lower + width - 1);
+    lower += width;
+  }
+  return result;
+}
+
+std::size_t sum(const IntervalSet& range)
+{
+  std::size_t total = 0;
+  for (auto i = boost::icl::elements_begin(range); i != boost::icl::elements_end(range); ++i)
+  {
+    total += *i;
+  }
+  return total;
+}
+
+std::size_t sum(const smtk::mesh::HandleRange& range)
+{
+  std::size_t total = 0;
+  for (auto i = range.elements_begin(); i != range.elements_end(); ++i)
+  {
+    total += *i;
+  }
+  return total;
+}
+
+template<typename Range>
+bool benchmark(
+  const char* label,
+  const std::vector<smtk::mesh::HandleInterval>& a,
+  const std::vector<smtk::mesh::HandleInterval>& b,
+  const std::vector<smtk::mesh::HandleInterval>& unordered,
+  std::size_t& checksum)
+{
+  Timer timer;
+  double deltaT;
+
+  // #### Build
+  timer.mark();
+  Range lhs, rhs;
+  for (const auto& interval : a)
+  {
+    lhs.insert(interval);
+  }
+  for (const auto& interval : b)
+  {
+    rhs.insert(interval);
+  }
+  deltaT = timer.elapsed();
+  std::cout << label << " build        " << deltaT << " seconds\n";
+
+  // #### Unordered build
+  timer.mark();
+  Range shuffled;
+  for (const auto& interval : unordered)
+  {
+    shuffled.insert(interval);
+  }
+  deltaT = timer.elapsed();
+  std::cout << label << " shuffled     " << deltaT << " seconds\n";
+
+  // #### Set operations
+  timer.mark();
+  Range u = lhs | rhs;
+  Range i = lhs & rhs;
+  Range d = lhs - rhs;
+  deltaT = timer.elapsed();
+  std::cout << label << " set algebra  " << deltaT << " seconds\n";
+
+  // #### Size
+  timer.mark();
+  std::size_t size = 0;
+  for (int k = 0; k < 10; ++k)
+  {
+    size += u.size() + i.size() + d.size() + shuffled.size();
+  }
+  deltaT = timer.elapsed();
+  std::cout << label << " size         " << deltaT << " seconds\n";
+
+  // #### Element iteration
+  timer.mark();
+  std::size_t total = sum(u) + sum(i) + sum(d);
+  deltaT = timer.elapsed();
+  std::cout << label << " iteration    " << deltaT << " seconds\n";
+
+  bool ok = (checksum == 0 || checksum == total + size);
+  checksum = total + size;
+  return ok;
+}
+
+bool compare(const char* label, std::size_t n, std::size_t width)
+{
+  std::cout << label << ": " << n << " intervals of " << width << " handles\n";
+  auto a = intervals(n, width, 1);
+  auto b = intervals(n, width, 2);
+  std::vector<smtk::mesh::HandleInterval> unordered(a.begin(), a.begin() + n / 10);
+  std::shuffle(unordered.begin(), unordered.end(), std::mt19937(3));
+  std::size_t checksum = 0;
+  bool ok = benchmark<IntervalSet>("  interval_set", a, b, unordered, checksum);
+  ok &= benchmark<smtk::mesh::HandleRange>("  HandleRange ", a, b, unordered, checksum);
+  return ok;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 100000;
+
+  bool ok = compare("fragmented", n, 4);
+  ok &= compare("contiguous", n / 1000 + 1, 100000);
+  if (!ok)
+  {
+    std::cerr << "The ranges produced different results.\n";
+    return 1;
+  }
+  return 0;
+}
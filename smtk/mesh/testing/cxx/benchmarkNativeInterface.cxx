@@ -0,0 +1,102 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/mesh/core/CellField.h"
+#include "smtk/mesh/core/PointField.h"
+#include "smtk/mesh/core/Resource.h"
+
+#include "smtk/mesh/moab/Interface.h"
+#include "smtk/mesh/native/Interface.h"
+
+#include "smtk/mesh/utility/Create.h"
+#include "smtk/mesh/utility/ExtractTessellation.h"
+
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using smtk::model::testing::Timer;
+
+// Compare the MOAB and native mesh interfaces when extracting the
+// tessellation, extracting the skin and reading and writing fields of a
+// hexahedral grid. The number of cells along each axis may be passed as an
+// argument.
+
+namespace
+{
+bool benchmark(const char* label, const smtk::mesh::InterfacePtr& iface, std::size_t n)
+{
+  Timer timer;
+  double deltaT;
+
+  // #### Create
+  timer.mark();
+  smtk::mesh::ResourcePtr resource = smtk::mesh::Resource::create(iface);
+  smtk::mesh::utility::createUniformGrid(
+    resource, { { n, n, n } }, [](std::array<double, 3> x) { return x; });
+  smtk::mesh::MeshSet volume = resource->meshes(smtk::mesh::Dims3);
+  deltaT = timer.elapsed();
+  std::cout << label << " create       " << deltaT << " seconds\n";
+
+  // #### ExtractTessellation
+  timer.mark();
+  std::int64_t connectivityLength = -1, numberOfCells = -1, numberOfPoints = -1;
+  smtk::mesh::utility::PreAllocatedTessellation::determineAllocationLengths(
+    volume, connectivityLength, numberOfCells, numberOfPoints);
+  std::vector<std::int64_t> conn(connectivityLength + numberOfCells);
+  std::vector<std::int64_t> locations(numberOfCells);
+  std::vector<unsigned char> types(numberOfCells);
+  std::vector<float> points(numberOfPoints * 3);
+  smtk::mesh::utility::PreAllocatedTessellation tessellation(
+    conn.data(), locations.data(), types.data(), points.data());
+  smtk::mesh::utility::extractTessellation(volume, tessellation);
+  deltaT = timer.elapsed();
+  std::cout << label << " tessellation " << deltaT << " seconds\n";
+
+  // #### ExtractSkin
+  timer.mark();
+  smtk::mesh::MeshSet shell = volume.extractShell();
+  deltaT = timer.elapsed();
+  std::cout << label << " skin         " << deltaT << " seconds\n";
+  bool ok = shell.cells().size() == 6 * n * n;
+
+  // #### Field I/O
+  timer.mark();
+  std::vector<double> cellValues(volume.cells().size(), 1.);
+  smtk::mesh::CellField cellField =
+    volume.createCellField("cellData", 1, smtk::mesh::FieldType::Double, cellValues.data());
+  ok &= cellField.get(cellValues.data());
+  std::vector<double> pointValues(3 * volume.points().size(), 1.);
+  smtk::mesh::PointField pointField =
+    volume.createPointField("pointData", 3, smtk::mesh::FieldType::Double, pointValues.data());
+  ok &= pointField.get(pointValues.data());
+  deltaT = timer.elapsed();
+  std::cout << label << " fields       " << deltaT << " seconds\n";
+
+  return ok;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  std::size_t n = argc > 1 ? static_cast<std::size_t>(std::atoi(argv[1])) : 50;
+  std::cout << n << "^3 hexahedra\n";
+
+  bool ok = benchmark("moab  ", smtk::mesh::moab::make_interface(), n);
+  ok &= benchmark("native", smtk::mesh::native::make_interface(), n);
+  if (!ok)
+  {
+    std::cerr << "The interfaces produced unexpected results.\n";
+    return 1;
+  }
+  return 0;
+}
@@ -10,17 +10,24 @@
 
 #include "smtk/mesh/utility/ApplyToMesh.h"
 
+#include "smtk/common/ThreadPool.h"
+
 #include "smtk/mesh/core/CellField.h"
 #include "smtk/mesh/core/CellSet.h"
 #include "smtk/mesh/core/FieldTypes.h"
 #include "smtk/mesh/core/ForEachTypes.h"
+#include "smtk/mesh/core/Interface.h"
 #include "smtk/mesh/core/PointField.h"
 #include "smtk/mesh/core/PointSet.h"
+#include "smtk/mesh/core/Resource.h"
 
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <functional>
+#include <future>
+#include <memory>
+#include <vector>
 
 namespace smtk
 {
@@ -31,73 +38,198 @@ namespace utility
 
 namespace
 {
-class WarpPoints : public smtk::mesh::PointForEach
+// Coordinates are read from and written to the interface this many points at
+// a time, so the working buffers stay bounded for large meshes.
+const std::size_t ChunkSize = 1 << 18;
+
+// Each chunk is divided into blocks of this many points for the thread pool.
+const std::size_t BlockSize = 4096;
+
+// Split a range into consecutive subranges of at most <chunkSize> handles.
+std::vector<smtk::mesh::HandleRange> chunksOf(
+  const smtk::mesh::HandleRange& range,
+  std::size_t chunkSize)
 {
-  const std::function<std::array<double, 3>(std::array<double, 3>)>& m_mapping;
+  std::vector<smtk::mesh::HandleRange> chunks;
+  smtk::mesh::HandleRange chunk;
+  std::size_t size = 0;
+  for (const auto& interval : range)
+  {
+    smtk::mesh::Handle lower = interval.lower();
+    const smtk::mesh::Handle upper = interval.upper();
+    while (true)
+    {
+      smtk::mesh::Handle last = std::min<smtk::mesh::Handle>(upper, lower + (chunkSize - size) - 1);
+      chunk.insert(smtk::mesh::HandleInterval(lower, last));
+      size += last - lower + 1;
+      if (size == chunkSize)
+      {
+        chunks.push_back(chunk);
+        chunk.clear();
+        size = 0;
+      }
+      if (last == upper)
+      {
+        break;
+      }
+      lower = last + 1;
+    }
+  }
+  if (size > 0)
+  {
+    chunks.push_back(chunk);
+  }
+  return chunks;
+}
 
-public:
-  WarpPoints(const std::function<std::array<double, 3>(std::array<double, 3>)>& mapping)
-    : m_mapping(mapping)
+// Evaluate <f> over <n> packed points, dividing them into blocks across
+// <pool> if one is provided.
+void mapBlocks(
+  const BatchMapping& f,
+  std::size_t n,
+  const double* xyz,
+  double* values,
+  std::size_t dimension,
+  smtk::common::ThreadPool<>* pool)
+{
+  if (pool == nullptr || n <= BlockSize)
   {
+    f(n, xyz, values);
+    return;
   }
 
-  void forPoints(
-    const smtk::mesh::HandleRange& pointIds,
-    std::vector<double>& xyz,
-    bool& coordinatesModified) override
+  std::vector<std::future<void>> futures;
+  for (std::size_t begin = 0; begin < n; begin += BlockSize)
   {
-    std::size_t offset = 0;
-    std::array<double, 3> x, f_x;
-    for (auto i = smtk::mesh::rangeElementsBegin(pointIds);
-         i != smtk::mesh::rangeElementsEnd(pointIds);
-         ++i, offset += 3)
+    std::size_t count = std::min(BlockSize, n - begin);
+    futures.push_back((*pool)([&f, count, xyz, values, begin, dimension]() {
+      f(count, xyz + 3 * begin, values + dimension * begin);
+    }));
+  }
+  for (auto& future : futures)
+  {
+    // Run other pending tasks while waiting in case this thread is itself an
+    // executor worker.
+    smtk::common::Executor::instance().wait(future);
+    future.get();
+  }
+}
+
+std::unique_ptr<smtk::common::ThreadPool<>> poolFor(unsigned int numberOfThreads)
+{
+  std::unique_ptr<smtk::common::ThreadPool<>> pool;
+  if (numberOfThreads != 1)
+  {
+    pool.reset(new smtk::common::ThreadPool<>(numberOfThreads));
+  }
+  return pool;
+}
+
+// Evaluate <f> at every point of <ms>, storing the results packed with
+// <dimension> values per point in <values>.
+bool mapPoints(
+  const BatchMapping& f,
+  const smtk::mesh::MeshSet& ms,
+  std::size_t dimension,
+  std::vector<double>& values,
+  unsigned int numberOfThreads)
+{
+  smtk::mesh::PointSet points = ms.points();
+  const smtk::mesh::InterfacePtr& iface = ms.resource()->interface();
+  auto pool = poolFor(numberOfThreads);
+
+  values.resize(dimension * points.size());
+  std::vector<double> xyz;
+  std::size_t offset = 0;
+  for (const auto& chunk : chunksOf(points.range(), ChunkSize))
+  {
+    const std::size_t n = chunk.size();
+    xyz.resize(3 * n);
+    if (!iface->getCoordinates(chunk, xyz.data()))
     {
-      std::copy(&xyz[offset], &xyz[offset] + 3, &x[0]);
-      f_x = m_mapping(x);
-      std::copy(std::begin(f_x), std::end(f_x), &xyz[offset]);
+      return false;
     }
-    coordinatesModified = true; //mark we are going to modify the points
+    mapBlocks(f, n, xyz.data(), &values[dimension * offset], dimension, pool.get());
+    offset += n;
   }
-};
+  return true;
+}
 
-class StoreAndWarpPoints : public smtk::mesh::PointForEach
+class CellCentroids : public smtk::mesh::CellForEach
 {
-  const std::function<std::array<double, 3>(std::array<double, 3>)>& m_mapping;
+private:
   std::vector<double> m_data;
+  std::size_t m_counter;
 
 public:
-  StoreAndWarpPoints(
-    const std::function<std::array<double, 3>(std::array<double, 3>)>& mapping,
-    std::size_t nPoints)
-    : m_mapping(mapping)
-    , m_data(3 * nPoints)
+  CellCentroids(std::size_t nCells)
+    : smtk::mesh::CellForEach(true)
+    , m_data(3 * nCells)
+    , m_counter(0)
   {
   }
 
-  void forPoints(
-    const smtk::mesh::HandleRange& pointIds,
-    std::vector<double>& xyz,
-    bool& coordinatesModified) override
+  void forCell(const smtk::mesh::Handle& /*cellId*/, smtk::mesh::CellType /*cellType*/, int nPts)
+    override
   {
-    std::size_t offset = 0;
-    std::array<double, 3> x, f_x;
-    for (auto i = smtk::mesh::rangeElementsBegin(pointIds);
-         i != smtk::mesh::rangeElementsEnd(pointIds);
-         ++i, offset += 3)
+    double* centroid = &m_data[m_counter];
+    for (int i = 0; i < 3 * nPts; i += 3)
     {
-      std::copy(&xyz[offset], &xyz[offset] + 3, &x[0]);
-
-      std::copy(std::begin(x), std::end(x), &m_data[offset]);
-
-      f_x = m_mapping(x);
-      std::copy(std::begin(f_x), std::end(f_x), &xyz[offset]);
+      centroid[0] += this->coordinates()[i];
+      centroid[1] += this->coordinates()[i + 1];
+      centroid[2] += this->coordinates()[i + 2];
     }
-    coordinatesModified = true; //mark we are going to modify the points
+    for (int i = 0; i < 3; i++)
+    {
+      centroid[i] /= nPts;
+    }
+    m_counter += 3;
   }
 
   const std::vector<double>& data() const { return m_data; }
 };
 
+// Evaluate <f> at every cell centroid of <ms>, storing the results packed with
+// <dimension> values per cell in <values>.
+void mapCells(
+  const BatchMapping& f,
+  const smtk::mesh::MeshSet& ms,
+  std::size_t dimension,
+  std::vector<double>& values,
+  unsigned int numberOfThreads)
+{
+  smtk::mesh::CellSet cells = ms.cells();
+  CellCentroids centroids(cells.size());
+  smtk::mesh::for_each(cells, centroids);
+
+  auto pool = poolFor(numberOfThreads);
+  values.resize(dimension * cells.size());
+  mapBlocks(f, cells.size(), centroids.data().data(), values.data(), dimension, pool.get());
+}
+
+BatchMapping batched(const std::function<std::array<double, 3>(std::array<double, 3>)>& f)
+{
+  return [&f](std::size_t n, const double* xyz, double* values) {
+    std::array<double, 3> x, f_x;
+    for (std::size_t i = 0; i < 3 * n; i += 3)
+    {
+      std::copy(xyz + i, xyz + i + 3, &x[0]);
+      f_x = f(x);
+      std::copy(std::begin(f_x), std::end(f_x), values + i);
+    }
+  };
+}
+
+BatchMapping batched(const std::function<double(std::array<double, 3>)>& f)
+{
+  return [&f](std::size_t n, const double* xyz, double* values) {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      values[i] = f(std::array<double, 3>({ { xyz[3 * i], xyz[3 * i + 1], xyz[3 * i + 2] } }));
+    }
+  };
+}
+
 class UndoWarpPoints : public smtk::mesh::PointForEach
 {
   std::vector<double> m_data;
@@ -123,19 +255,54 @@ bool applyWarp(
   smtk::mesh::MeshSet& ms,
   bool storePriorCoordinates)
 {
+  return applyWarp(batched(f), ms, storePriorCoordinates);
+}
+
+bool applyWarp(
+  const BatchMapping& f,
+  smtk::mesh::MeshSet& ms,
+  bool storePriorCoordinates,
+  unsigned int numberOfThreads)
+{
+  smtk::mesh::PointSet points = ms.points();
+  const smtk::mesh::InterfacePtr& iface = ms.resource()->interface();
+  auto pool = poolFor(numberOfThreads);
+
+  std::vector<double> prior;
   if (storePriorCoordinates)
   {
-    StoreAndWarpPoints warp(f, ms.points().size());
-    smtk::mesh::for_each(ms.points(), warp);
-    return ms.createPointField("_prior", 3, smtk::mesh::FieldType::Double, &warp.data()[0])
-      .isValid();
+    prior.resize(3 * points.size());
   }
-  else
+
+  std::vector<double> xyz, warped;
+  std::size_t offset = 0;
+  for (const auto& chunk : chunksOf(points.range(), ChunkSize))
   {
-    WarpPoints warp(f);
-    smtk::mesh::for_each(ms.points(), warp);
-    return true;
+    const std::size_t n = chunk.size();
+    xyz.resize(3 * n);
+    warped.resize(3 * n);
+    if (!iface->getCoordinates(chunk, xyz.data()))
+    {
+      return false;
+    }
+    if (storePriorCoordinates)
+    {
+      std::copy(xyz.begin(), xyz.end(), &prior[3 * offset]);
+    }
+    mapBlocks(f, n, xyz.data(), warped.data(), 3, pool.get());
+    if (!iface->setCoordinates(chunk, warped.data()))
+    {
+      return false;
+    }
+    offset += n;
+  }
+
+  if (storePriorCoordinates)
+  {
+    return ms.createPointField("_prior", 3, smtk::mesh::FieldType::Double, prior.data())
+      .isValid();
   }
+  return true;
 }
 
 bool undoWarp(smtk::mesh::MeshSet& ms)
@@ -153,215 +320,86 @@ bool undoWarp(smtk::mesh::MeshSet& ms)
   return ms.removePointField(pointfield);
 }
 
-namespace
-{
-class ScalarPointField : public smtk::mesh::PointForEach
-{
-private:
-  const std::function<double(std::array<double, 3>)>& m_mapping;
-  std::vector<double> m_data;
-  std::size_t m_counter;
-
-public:
-  ScalarPointField(const std::function<double(std::array<double, 3>)>& mapping, std::size_t nPoints)
-    : m_mapping(mapping)
-    , m_data(nPoints)
-    , m_counter(0)
-  {
-  }
-
-  void forPoints(
-    const smtk::mesh::HandleRange& pointIds,
-    std::vector<double>& xyz,
-    bool& /*coordinatesModified*/) override
-  {
-    // The internal <m_counter> provides access to the the point field in
-    // sequence. The local <xyzCounter> provides access to the coordinates of
-    // the points currently being iterated. The iterator <i> provides access to
-    // the memory space of the points (we currently use it for iteration).
-    std::size_t xyzCounter = 0;
-    for (auto i = smtk::mesh::rangeElementsBegin(pointIds);
-         i != smtk::mesh::rangeElementsEnd(pointIds);
-         ++i, xyzCounter += 3)
-    {
-      m_data[m_counter++] = m_mapping(
-        std::array<double, 3>({ { xyz[xyzCounter], xyz[xyzCounter + 1], xyz[xyzCounter + 2] } }));
-    }
-  }
-
-  const std::vector<double>& data() const { return m_data; }
-};
-} // namespace
-
 bool applyScalarPointField(
   const std::function<double(std::array<double, 3>)>& f,
   const std::string& name,
   smtk::mesh::MeshSet& ms)
 {
-  ScalarPointField scalarPointField(f, ms.points().size());
-  smtk::mesh::for_each(ms.points(), scalarPointField);
-  return ms.createPointField(name, 1, smtk::mesh::FieldType::Double, &scalarPointField.data()[0])
-    .isValid();
+  return applyScalarPointField(batched(f), name, ms);
 }
 
-namespace
-{
-class ScalarCellField : public smtk::mesh::CellForEach
+bool applyScalarPointField(
+  const BatchMapping& f,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms,
+  unsigned int numberOfThreads)
 {
-private:
-  const std::function<double(std::array<double, 3>)>& m_mapping;
-  std::vector<double> m_data;
-  std::size_t m_counter;
-
-public:
-  ScalarCellField(const std::function<double(std::array<double, 3>)>& mapping, std::size_t nCells)
-    : smtk::mesh::CellForEach(true)
-    , m_mapping(mapping)
-    , m_data(nCells)
-    , m_counter(0)
-  {
-  }
-
-  void forCell(const smtk::mesh::Handle& /*cellId*/, smtk::mesh::CellType /*cellType*/, int nPts)
-    override
+  std::vector<double> values;
+  if (!mapPoints(f, ms, 1, values, numberOfThreads))
   {
-    double xyz[3] = { 0., 0., 0. };
-    for (int i = 0; i < 3 * nPts; i += 3)
-    {
-      xyz[0] += this->coordinates()[i];
-      xyz[1] += this->coordinates()[i + 1];
-      xyz[2] += this->coordinates()[i + 2];
-    }
-    for (int i = 0; i < 3; i++)
-    {
-      xyz[i] /= nPts;
-    }
-    m_data[m_counter++] = m_mapping(std::array<double, 3>({ { xyz[0], xyz[1], xyz[2] } }));
+    return false;
   }
-
-  const std::vector<double>& data() const { return m_data; }
-};
-} // namespace
+  return ms.createPointField(name, 1, smtk::mesh::FieldType::Double, values.data()).isValid();
+}
 
 bool applyScalarCellField(
   const std::function<double(std::array<double, 3>)>& f,
   const std::string& name,
   smtk::mesh::MeshSet& ms)
 {
-  ScalarCellField scalarCellField(f, ms.cells().size());
-  smtk::mesh::for_each(ms.cells(), scalarCellField);
-  return ms.createCellField(name, 1, smtk::mesh::FieldType::Double, &scalarCellField.data()[0])
-    .isValid();
+  return applyScalarCellField(batched(f), name, ms);
 }
 
-namespace
-{
-class VectorPointField : public smtk::mesh::PointForEach
+bool applyScalarCellField(
+  const BatchMapping& f,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms,
+  unsigned int numberOfThreads)
 {
-private:
-  const std::function<std::array<double, 3>(std::array<double, 3>)>& m_mapping;
-  std::vector<double> m_data;
-  std::size_t m_counter;
-
-public:
-  VectorPointField(
-    const std::function<std::array<double, 3>(std::array<double, 3>)>& mapping,
-    std::size_t nPoints)
-    : m_mapping(mapping)
-    , m_data(3 * nPoints)
-    , m_counter(0)
-  {
-  }
-
-  void forPoints(
-    const smtk::mesh::HandleRange& pointIds,
-    std::vector<double>& xyz,
-    bool& /*coordinatesModified*/) override
-  {
-    // The internal <m_counter> provides access to the the point field in
-    // sequence. The local <xyzCounter> provides access to the coordinates of
-    // the points currently being iterated. The iterator <i> provides access to
-    // the memory space of the points (we currently use it for iteration).
-    std::size_t xyzCounter = 0;
-    std::array<double, 3> x, f_x;
-    for (auto i = smtk::mesh::rangeElementsBegin(pointIds);
-         i != smtk::mesh::rangeElementsEnd(pointIds);
-         ++i, xyzCounter += 3)
-    {
-      std::copy(&xyz[xyzCounter], &xyz[xyzCounter] + 3, &x[0]);
-      f_x = m_mapping(x);
-      std::copy(std::begin(f_x), std::end(f_x), &m_data[m_counter]);
-      m_counter += 3;
-    }
-  }
-
-  const std::vector<double>& data() const { return m_data; }
-};
-} // namespace
+  std::vector<double> values;
+  mapCells(f, ms, 1, values, numberOfThreads);
+  return ms.createCellField(name, 1, smtk::mesh::FieldType::Double, values.data()).isValid();
+}
 
 bool applyVectorPointField(
   const std::function<std::array<double, 3>(std::array<double, 3>)>& f,
   const std::string& name,
   smtk::mesh::MeshSet& ms)
 {
-  VectorPointField vectorPointField(f, ms.points().size());
-  smtk::mesh::for_each(ms.points(), vectorPointField);
-  return ms.createPointField(name, 3, smtk::mesh::FieldType::Double, &vectorPointField.data()[0])
-    .isValid();
+  return applyVectorPointField(batched(f), name, ms);
 }
 
-namespace
-{
-class VectorCellField : public smtk::mesh::CellForEach
+bool applyVectorPointField(
+  const BatchMapping& f,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms,
+  unsigned int numberOfThreads)
 {
-private:
-  const std::function<std::array<double, 3>(std::array<double, 3>)>& m_mapping;
-  std::vector<double> m_data;
-  std::size_t m_counter;
-
-public:
-  VectorCellField(
-    const std::function<std::array<double, 3>(std::array<double, 3>)>& mapping,
-    std::size_t nCells)
-    : smtk::mesh::CellForEach(true)
-    , m_mapping(mapping)
-    , m_data(3 * nCells)
-    , m_counter(0)
+  std::vector<double> values;
+  if (!mapPoints(f, ms, 3, values, numberOfThreads))
   {
+    return false;
   }
-
-  void forCell(const smtk::mesh::Handle& /*cellId*/, smtk::mesh::CellType /*cellType*/, int nPts)
-    override
-  {
-    std::array<double, 3> x = { { 0., 0., 0. } }, f_x;
-    for (int i = 0; i < 3 * nPts; i += 3)
-    {
-      x[0] += this->coordinates()[i];
-      x[1] += this->coordinates()[i + 1];
-      x[2] += this->coordinates()[i + 2];
-    }
-    for (int i = 0; i < 3; i++)
-    {
-      x[i] /= nPts;
-    }
-    f_x = m_mapping(x);
-    std::copy(std::begin(f_x), std::end(f_x), &m_data[m_counter]);
-    m_counter += 3;
-  }
-
-  const std::vector<double>& data() const { return m_data; }
-};
-} // namespace
+  return ms.createPointField(name, 3, smtk::mesh::FieldType::Double, values.data()).isValid();
+}
 
 bool applyVectorCellField(
   const std::function<std::array<double, 3>(std::array<double, 3>)>& f,
   const std::string& name,
   smtk::mesh::MeshSet& ms)
 {
-  VectorCellField vectorCellField(f, ms.cells().size());
-  smtk::mesh::for_each(ms.cells(), vectorCellField);
-  return ms.createCellField(name, 3, smtk::mesh::FieldType::Double, &vectorCellField.data()[0])
-    .isValid();
+  return applyVectorCellField(batched(f), name, ms);
+}
+
+bool applyVectorCellField(
+  const BatchMapping& f,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms,
+  unsigned int numberOfThreads)
+{
+  std::vector<double> values;
+  mapCells(f, ms, 3, values, numberOfThreads);
+  return ms.createCellField(name, 3, smtk::mesh::FieldType::Double, values.data()).isValid();
 }
 } // namespace utility
 } // namespace mesh
@@ -16,6 +16,9 @@
 
 #include "smtk/mesh/core/MeshSet.h"
 
+#include <array>
+#include <cstddef>
+#include <functional>
 #include <string>
 
 namespace smtk
@@ -25,6 +28,15 @@ namespace mesh
 namespace utility
 {
 
+// A batched mapping is handed <n> points as packed xyz triples and writes <n>
+// results, packed with the dimension of the output (3 for warps and vector
+// fields, 1 for scalar fields), to <values>. The batched overloads below read
+// and write coordinates in large contiguous blocks and hand the mapping
+// disjoint blocks of points; if more than one thread is requested (0 requests
+// one per hardware thread), the mapping is called concurrently and must be
+// reentrant.
+typedef std::function<void(std::size_t n, const double* xyz, double* values)> BatchMapping;
+
 // deform each point in a meshset according to an R^3->R^3 mapping.
 SMTKCORE_EXPORT
 bool applyWarp(
@@ -32,6 +44,13 @@ bool applyWarp(
   smtk::mesh::MeshSet& ms,
   bool storePriorCoordinates = false);
 
+SMTKCORE_EXPORT
+bool applyWarp(
+  const BatchMapping&,
+  smtk::mesh::MeshSet& ms,
+  bool storePriorCoordinates = false,
+  unsigned int numberOfThreads = 1);
+
 // if prior coordinates were stored during applyWarp, undoWarp resets the
 // coordinates to their original values.
 SMTKCORE_EXPORT
@@ -45,6 +64,13 @@ bool applyScalarPointField(
   const std::string& name,
   smtk::mesh::MeshSet& ms);
 
+SMTKCORE_EXPORT
+bool applyScalarPointField(
+  const BatchMapping&,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms,
+  unsigned int numberOfThreads = 1);
+
 // construct a named scalar field defined at each cell centroid in a meshset
 // according to an R^3->R mapping.
 SMTKCORE_EXPORT
@@ -53,6 +79,13 @@ bool applyScalarCellField(
   const std::string& name,
   smtk::mesh::MeshSet& ms);
 
+SMTKCORE_EXPORT
+bool applyScalarCellField(
+  const BatchMapping&,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms,
+  unsigned int numberOfThreads = 1);
+
 // construct a named vector field defined at each point in a meshset according
 // to an R^3->R^3 mapping.
 SMTKCORE_EXPORT
@@ -61,6 +94,13 @@ bool applyVectorPointField(
   const std::string& name,
   smtk::mesh::MeshSet& ms);
 
+SMTKCORE_EXPORT
+bool applyVectorPointField(
+  const BatchMapping&,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms,
+  unsigned int numberOfThreads = 1);
+
 // construct a named vector field defined at each cell centroid in a meshset
 // according to an R^3->R^3 mapping.
 SMTKCORE_EXPORT
@@ -68,6 +108,13 @@ bool applyVectorCellField(
   const std::function<std::array<double, 3>(std::array<double, 3>)>&,
   const std::string& name,
   smtk::mesh::MeshSet& ms);
+
+SMTKCORE_EXPORT
+bool applyVectorCellField(
+  const BatchMapping&,
+  const std::string& name,
+  smtk::mesh::MeshSet& ms,
+  unsigned int numberOfThreads = 1);
 } // namespace utility
 } // namespace mesh
 } // namespace smtk
@@ -65,6 +65,8 @@ namespace smtk
 namespace model
 {
 
+constexpr Entity::Handle Entity::InvalidHandle;
+
 static const char* cellNamesByDimensionSingular[] = { "vertex", "edge",      "face",
                                                       "volume", "spacetime", "cell" };
 
@@ -138,6 +140,7 @@ EntityPtr Entity::setup(BitFlags entFlags, int dim, Resource::Ptr resource, bool
   {
     m_firstInvalid = -1;
     m_relations.clear();
+    m_relationHandles.clear();
   }
   return shared_from_this();
 }
@@ -275,12 +278,14 @@ int Entity::appendRelation(const UUID& b, bool useHoles)
   }
   idx = static_cast<int>(m_relations.size());
   m_relations.push_back(b);
+  this->resolveRelation(idx);
   return idx;
 }
 
 EntityPtr Entity::pushRelation(const UUID& b)
 {
   m_relations.push_back(b);
+  this->resolveRelation(m_relations.size() - 1);
   return shared_from_this();
 }
 
@@ -305,6 +310,10 @@ EntityPtr Entity::removeRelation(const UUID& b)
     if (arr[curr] == b)
     {
       arr.erase(arr.begin() + curr);
+      if (curr < m_relationHandles.size())
+      {
+        m_relationHandles.erase(m_relationHandles.begin() + curr);
+      }
       --curr;
       --size;
     }
@@ -320,6 +329,7 @@ EntityPtr Entity::removeRelation(const UUID& b)
 void Entity::resetRelations()
 {
   m_relations.clear();
+  m_relationHandles.clear();
   m_firstInvalid = -1;
 }
 
@@ -339,6 +349,7 @@ int Entity::findOrAppendRelation(const UUID& r)
   {
     m_relations[m_firstInvalid] = r;
     idx = m_firstInvalid;
+    this->resolveRelation(idx);
     UUIDArray::size_type i = m_firstInvalid;
     for (++i; i < m_relations.size(); ++i)
     {
@@ -357,6 +368,7 @@ int Entity::findOrAppendRelation(const UUID& r)
 
   idx = static_cast<int>(m_relations.size());
   m_relations.push_back(r);
+  this->resolveRelation(idx);
   return idx;
 }
 
@@ -387,6 +399,7 @@ int Entity::invalidateRelationByIndex(int relIdx)
     return -1;
 
   m_relations[relIdx] = smtk::common::UUID::null();
+  this->resolveRelation(relIdx);
   if (m_firstInvalid < 0 || (m_firstInvalid >= 0 && relIdx < m_firstInvalid))
     m_firstInvalid = relIdx;
   return relIdx;
@@ -1836,6 +1849,7 @@ int Entity::consumeInvalidIndex(const smtk::common::UUID& uid)
   if (result < 0)
     return result; // no hole to consume
   m_relations[result] = uid;
+  this->resolveRelation(result);
 
   // Now update m_firstInvalid:
   // I. Are we already at the end of the relations? If so, we're done.
@@ -1857,6 +1871,18 @@ int Entity::consumeInvalidIndex(const smtk::common::UUID& uid)
   return result;
 }
 
+/// Record the resource's handle for the relation at \a relIdx (if any).
+void Entity::resolveRelation(std::size_t relIdx)
+{
+  if (m_relationHandles.size() < m_relations.size())
+  {
+    m_relationHandles.resize(m_relations.size(), InvalidHandle);
+  }
+  ResourcePtr resource = m_resource.lock();
+  m_relationHandles[relIdx] =
+    resource ? resource->entityHandle(m_relations[relIdx]) : InvalidHandle;
+}
+
 /**\brief Return the attributes associated with the entity
 that are of type (or derived type) def.
   */
@@ -50,6 +50,9 @@ class SMTKCORE_EXPORT Entity : public smtk::resource::Component
 public:
   using UUID = smtk::common::UUID;
   using QueryFunctor = std::function<bool(const smtk::resource::Component&)>;
+  /// A compact index assigned to each entity by the model resource holding it.
+  using Handle = std::size_t;
+  static constexpr Handle InvalidHandle = static_cast<Handle>(-1);
   //using ResourcePtr = smtk::resource::ResourcePtr;
 
   smtkTypeMacro(smtk::model::Entity);
@@ -176,9 +179,14 @@ public:
 protected:
   Entity();
   int consumeInvalidIndex(const smtk::common::UUID& uid);
+  void resolveRelation(std::size_t relIdx);
 
   BitFlags m_entityFlags{ INVALID };
   smtk::common::UUIDArray m_relations;
+  // The resource's handle for each entry of m_relations, so the resource can
+  // follow relations without looking up their UUIDs. Entries are checked
+  // against m_relations before use, so stale entries are harmless.
+  std::vector<Handle> m_relationHandles;
   smtk::model::WeakResourcePtr m_resource;
   KindsToArrangements m_arrangements;
   int m_firstInvalid{ -1 };
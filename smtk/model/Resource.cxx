@@ -126,6 +126,7 @@ Resource::Resource(
 {
   this->queries().registerQueries<QueryList>();
   this->properties().insertPropertyType<smtk::common::UUID>();
+  this->reindexEntities();
 }
 
 /// Destroying a model resource requires us to release the default attribute resource..
@@ -210,6 +211,7 @@ smtk::mesh::ResourcePtr Resource::meshTessellations() const
 void Resource::clear()
 {
   m_topology->clear();
+  this->reindexEntities();
   m_tessellations->clear();
   m_analysisMesh->clear();
   {
@@ -353,6 +355,7 @@ SessionInfoBits Resource::erase(const UUID& uid, SessionInfoBits flags)
     //       of entities in the class destructor prevent us
     //       from obtaining a shared pointer to the resource
     //       to pass to any observers...
+    this->unindexEntity(uid);
     m_topology->erase(uid);
   }
 
@@ -398,6 +401,7 @@ SessionInfoBits Resource::hardErase(const EntityRef& eref, SessionInfoBits flags
   UUIDWithEntityPtr ent;
   if (actual & (SESSION_ENTITY_TYPE | SESSION_ENTITY_RELATIONS | SESSION_ARRANGEMENTS))
   {
+    this->unindexEntity(uid);
     if (!m_topology->erase(uid))
     { // without an Entity record, we cannot erase these things:
       actual &= ~(SESSION_ENTITY_TYPE | SESSION_ENTITY_RELATIONS | SESSION_ARRANGEMENTS);
@@ -515,7 +519,7 @@ UUID Resource::unusedUUID()
   do
   {
     actual = smtk::common::UUIDGenerator::instance().random();
-  } while (m_topology->find(actual) != m_topology->end());
+  } while (this->entityHandle(actual) != Entity::InvalidHandle);
   return actual;
 }
 
@@ -582,6 +586,7 @@ Resource::setEntityOfTypeAndDimension(const UUID& uid, BitFlags entityFlags, int
 
   if (result.second)
   {
+    this->indexEntity(entrec);
     this->trigger(
       std::make_pair(ADD_EVENT, ENTITY_ENTRY), EntityRef(this->shared_from_this(), uid));
   }
@@ -615,12 +620,14 @@ Resource::iter_type Resource::setEntity(EntityPtr c)
     }
     this->removeEntityReferences(it);
     it->second = c;
+    this->indexEntity(c);
     this->insertEntityReferences(it);
     return it;
   }
   std::pair<UUID, EntityPtr> entry(c->id(), c);
   this->prepareForEntity(entry);
   it = m_topology->insert(entry).first;
+  this->indexEntity(c);
   this->insertEntityReferences(it);
   return it;
 }
@@ -679,15 +686,15 @@ UUID Resource::addCellOfDimensionWithUUID(const UUID& uid, int dim)
 /// Return the type of entity that the link represents.
 BitFlags Resource::type(const UUID& ofEntity) const
 {
-  UUIDWithEntityPtr it = m_topology->find(ofEntity);
-  return (it == m_topology->end() ? INVALID : it->second->entityFlags());
+  EntityPtr entity = this->indexedEntity(ofEntity);
+  return (entity ? entity->entityFlags() : INVALID);
 }
 
 /// Return the dimension of the manifold that the passed entity represents.
 int Resource::dimension(const UUID& ofEntity) const
 {
-  UUIDWithEntityPtr it = m_topology->find(ofEntity);
-  return (it == m_topology->end() ? -1 : it->second->dimension());
+  EntityPtr entity = this->indexedEntity(ofEntity);
+  return (entity ? entity->dimension() : -1);
 }
 
 /**\brief Return a name for the given entity ID.
@@ -721,37 +728,35 @@ std::string Resource::name(const UUID& ofEntity) const
 UUIDs Resource::bordantEntities(const UUID& ofEntity, int ofDimension) const
 {
   UUIDs result;
-  UUIDWithConstEntityPtr it = m_topology->find(ofEntity);
-  if (it == m_topology->end())
+  EntityPtr entity = this->indexedEntity(ofEntity);
+  if (!entity)
   {
     return result;
   }
-  if (ofDimension >= 0 && it->second->dimension() >= ofDimension)
+  if (ofDimension >= 0 && entity->dimension() >= ofDimension)
   {
     // can't ask for "higher" dimensional boundaries that are lower than the dimension of this cell.
     return result;
   }
-  UUIDWithConstEntityPtr other;
-  for (UUIDArray::const_iterator ai = it->second->relations().begin();
-       ai != it->second->relations().end();
-       ++ai)
+  const UUIDArray& relations(entity->relations());
+  for (std::size_t ai = 0; ai < relations.size(); ++ai)
   {
-    other = m_topology->find(*ai);
-    if (other == m_topology->end())
+    EntityPtr other = this->relatedEntity(*entity, ai);
+    if (!other)
     { // TODO: silently skip bad relations or complain?
       continue;
     }
     if (
-      (ofDimension >= 0 && other->second->dimension() == ofDimension) ||
-      (ofDimension == -2 && other->second->dimension() >= it->second->dimension()))
+      (ofDimension >= 0 && other->dimension() == ofDimension) ||
+      (ofDimension == -2 && other->dimension() >= entity->dimension()))
     { // The dimension is higher, so dumbly push it into the result:
-      result.insert(*ai);
+      result.insert(relations[ai]);
     }
-    else if (
-      (it->second->entityFlags() & CELL_ENTITY) && (other->second->entityFlags() & USE_ENTITY))
+    else if ((entity->entityFlags() & CELL_ENTITY) && (other->entityFlags() & USE_ENTITY))
     { // ... or it is a use: follow the use upwards.
-      ShellEntities bshells = UseEntity(smtk::const_pointer_cast<Resource>(shared_from_this()), *ai)
-                                .boundingShellEntities<ShellEntities>();
+      ShellEntities bshells =
+        UseEntity(smtk::const_pointer_cast<Resource>(shared_from_this()), relations[ai])
+          .boundingShellEntities<ShellEntities>();
       for (ShellEntities::iterator shellIt = bshells.begin(); shellIt != bshells.end(); ++shellIt)
       {
         CellEntity cell = shellIt->boundingCell();
@@ -788,38 +793,35 @@ UUIDs Resource::bordantEntities(const UUIDs& ofEntities, int ofDimension) const
 UUIDs Resource::boundaryEntities(const UUID& ofEntity, int ofDimension) const
 {
   UUIDs result;
-  UUIDWithConstEntityPtr it = m_topology->find(ofEntity);
-  if (it == m_topology->end())
+  EntityPtr entity = this->indexedEntity(ofEntity);
+  if (!entity)
   {
     return result;
   }
-  if (ofDimension >= 0 && it->second->dimension() <= ofDimension)
+  if (ofDimension >= 0 && entity->dimension() <= ofDimension)
   {
     // can't ask for "lower" dimensional boundaries that are higher than the dimension of this cell.
     return result;
   }
-  UUIDWithEntityPtr other;
-  for (UUIDArray::const_iterator ai = it->second->relations().begin();
-       ai != it->second->relations().end();
-       ++ai)
+  const UUIDArray& relations(entity->relations());
+  for (std::size_t ai = 0; ai < relations.size(); ++ai)
   {
-    other = m_topology->find(*ai);
-    if (other == m_topology->end())
+    EntityPtr other = this->relatedEntity(*entity, ai);
+    if (!other)
     { // TODO: silently skip bad relations or complain?
       continue;
     }
     if (
-      (ofDimension >= 0 && other->second->dimension() == ofDimension) ||
-      (ofDimension == -2 && other->second->dimension() <= it->second->dimension() &&
-       !other->second->isModel()))
+      (ofDimension >= 0 && other->dimension() == ofDimension) ||
+      (ofDimension == -2 && other->dimension() <= entity->dimension() && !other->isModel()))
     {
-      result.insert(*ai);
+      result.insert(relations[ai]);
     }
-    else if (
-      (it->second->entityFlags() & CELL_ENTITY) && (other->second->entityFlags() & USE_ENTITY))
+    else if ((entity->entityFlags() & CELL_ENTITY) && (other->entityFlags() & USE_ENTITY))
     { // ... or it is a use: follow the use downwards.
-      ShellEntities shells = UseEntity(smtk::const_pointer_cast<Resource>(shared_from_this()), *ai)
-                               .shellEntities<ShellEntities>();
+      ShellEntities shells =
+        UseEntity(smtk::const_pointer_cast<Resource>(shared_from_this()), relations[ai])
+          .shellEntities<ShellEntities>();
       for (ShellEntities::iterator shellIt = shells.begin(); shellIt != shells.end(); ++shellIt)
       {
         CellEntities cells = shellIt->cellsOfUses<CellEntities>();
@@ -1009,8 +1011,8 @@ UUIDs Resource::entitiesOfDimension(int dim)
   */
 EntityPtr Resource::findEntity(const UUID& uid, bool trySessions) const
 {
-  UUIDWithEntityPtr it = m_topology->find(uid);
-  if (it == m_topology->end())
+  EntityPtr entity = this->indexedEntity(uid);
+  if (!entity)
   {
     // Not in storage... is it in any session's dangling entity list?
     // We use an evil const-cast here because we are working under the fiction
@@ -1024,15 +1026,141 @@ EntityPtr Resource::findEntity(const UUID& uid, bool trySessions) const
       {
         if (bit->second->transcribe(EntityRef(self, uid), SESSION_ENTITY_ARRANGED, true))
         {
-          it = m_topology->find(uid);
-          if (it != m_topology->end())
-            return it->second;
+          entity = this->indexedEntity(uid);
+          if (entity)
+            return entity;
         }
       }
     }
     return nullptr;
   }
-  return it->second;
+  return entity;
+}
+
+/**\brief Return the entity at index \a relIdx of \a entity's relations.
+  *
+  * This follows the handle recorded for the relation when it was set,
+  * so it does not search for the related entity's UUID unless the handle
+  * is missing or stale. A null pointer is returned for invalid relations.
+  */
+EntityPtr Resource::relatedEntity(const Entity& entity, std::size_t relIdx) const
+{
+  const UUID& uid = entity.m_relations[relIdx];
+  if (!uid)
+  {
+    return nullptr;
+  }
+  if (relIdx < entity.m_relationHandles.size())
+  {
+    Entity::Handle handle = entity.m_relationHandles[relIdx];
+    if (handle < m_handleEntities.size())
+    {
+      const EntityPtr& related = m_handleEntities[handle];
+      if (related && related->id() == uid)
+      {
+        return related;
+      }
+    }
+  }
+  return this->indexedEntity(uid);
+}
+
+/**\brief Record the handle of every entity's relations.
+  *
+  * Relations are resolved as they are added through Entity's methods, but
+  * not when an entity's relations() are assigned directly (as they are when
+  * a resource is read) or when they refer to an entity that was inserted
+  * later. Call this after such bulk changes so relatedEntity() (and so
+  * topological traversals) can follow handles rather than UUIDs.
+  */
+void Resource::resolveRelations()
+{
+  for (const auto& entity : m_handleEntities)
+  {
+    if (!entity)
+    {
+      continue;
+    }
+    entity->m_relationHandles.resize(entity->m_relations.size());
+    for (std::size_t ii = 0; ii < entity->m_relations.size(); ++ii)
+    {
+      entity->m_relationHandles[ii] = this->entityHandle(entity->m_relations[ii]);
+    }
+  }
+}
+
+/// Return the handle of the entity with the given \a uid (or Entity::InvalidHandle).
+Entity::Handle Resource::entityHandle(const UUID& uid) const
+{
+  auto it = m_entityHandles.find(uid);
+  return it == m_entityHandles.end() ? Entity::InvalidHandle : it->second;
+}
+
+/// Return the entity with the given \a uid without consulting sessions.
+EntityPtr Resource::indexedEntity(const UUID& uid) const
+{
+  auto it = m_entityHandles.find(uid);
+  return it == m_entityHandles.end() ? EntityPtr() : m_handleEntities[it->second];
+}
+
+/// Assign a handle to \a entity (or replace the entity at its UUID's handle).
+void Resource::indexEntity(const EntityPtr& entity)
+{
+  auto it = m_entityHandles.find(entity->id());
+  if (it != m_entityHandles.end())
+  {
+    m_handleEntities[it->second] = entity;
+  }
+  else
+  {
+    Entity::Handle handle;
+    if (m_freeHandles.empty())
+    {
+      handle = m_handleEntities.size();
+      m_handleEntities.push_back(entity);
+    }
+    else
+    {
+      handle = m_freeHandles.back();
+      m_freeHandles.pop_back();
+      m_handleEntities[handle] = entity;
+    }
+    m_entityHandles[entity->id()] = handle;
+  }
+
+  entity->m_relationHandles.resize(entity->m_relations.size());
+  for (std::size_t ii = 0; ii < entity->m_relations.size(); ++ii)
+  {
+    entity->m_relationHandles[ii] = this->entityHandle(entity->m_relations[ii]);
+  }
+}
+
+/// Release the handle of the entity with the given \a uid for reuse.
+void Resource::unindexEntity(const UUID& uid)
+{
+  auto it = m_entityHandles.find(uid);
+  if (it == m_entityHandles.end())
+  {
+    return;
+  }
+  m_handleEntities[it->second] = nullptr;
+  m_freeHandles.push_back(it->second);
+  m_entityHandles.erase(it);
+}
+
+/// Rebuild the handle index from the entities in storage.
+void Resource::reindexEntities()
+{
+  m_handleEntities.clear();
+  m_entityHandles.clear();
+  m_freeHandles.clear();
+  m_handleEntities.reserve(m_topology->size());
+  for (const auto& entry : *m_topology)
+  {
+    m_entityHandles[entry.first] = m_handleEntities.size();
+    m_handleEntities.push_back(entry.second);
+  }
+  this->resolveRelations();
 }
 
 smtk::resource::ComponentPtr Resource::find(const smtk::common::UUID& uid) const
@@ -1709,6 +1837,7 @@ bool Resource::unregisterSession(SessionPtr session, bool expungeSession)
 
     // Remove the session's entity record, properties, and such, but not
     // records, properties, etc. for entities the session owns.
+    this->unindexEntity(sessId);
     m_topology->erase(sessId);
     this->properties().data().eraseIdForType<FloatProperty>(sessId);
     this->properties().data().eraseIdForType<StringProperty>(sessId);
@@ -2113,6 +2242,7 @@ int Resource::unarrangeEntity(const UUID& entityId, ArrangementKind k, int index
   // and if the caller has requested it: remove the entity itself.
   if (removeIfLast && eit->second->arrangementMap().empty())
   {
+    this->unindexEntity(entityId);
     m_topology->erase(eit);
     ++result;
   }
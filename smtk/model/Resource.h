@@ -41,6 +41,7 @@
 #include <algorithm>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <sstream>
@@ -151,6 +152,8 @@ public:
   std::string name(const smtk::common::UUID& ofEntity) const;
 
   EntityPtr findEntity(const smtk::common::UUID& uid, bool trySessions = true) const;
+  EntityPtr relatedEntity(const Entity& entity, std::size_t relIdx) const;
+  void resolveRelations();
 
   smtk::resource::ComponentPtr find(const smtk::common::UUID& uid) const override;
   std::function<bool(const smtk::resource::Component&)> queryOperation(
@@ -555,6 +558,13 @@ public:
 
 protected:
   friend class smtk::attribute::Resource;
+  friend class Entity;
+
+  Entity::Handle entityHandle(const smtk::common::UUID& uid) const;
+  EntityPtr indexedEntity(const smtk::common::UUID& uid) const;
+  void indexEntity(const EntityPtr& entity);
+  void unindexEntity(const smtk::common::UUID& uid);
+  void reindexEntities();
 
   void assignDefaultNamesWithOwner(
     const UUIDWithEntityPtr& irec,
@@ -579,6 +589,16 @@ protected:
   smtk::shared_ptr<UUIDsToTessellations> m_analysisMesh;
   smtk::shared_ptr<UUIDsToAttributeAssignments> m_attributeAssignments;
   smtk::shared_ptr<UUIDsToSessions> m_sessions;
+
+  // A dense index of the entities in m_topology. Each entity is assigned a
+  // compact handle into m_handleEntities when it is inserted so that lookups
+  // by UUID are hashed and relations can be followed by handle (see
+  // relatedEntity()) rather than by searching m_topology. Entities must be
+  // inserted and erased through this class (not topology()) to be indexed.
+  std::vector<EntityPtr> m_handleEntities;
+  std::unordered_map<smtk::common::UUID, Entity::Handle> m_entityHandles;
+  std::vector<Entity::Handle> m_freeHandles;
+
   typedef std::owner_less<smtk::attribute::WeakResourcePtr> ResourceLessThan;
   typedef std::set<smtk::attribute::WeakResourcePtr, ResourceLessThan> WeakResourceSet;
   WeakResourceSet m_attributeResources; // weak references to attribute resources
@@ -0,0 +1,300 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/TessellationArchive.h"
+
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+const char s_magic[8] = { 'S', 'M', 'T', 'K', 'T', 'E', 'S', 'S' };
+const std::uint32_t s_version = 1;
+const std::uint32_t s_byteOrder = 0x01020304;
+const std::uint64_t s_headerSize = sizeof(s_magic) + sizeof(s_version) + sizeof(s_byteOrder);
+const std::uint64_t s_alignment = 8;
+
+thread_local smtk::model::TessellationArchive* g_activeArchive = nullptr;
+
+// Return true if the (offset, count) pair in \a jarray describes
+// count items of \a itemSize bytes that lie inside a mapping of \a size bytes.
+bool validRange(
+  const nlohmann::json& jarray,
+  std::uint64_t itemSize,
+  std::uint64_t size,
+  std::uint64_t& offset,
+  std::uint64_t& count)
+{
+  if (!jarray.is_array() || jarray.size() != 2)
+  {
+    return false;
+  }
+  offset = jarray[0].get<std::uint64_t>();
+  count = jarray[1].get<std::uint64_t>();
+  return offset >= s_headerSize && offset <= size && count <= (size - offset) / itemSize;
+}
+} // namespace
+
+namespace smtk
+{
+namespace model
+{
+
+/// A read-only view of an archive file, memory-mapped when possible.
+struct TessellationArchive::Mapping
+{
+  ~Mapping()
+  {
+#if defined(_WIN32) && !defined(__CYGWIN__)
+    if (m_data)
+    {
+      UnmapViewOfFile(m_data);
+    }
+    if (m_mapping)
+    {
+      CloseHandle(m_mapping);
+    }
+    if (m_file != INVALID_HANDLE_VALUE)
+    {
+      CloseHandle(m_file);
+    }
+#else
+    if (m_data)
+    {
+      munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+  }
+
+  bool map(const std::string& filename)
+  {
+#if defined(_WIN32) && !defined(__CYGWIN__)
+    m_file = CreateFileA(
+      filename.c_str(),
+      GENERIC_READ,
+      FILE_SHARE_READ,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr);
+    LARGE_INTEGER size;
+    if (m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+    {
+      return false;
+    }
+    m_size = static_cast<std::uint64_t>(size.QuadPart);
+    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m_mapping)
+    {
+      return false;
+    }
+    m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0)
+    {
+      ::close(fd);
+      return false;
+    }
+    m_size = static_cast<std::uint64_t>(info.st_size);
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping holds its own reference to the file.
+    ::close(fd);
+    m_data = data == MAP_FAILED ? nullptr : static_cast<const char*>(data);
+#endif
+    return m_data != nullptr;
+  }
+
+  const char* m_data = nullptr;
+  std::uint64_t m_size = 0;
+#if defined(_WIN32) && !defined(__CYGWIN__)
+  HANDLE m_file = INVALID_HANDLE_VALUE;
+  HANDLE m_mapping = nullptr;
+#endif
+};
+
+TessellationArchive::Scope::Scope(TessellationArchive& archive)
+  : m_previous(g_activeArchive)
+{
+  g_activeArchive = &archive;
+}
+
+TessellationArchive::Scope::~Scope()
+{
+  g_activeArchive = m_previous;
+}
+
+TessellationArchive::TessellationArchive() = default;
+
+TessellationArchive::~TessellationArchive()
+{
+  this->close();
+}
+
+TessellationArchive* TessellationArchive::active()
+{
+  return g_activeArchive;
+}
+
+bool TessellationArchive::create(const std::string& filename)
+{
+  this->close();
+  m_output.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!m_output.is_open())
+  {
+    return false;
+  }
+  m_filename = filename;
+  m_offset = 0;
+  m_good = true;
+  this->write(s_magic, sizeof(s_magic));
+  this->write(&s_version, sizeof(s_version));
+  this->write(&s_byteOrder, sizeof(s_byteOrder));
+  return m_good;
+}
+
+bool TessellationArchive::open(const std::string& filename)
+{
+  this->close();
+  std::unique_ptr<Mapping> mapping(new Mapping);
+  if (!mapping->map(filename) || mapping->m_size < s_headerSize)
+  {
+    return false;
+  }
+  std::uint32_t version;
+  std::uint32_t byteOrder;
+  std::memcpy(&version, mapping->m_data + sizeof(s_magic), sizeof(version));
+  std::memcpy(&byteOrder, mapping->m_data + sizeof(s_magic) + sizeof(version), sizeof(byteOrder));
+  if (
+    std::memcmp(mapping->m_data, s_magic, sizeof(s_magic)) != 0 || version != s_version ||
+    byteOrder != s_byteOrder)
+  {
+    return false;
+  }
+  m_filename = filename;
+  m_mapping = std::move(mapping);
+  return true;
+}
+
+bool TessellationArchive::close()
+{
+  bool ok = true;
+  if (m_output.is_open())
+  {
+    m_output.close();
+    ok = m_good && !m_output.fail();
+  }
+  m_mapping.reset();
+  m_filename.clear();
+  m_offset = 0;
+  m_good = true;
+  return ok;
+}
+
+bool TessellationArchive::isReadable() const
+{
+  return m_mapping != nullptr;
+}
+
+TessellationArchive::json TessellationArchive::append(const Tessellation& tess)
+{
+  if (!this->isWritable())
+  {
+    return json();
+  }
+  std::uint64_t coords = this->write(tess.coords().data(), tess.coords().size() * sizeof(double));
+  std::uint64_t conn = this->write(tess.conn().data(), tess.conn().size() * sizeof(int));
+  return { { "metadata", { "format version", "4" } },
+           { "archive",
+             { { "vertices", { coords, tess.coords().size() } },
+               { "faces", { conn, tess.conn().size() } } } } };
+}
+
+bool TessellationArchive::isReference(const json& j)
+{
+  return j.is_object() && j.find("archive") != j.end();
+}
+
+bool TessellationArchive::read(const json& j, Tessellation& tess) const
+{
+  tess.reset();
+  if (!m_mapping || !TessellationArchive::isReference(j))
+  {
+    return false;
+  }
+  const json& jarchive = j.at("archive");
+  std::uint64_t coordsOffset;
+  std::uint64_t coordsCount;
+  std::uint64_t connOffset;
+  std::uint64_t connCount;
+  try
+  {
+    if (
+      !validRange(
+        jarchive.at("vertices"), sizeof(double), m_mapping->m_size, coordsOffset, coordsCount) ||
+      !validRange(jarchive.at("faces"), sizeof(int), m_mapping->m_size, connOffset, connCount))
+    {
+      return false;
+    }
+  }
+  catch (std::exception&)
+  {
+    return false;
+  }
+  tess.coords().resize(coordsCount);
+  if (coordsCount > 0)
+  {
+    std::memcpy(
+      tess.coords().data(), m_mapping->m_data + coordsOffset, coordsCount * sizeof(double));
+  }
+  tess.conn().resize(connCount);
+  if (connCount > 0)
+  {
+    std::memcpy(tess.conn().data(), m_mapping->m_data + connOffset, connCount * sizeof(int));
+  }
+  return true;
+}
+
+std::uint64_t TessellationArchive::write(const void* data, std::uint64_t size)
+{
+  // Pad so that every array begins on an aligned boundary in the mapped file.
+  static const char padding[s_alignment] = { 0 };
+  std::uint64_t pad = (s_alignment - m_offset % s_alignment) % s_alignment;
+  if (m_offset >= s_headerSize && pad > 0)
+  {
+    m_output.write(padding, static_cast<std::streamsize>(pad));
+    m_offset += pad;
+  }
+  std::uint64_t offset = m_offset;
+  if (size > 0)
+  {
+    m_output.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    m_offset += size;
+  }
+  m_good = m_good && m_output.good();
+  return offset;
+}
+
+} // namespace model
+} // namespace smtk
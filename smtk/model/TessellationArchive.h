@@ -0,0 +1,130 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_model_TessellationArchive_h
+#define smtk_model_TessellationArchive_h
+
+#include "smtk/CoreExports.h"
+#include "smtk/common/CompilerInformation.h"
+
+#include "smtk/model/Tessellation.h"
+
+SMTK_THIRDPARTY_PRE_INCLUDE
+#include "nlohmann/json.hpp"
+SMTK_THIRDPARTY_POST_INCLUDE
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace smtk
+{
+namespace model
+{
+
+/**\brief A binary sidecar file holding tessellation coordinates and connectivity.
+  *
+  * Serializing large tessellations as JSON number arrays is slow to write,
+  * slower to parse, and produces very large files. When an archive is
+  * active on the current thread (see TessellationArchive::Scope), the JSON
+  * serializers for Tessellation append raw coordinates and connectivity to
+  * the archive and emit only a small reference (byte offsets and counts)
+  * into the JSON. When deserializing, references are resolved against the
+  * active archive, which memory-maps its file so that only the portions of
+  * the file that are actually read are paged in.
+  *
+  * JSON that holds tessellations inline is still read whether or not an
+  * archive is active. Failures to resolve a reference are reported to
+  * smtk::io::Logger::instance().
+  *
+  * Only tessellations that are serialized to JSON are archived. Analysis
+  * meshes (Resource::analysisMesh()) are not serialized by any model
+  * reader or writer, so they are not covered.
+  *
+  * The file begins with an 8-byte magic string, a 32-bit format version,
+  * and a 32-bit byte-order marker; arrays follow, each aligned to 8 bytes.
+  * Archives are not portable between machines with different byte order.
+  */
+class SMTKCORE_EXPORT TessellationArchive
+{
+public:
+  using json = nlohmann::json;
+
+  /// Make an archive the active archive on this thread for the lifetime of the scope.
+  class SMTKCORE_EXPORT Scope
+  {
+  public:
+    Scope(TessellationArchive& archive);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    TessellationArchive* m_previous;
+  };
+
+  TessellationArchive();
+  ~TessellationArchive();
+
+  TessellationArchive(const TessellationArchive&) = delete;
+  TessellationArchive& operator=(const TessellationArchive&) = delete;
+
+  /// Return the archive active on the current thread (or null).
+  static TessellationArchive* active();
+
+  /// Create (or truncate) \a filename and prepare to append tessellations to it.
+  bool create(const std::string& filename);
+
+  /// Map an existing archive at \a filename into memory for reading.
+  bool open(const std::string& filename);
+
+  /// Finish writing (or unmap) the archive.
+  ///
+  /// This returns false if any data failed to be written.
+  bool close();
+
+  /// Return true if the archive was created and is accepting tessellations.
+  bool isWritable() const { return m_output.is_open(); }
+
+  /// Return true if the archive is open for reading.
+  bool isReadable() const;
+
+  /// Return the name of the archive's file.
+  const std::string& filename() const { return m_filename; }
+
+  /// Append \a tess to the archive and return a JSON reference to it.
+  json append(const Tessellation& tess);
+
+  /// Return true if \a j is a reference to archived tessellation data.
+  static bool isReference(const json& j);
+
+  /// Populate \a tess from the archived data referenced by \a j.
+  ///
+  /// If the reference is invalid or out of bounds, \a tess is reset
+  /// and false is returned.
+  bool read(const json& j, Tessellation& tess) const;
+
+private:
+  std::uint64_t write(const void* data, std::uint64_t size);
+
+  struct Mapping;
+
+  std::string m_filename;
+  std::ofstream m_output;
+  std::uint64_t m_offset = 0;
+  bool m_good = true;
+  std::unique_ptr<Mapping> m_mapping;
+};
+
+} // namespace model
+} // namespace smtk
+
+#endif // smtk_model_TessellationArchive_h
@@ -226,6 +226,9 @@ void from_json(const json& j, ResourcePtr& mresource)
       }
     }
   }
+
+  // Relations were assigned wholesale above; record their handles.
+  mresource->resolveRelations();
 }
 } // namespace model
 } // namespace smtk
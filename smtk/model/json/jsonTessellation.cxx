@@ -10,10 +10,12 @@
 #include "smtk/model/json/jsonTessellation.h"
 
 #include "smtk/model/Tessellation.h"
+#include "smtk/model/TessellationArchive.h"
+
+#include "smtk/io/Logger.h"
 
 #include "nlohmann/json.hpp"
 
-#include <iostream>
 #include <string>
 
 #include <exception>
@@ -29,10 +31,15 @@ using UUID = smtk::common::UUID;
 
 void to_json(json& j, const Tessellation& tess)
 {
+  TessellationArchive* archive;
   if (tess.coords().empty() && tess.conn().empty())
   {
     j = nullptr;
   }
+  else if ((archive = TessellationArchive::active()) && archive->isWritable())
+  {
+    j = archive->append(tess);
+  }
   else
   {
     j = { { "metadata", { "format version", "3" } },
@@ -44,7 +51,22 @@ void to_json(json& j, const Tessellation& tess)
 void from_json(const json& j, Tessellation& tess)
 {
   tess.reset();
-  if (!j.is_null())
+  if (TessellationArchive::isReference(j))
+  {
+    TessellationArchive* archive = TessellationArchive::active();
+    if (!archive)
+    {
+      smtkErrorMacro(
+        smtk::io::Logger::instance(), "No archive is active to read archived Tessellation.");
+    }
+    else if (!archive->read(j, tess))
+    {
+      smtkErrorMacro(
+        smtk::io::Logger::instance(),
+        "Failed to read archived Tessellation from \"" << archive->filename() << "\".");
+    }
+  }
+  else if (!j.is_null())
   {
     try
     {
@@ -53,7 +75,7 @@ void from_json(const json& j, Tessellation& tess)
     }
     catch (std::exception&)
     {
-      std::cerr << "Failed to deserialize Tessellation" << std::endl;
+      smtkErrorMacro(smtk::io::Logger::instance(), "Failed to deserialize Tessellation.");
       tess.reset();
     }
   }
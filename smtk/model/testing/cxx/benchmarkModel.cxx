@@ -7,6 +7,7 @@
 //  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
 //  PURPOSE.  See the above copyright notice for more information.
 //=========================================================================
+#include "smtk/model/EntityRef.h"
 #include "smtk/model/Resource.h"
 #include "smtk/model/json/jsonResource.h"
 #include "smtk/model/testing/cxx/helpers.h"
@@ -19,6 +20,34 @@ using namespace smtk::model;
 using namespace smtk::model::testing;
 using namespace smtk::io;
 
+namespace
+{
+// Walk the topology the way import and tessellation passes do: from each
+// volume down to its vertices and from each vertex back up to its volumes.
+// Returns the number of entities visited.
+std::size_t traverse(const ResourcePtr& sm)
+{
+  std::size_t visited = 0;
+  EntityRefs volumes = sm->entitiesMatchingFlagsAs<EntityRefs>(VOLUME, true);
+  for (auto volume : volumes)
+  {
+    for (const auto& face : volume.boundaryEntities(2))
+    {
+      for (const auto& edge : face.boundaryEntities(1))
+      {
+        visited += edge.boundaryEntities(0).size();
+      }
+    }
+  }
+  EntityRefs vertices = sm->entitiesMatchingFlagsAs<EntityRefs>(VERTEX, true);
+  for (auto vertex : vertices)
+  {
+    visited += vertex.higherDimensionalBordants(3).size();
+  }
+  return visited;
+}
+} // namespace
+
 int main(int argc, char* argv[])
 {
   (void)argc;
@@ -78,6 +107,13 @@ int main(int argc, char* argv[])
   std::cout << numHits << " missed lookups " << deltaT << " seconds " << (numHits / deltaT)
             << " good lookups/sec.\n";
 
+  // ### Benchmark topological traversal ###
+  t.mark();
+  std::size_t numVisited = traverse(sm);
+  deltaT = t.elapsed();
+  std::cout << numVisited << " entities visited by traversal " << deltaT << " seconds "
+            << (numVisited / deltaT) << " hops/sec\n";
+
   // ### Benchmark JSON export ###
   t.mark();
   nlohmann::json json = sm;
@@ -92,8 +128,15 @@ int main(int argc, char* argv[])
     t.mark();
     smtk::model::from_json(json, sm2);
     deltaT = t.elapsed();
+    std::cout << deltaT << " seconds to ingest JSON.\n";
+
+    // Relations of an imported resource are resolved to handles in bulk.
+    t.mark();
+    std::size_t numImportVisited = traverse(sm2);
+    deltaT = t.elapsed();
+    std::cout << numImportVisited << " entities visited by traversal after import " << deltaT
+              << " seconds " << (numImportVisited / deltaT) << " hops/sec\n";
   }
-  std::cout << deltaT << " seconds to ingest JSON.\n";
 
   return 0;
 }
@@ -0,0 +1,130 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/Tessellation.h"
+#include "smtk/model/TessellationArchive.h"
+#include "smtk/model/json/jsonTessellation.h"
+#include "smtk/model/testing/cxx/helpers.h"
+
+#include "smtk/common/Paths.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace smtk::model;
+using namespace smtk::model::testing;
+
+// Compare writing and reading tessellations as inline JSON with writing them
+// to (and memory-mapping them from) a TessellationArchive. The number of
+// tessellations and triangles per tessellation may be passed as arguments.
+
+namespace
+{
+std::size_t fileSize(const std::string& filename)
+{
+  std::ifstream file(filename, std::ios::binary | std::ios::ate);
+  return file.good() ? static_cast<std::size_t>(file.tellg()) : 0;
+}
+
+bool sameAs(const std::vector<Tessellation>& aa, const std::vector<Tessellation>& bb)
+{
+  if (aa.size() != bb.size())
+  {
+    return false;
+  }
+  for (std::size_t ii = 0; ii < aa.size(); ++ii)
+  {
+    if (aa[ii].coords() != bb[ii].coords() || aa[ii].conn() != bb[ii].conn())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  int numTess = argc > 1 ? std::atoi(argv[1]) : 100;
+  int numTri = argc > 2 ? std::atoi(argv[2]) : 10000;
+  std::string base = smtk::common::Paths::tempDirectory() + "/" + smtk::common::Paths::uniquePath();
+  std::string jsonName = base + ".json";
+  std::string archiveName = base + ".tess";
+
+  std::vector<Tessellation> original(numTess);
+  for (int tt = 0; tt < numTess; ++tt)
+  {
+    for (int ii = 0; ii < numTri + 2; ++ii)
+    {
+      original[tt].addCoords(0.1 * ii, 0.5 * (ii % 2), 0.01 * tt);
+    }
+    for (int ii = 0; ii < numTri; ++ii)
+    {
+      original[tt].addTriangle(ii, ii + 1, ii + 2);
+    }
+  }
+  std::cout << numTess << " tessellations of " << numTri << " triangles\n";
+
+  Timer timer;
+  double deltaT;
+  bool ok = true;
+  for (int useArchive = 0; useArchive < 2; ++useArchive)
+  {
+    const char* label = useArchive ? "archive" : "inline ";
+
+    // #### Write
+    timer.mark();
+    {
+      TessellationArchive archive;
+      if (useArchive)
+      {
+        archive.create(archiveName);
+      }
+      TessellationArchive::Scope scope(archive);
+      json j = original;
+      std::ofstream file(jsonName);
+      file << j.dump(2);
+      archive.close();
+    }
+    deltaT = timer.elapsed();
+    std::size_t bytes = fileSize(jsonName) + (useArchive ? fileSize(archiveName) : 0);
+    std::cout << label << " write " << deltaT << " seconds " << bytes << " bytes\n";
+
+    // #### Read
+    timer.mark();
+    std::vector<Tessellation> loaded;
+    {
+      TessellationArchive archive;
+      if (useArchive)
+      {
+        archive.open(archiveName);
+      }
+      TessellationArchive::Scope scope(archive);
+      std::ifstream file(jsonName);
+      json j = json::parse(file);
+      loaded = j.get<std::vector<Tessellation>>();
+    }
+    deltaT = timer.elapsed();
+    std::cout << label << " read  " << deltaT << " seconds\n";
+    ok &= sameAs(original, loaded);
+  }
+
+  std::remove(jsonName.c_str());
+  std::remove(archiveName.c_str());
+  if (!ok)
+  {
+    std::cerr << "Tessellations did not round-trip.\n";
+    return 1;
+  }
+  return 0;
+}
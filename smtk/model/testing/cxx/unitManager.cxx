@@ -215,6 +215,17 @@ int main(int argc, char* argv[])
     "unarrangeEntity(..., true) failed to remove the entity afterwards.");
   test(sm->erase(uids[0]), "Failed to erase a vertex.");
 
+  // Relations are followed by handle; erasing an entity (and reusing its
+  // handle for a new one) must not leave relations resolving to the wrong entity.
+  EntityPtr edge = sm->findEntity(uids[7]);
+  test(!sm->relatedEntity(*edge, 0), "Relation to an erased vertex should not resolve.");
+  test(
+    sm->relatedEntity(*edge, 1) == sm->findEntity(uids[1]),
+    "Relation to an existing vertex should resolve to it.");
+  UUID replacement = sm->insertCellOfDimension(0)->first;
+  test(!sm->relatedEntity(*edge, 0), "Relation resolved to an entity that reused a handle.");
+  test(sm->findEntity(replacement) != nullptr, "Failed to find a newly inserted vertex.");
+
   std::cout << entCount << " total entities:\n";
   std::cout << "subgroups " << subgroups << "\n";
   std::cout << "submodels " << submodels << "\n";
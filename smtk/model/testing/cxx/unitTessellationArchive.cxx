@@ -0,0 +1,121 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/model/Tessellation.h"
+#include "smtk/model/TessellationArchive.h"
+#include "smtk/model/json/jsonTessellation.h"
+
+#include "smtk/common/Paths.h"
+
+#include "smtk/io/Logger.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include <cstdio>
+#include <vector>
+
+using namespace smtk::model;
+
+namespace
+{
+Tessellation makeStrip(int numberOfTriangles, double offset)
+{
+  Tessellation tess;
+  for (int ii = 0; ii < numberOfTriangles + 2; ++ii)
+  {
+    tess.addCoords(offset + ii, ii % 2, 0.0);
+  }
+  for (int ii = 0; ii < numberOfTriangles; ++ii)
+  {
+    tess.addTriangle(ii, ii + 1, ii + 2);
+  }
+  return tess;
+}
+} // namespace
+
+int main()
+{
+  std::string filename =
+    smtk::common::Paths::tempDirectory() + "/" + smtk::common::Paths::uniquePath() + ".tess";
+
+  std::vector<Tessellation> original;
+  original.push_back(makeStrip(1, 0.0));
+  original.push_back(makeStrip(100, 10.0));
+  original.push_back(Tessellation());
+  original.back().addCoords(1.0, 2.0, 3.0); // Coordinates but no connectivity.
+  original.push_back(makeStrip(7, 20.0));
+
+  // Write tessellations to an archive; the JSON holds only references.
+  json jtess = json::array();
+  {
+    TessellationArchive archive;
+    test(archive.create(filename), "Could not create archive.");
+    TessellationArchive::Scope scope(archive);
+    for (const auto& tess : original)
+    {
+      json jj = tess;
+      test(TessellationArchive::isReference(jj), "Expected an archive reference.");
+      test(jj.find("vertices") == jj.end(), "Expected no inline coordinates.");
+      jtess.push_back(jj);
+    }
+    test(archive.close(), "Could not write archive.");
+  }
+  // Round-trip the references through text, as a file would.
+  jtess = json::parse(jtess.dump());
+
+  // Without an archive, references cannot be resolved and an error is logged.
+  smtk::io::Logger::instance().reset();
+  Tessellation unresolved = jtess[1];
+  test(unresolved.coords().empty() && unresolved.conn().empty(), "Expected an empty result.");
+  test(smtk::io::Logger::instance().hasErrors(), "Expected an unresolved reference to be logged.");
+  smtk::io::Logger::instance().reset();
+
+  // Read tessellations back from the (memory-mapped) archive.
+  {
+    TessellationArchive archive;
+    test(archive.open(filename), "Could not open archive.");
+    test(archive.isReadable(), "Expected a readable archive.");
+    TessellationArchive::Scope scope(archive);
+    for (std::size_t ii = 0; ii < original.size(); ++ii)
+    {
+      Tessellation tess = jtess[ii];
+      test(tess.coords() == original[ii].coords(), "Coordinates did not round-trip.");
+      test(tess.conn() == original[ii].conn(), "Connectivity did not round-trip.");
+    }
+
+    // Inline tessellations are still read while an archive is active.
+    json jinline;
+    {
+      TessellationArchive unused;
+      TessellationArchive::Scope inner(unused);
+      jinline = original[1];
+    }
+    test(!TessellationArchive::isReference(jinline), "Expected inline tessellation data.");
+    Tessellation tess = jinline;
+    test(tess.coords() == original[1].coords(), "Inline tessellation not read.");
+
+    // References past the end of the archive are rejected.
+    json jbad = jtess[1];
+    jbad["archive"]["vertices"][1] = 1 << 30;
+    test(!archive.read(jbad, tess), "Expected an out-of-bounds reference to fail.");
+    test(tess.coords().empty(), "Expected a failed read to reset the tessellation.");
+  }
+
+  // Files that are not archives are rejected.
+  {
+    std::FILE* fid = std::fopen(filename.c_str(), "wb");
+    std::fputs("{ \"not\": \"an archive\" }", fid);
+    std::fclose(fid);
+    TessellationArchive archive;
+    test(!archive.open(filename), "Expected a non-archive to be rejected.");
+  }
+
+  std::remove(filename.c_str());
+  return 0;
+}
@@ -22,17 +22,22 @@ namespace
 smtk::operation::Launchers::LauncherMap::key_type default_key = "default";
 
 // The default launcher uses a thread pool and is copy-constructible (so it can
-// be placed in a map).
+// be placed in a map). Operations run on the process-wide executor at low
+// priority, since they may block on resource locks for long periods.
 class DefaultLauncher
 {
 public:
   DefaultLauncher()
-    : m_pool(new smtk::common::ThreadPool<smtk::operation::Operation::Result>)
+    : m_pool(new smtk::common::ThreadPool<smtk::operation::Operation::Result>(
+        0,
+        smtk::common::Executor::Priority::Low))
   {
   }
 
   DefaultLauncher(const DefaultLauncher& /*unused*/)
-    : m_pool(new smtk::common::ThreadPool<smtk::operation::Operation::Result>)
+    : m_pool(new smtk::common::ThreadPool<smtk::operation::Operation::Result>(
+        0,
+        smtk::common::Executor::Priority::Low))
   {
   }
 
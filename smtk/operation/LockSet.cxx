@@ -0,0 +1,142 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/LockSet.h"
+
+#include "smtk/resource/Resource.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace
+{
+const std::size_t g_none = std::numeric_limits<std::size_t>::max();
+}
+
+namespace smtk
+{
+namespace operation
+{
+
+LockSet::LockSet(const ResourceAccessMap& resourcesAndLockTypes)
+{
+  m_entries.reserve(resourcesAndLockTypes.size());
+  for (const auto& resourceAndLockType : resourcesAndLockTypes)
+  {
+    auto resource = resourceAndLockType.first.lock();
+    if (!resource || resourceAndLockType.second == smtk::resource::LockType::DoNotLock)
+    {
+      continue;
+    }
+    m_entries.push_back({ resource, resource->id(), resourceAndLockType.second });
+  }
+
+  // Sort the resources into a canonical order so that all lock sets contend
+  // for shared resources in the same sequence.
+  std::sort(m_entries.begin(), m_entries.end(), [](const Entry& lhs, const Entry& rhs) {
+    return lhs.id < rhs.id;
+  });
+}
+
+LockSet::~LockSet()
+{
+  this->unlock();
+}
+
+void LockSet::lock()
+{
+  if (m_locked)
+  {
+    return;
+  }
+
+  std::size_t failed = g_none;
+  while (!this->tryLockAll(g_none, failed))
+  {
+    // Wait for the contended lock while holding no others, then attempt to
+    // acquire the remaining locks without blocking.
+    std::size_t held = failed;
+    auto resource = m_entries[held].resource.lock();
+    if (resource)
+    {
+      resource->lock({}).lock(m_entries[held].lockType);
+    }
+    else
+    {
+      held = g_none;
+    }
+
+    if (this->tryLockAll(held, failed))
+    {
+      break;
+    }
+
+    // Back off before retrying so the holder of the contended lock can make
+    // progress.
+    std::this_thread::yield();
+  }
+  m_locked = true;
+}
+
+bool LockSet::tryLock()
+{
+  if (!m_locked)
+  {
+    std::size_t failed;
+    m_locked = this->tryLockAll(g_none, failed);
+  }
+  return m_locked;
+}
+
+void LockSet::unlock()
+{
+  if (m_locked)
+  {
+    this->release(m_entries.size(), g_none);
+    m_locked = false;
+  }
+}
+
+bool LockSet::tryLockAll(std::size_t held, std::size_t& failed)
+{
+  for (std::size_t ii = 0; ii < m_entries.size(); ++ii)
+  {
+    if (ii == held)
+    {
+      continue;
+    }
+
+    // Resources that have been destroyed no longer need to be locked.
+    auto resource = m_entries[ii].resource.lock();
+    if (resource && !resource->lock({}).tryLock(m_entries[ii].lockType))
+    {
+      this->release(ii, held);
+      failed = ii;
+      return false;
+    }
+  }
+  return true;
+}
+
+void LockSet::release(std::size_t end, std::size_t held)
+{
+  for (std::size_t ii = 0; ii < m_entries.size(); ++ii)
+  {
+    if (ii < end || ii == held)
+    {
+      if (auto resource = m_entries[ii].resource.lock())
+      {
+        resource->lock({}).unlock(m_entries[ii].lockType);
+      }
+    }
+  }
+}
+} // namespace operation
+} // namespace smtk
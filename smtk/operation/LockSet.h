@@ -0,0 +1,89 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_operation_LockSet_h
+#define smtk_operation_LockSet_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/common/UUID.h"
+#include "smtk/operation/SpecificationOps.h"
+#include "smtk/resource/Lock.h"
+
+#include <memory>
+#include <vector>
+
+namespace smtk
+{
+namespace resource
+{
+class Resource;
+}
+namespace operation
+{
+
+/// Acquire the locks an operation requires on a collection of resources as a
+/// single unit.
+///
+/// Resources are visited in a canonical order (sorted by UUID) and locks are
+/// taken with an all-or-nothing strategy: every lock is first attempted without
+/// waiting; if any attempt fails, all locks acquired so far are released and
+/// the set blocks on the contended lock alone before trying the rest again.
+/// A LockSet therefore never waits while holding locks on other resources, so
+/// concurrent operations cannot deadlock and operations on disjoint resources
+/// proceed in parallel.
+///
+/// Any locks still held when the LockSet is destroyed are released.
+class SMTKCORE_EXPORT LockSet
+{
+public:
+  LockSet(const ResourceAccessMap& resourcesAndLockTypes);
+  LockSet(const LockSet&) = delete;
+  LockSet& operator=(const LockSet&) = delete;
+  ~LockSet();
+
+  /// Block until every lock in the set is held.
+  void lock();
+
+  /// Attempt to acquire every lock in the set without waiting. Either all locks
+  /// are acquired (and true is returned) or none are held.
+  bool tryLock();
+
+  /// Release every lock in the set.
+  void unlock();
+
+  /// Return true if the set currently holds its locks.
+  bool isLocked() const { return m_locked; }
+
+  /// Return the number of resources that require locking.
+  std::size_t size() const { return m_entries.size(); }
+
+private:
+  struct Entry
+  {
+    std::weak_ptr<smtk::resource::Resource> resource;
+    smtk::common::UUID id;
+    smtk::resource::LockType lockType;
+  };
+
+  // Try to lock every entry other than \a held (which is already locked). On
+  // failure, every lock (including \a held) is released and \a failed is set to
+  // the index of the entry that could not be acquired.
+  bool tryLockAll(std::size_t held, std::size_t& failed);
+
+  // Release the locks on entries in [0, end) as well as on \a held.
+  void release(std::size_t end, std::size_t held);
+
+  std::vector<Entry> m_entries;
+  bool m_locked{ false };
+};
+} // namespace operation
+} // namespace smtk
+
+#endif // smtk_operation_LockSet_h
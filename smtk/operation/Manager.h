@@ -24,6 +24,7 @@
 #include "smtk/operation/MetadataContainer.h"
 #include "smtk/operation/Observer.h"
 #include "smtk/operation/Operation.h"
+#include "smtk/operation/SpecificationCache.h"
 
 #include <array>
 #include <string>
@@ -127,6 +128,10 @@ public:
   Metadata::Observers& metadataObservers() { return m_metadataObservers; }
   const Metadata::Observers& metadataObservers() const { return m_metadataObservers; }
 
+  /// Return the specifications shared by registrations of each operation type.
+  SpecificationCache& specifications() { return m_specifications; }
+  const SpecificationCache& specifications() const { return m_specifications; }
+
   // Return the managers instance that contains this manager, if it exists.
   smtk::common::Managers::Ptr managers() const { return m_managers.lock(); }
   void setManagers(const smtk::common::Managers::Ptr& managers) { m_managers = managers; }
@@ -216,6 +221,9 @@ private:
   /// A container for all registered operation metadata.
   MetadataContainer m_metadata;
 
+  /// Specifications shared by registrations of operation types that opt in.
+  SpecificationCache m_specifications;
+
   /// A weak pointer to the managers instance that contains this manager, if it
   /// exists.
   std::weak_ptr<smtk::common::Managers> m_managers;
@@ -247,12 +255,14 @@ bool Manager::registerOperation(const std::string& typeName)
   // the hash of the type_index as its index, the specification defined by
   // OperationType::createSpecification() and the creation method
   // OperationType::create(). This method is simply a shorthand that constructs a
-  // metadata instance that adheres to this convention.
+  // metadata instance that adheres to this convention. Operation types that
+  // opt into sharing their specification construct it once per manager (see
+  // SpecificationCache).
 
   return Manager::registerOperation(Metadata(
     typeName,
     std::type_index(typeid(OperationType)).hash_code(),
-    std::dynamic_pointer_cast<Operation>(OperationType::create())->createSpecification(),
+    m_specifications.specification(*std::dynamic_pointer_cast<Operation>(OperationType::create())),
     []() { return OperationType::create(); }));
 }
 
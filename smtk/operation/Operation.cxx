@@ -8,6 +8,7 @@
 //  PURPOSE.  See the above copyright notice for more information.
 //=========================================================================
 #include "smtk/operation/Operation.h"
+#include "smtk/operation/LockSet.h"
 #include "smtk/operation/Manager.h"
 #include "smtk/operation/Observer.h"
 #include "smtk/operation/SpecificationOps.h"
@@ -100,7 +101,7 @@ Operation::Specification Operation::specification()
     }
     else
     {
-      m_specification = createSpecification();
+      m_specification = this->createSpecification();
     }
   }
   return m_specification;
@@ -124,20 +125,14 @@ Operation::Result Operation::operate()
   // Gather all requested resources and their lock types.
   auto resourcesAndLockTypes = extractResourcesAndLockTypes(this->parameters());
 
-  // Mutex to prevent multiple Operations from locking resources at the same
-  // time (which could result in deadlock).
-  static std::mutex mutex;
-
-  // Lock the resources.
-  mutex.lock();
+// Leave this for debugging, but do not include it in every debug build
+// as it can be quite noisy.
+#if 0
   for (auto& resourceAndLockType : resourcesAndLockTypes)
   {
     auto resource = resourceAndLockType.first.lock();
     auto& lockType = resourceAndLockType.second;
 
-// Leave this for debugging, but do not include it in every debug build
-// as it can be quite noisy.
-#if 0
     // Given the puzzling result of deadlock that can arise if one Operation
     // calls another Operation using its public API and passes it a Resource
     // with a Write LockType, we print to the terminal which resources we are
@@ -155,15 +150,18 @@ Operation::Result Operation::operate()
                      ? "Read"
                      : (lockType == smtk::resource::LockType::Write ? "Write" : "DoNotLock"))
               << "\"\n";
+  }
 #endif
 
-    resource->lock({}).lock(lockType);
-  }
-  mutex.unlock();
+  // Lock the resources. The lock set acquires all of the locks (in a canonical
+  // order) or none of them, so operations on disjoint resources are not
+  // serialized and a waiting operation never holds locks others need.
+  LockSet locks(resourcesAndLockTypes);
+  locks.lock();
 
   // Remember where the log was so we only serialize messages for this
   // operation:
-  std::size_t logStart = this->log().numberOfRecords();
+  smtk::io::Logger::Cursor logStart = this->log().cursor();
 
   Result result;
 
@@ -222,11 +220,10 @@ Operation::Result Operation::operate()
 
   // Now grab all log messages and serialize them into the result attribute.
   {
-    std::size_t logEnd = this->log().numberOfRecords();
-    if (logEnd > logStart)
+    auto records = this->log().recordsSince(logStart);
+    if (!records.empty())
     {
       // Serialize relevant log records to a json-formatted string.
-      auto records = this->log().records();
       nlohmann::json j = records;
       result->findString("log")->appendValue(j.dump());
     }
@@ -239,13 +236,7 @@ Operation::Result Operation::operate()
   }
 
   // Unlock the resources.
-  for (auto& resourceAndLockType : resourcesAndLockTypes)
-  {
-    auto resource = resourceAndLockType.first.lock();
-    auto& lockType = resourceAndLockType.second;
-
-    resource->lock({}).unlock(lockType);
-  }
+  locks.unlock();
 
   return result;
 }
@@ -33,6 +33,7 @@ namespace operation
 {
 class ImportPythonOperation;
 class Manager;
+class SpecificationCache;
 
 /// Operation is a base class for all SMTK operations. SMTK operations are
 /// essentially functors that operate on SMTK resources and resource components.
@@ -76,6 +77,7 @@ public:
 
   friend Manager;
   friend ImportPythonOperation;
+  friend SpecificationCache;
 
   // Index is a compile-time intrinsic of the derived operation; as such, it
   // cannot be set. It is virtual so that derived operations can assign their
@@ -171,6 +173,13 @@ protected:
   // an attribute .sbt file.
   Specification createBaseSpecification() const;
 
+  // Return true if all operations of this type have the same specification,
+  // so that an operation manager may construct it once and share it among
+  // registrations (see SpecificationCache). Operations opt in by overriding
+  // this method; those whose specification depends upon their own state or
+  // upon global state (such as the available file formats) must not.
+  virtual bool hasSharedSpecification() const { return false; }
+
   int m_debugLevel{ 0 };
   std::weak_ptr<Manager> m_manager;
 
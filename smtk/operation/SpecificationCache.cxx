@@ -0,0 +1,66 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/operation/SpecificationCache.h"
+
+namespace smtk
+{
+namespace operation
+{
+
+bool SpecificationCache::cacheable(const Operation& operation)
+{
+  return operation.hasSharedSpecification() &&
+    operation.index() == std::type_index(typeid(operation)).hash_code();
+}
+
+Operation::Specification SpecificationCache::specification(Operation& operation)
+{
+  if (!SpecificationCache::cacheable(operation))
+  {
+    return operation.createSpecification();
+  }
+
+  std::type_index key(typeid(operation));
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto it = m_specifications.find(key);
+    if (it != m_specifications.end())
+    {
+      return it->second;
+    }
+  }
+
+  // Construct the specification without holding the lock, since doing so may
+  // register (and thereby query the cache for) other operations. If another
+  // thread caches a specification for this type first, use it instead.
+  Operation::Specification specification = operation.createSpecification();
+  if (!specification)
+  {
+    return specification;
+  }
+
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_specifications.emplace(key, specification).first->second;
+}
+
+bool SpecificationCache::contains(const Operation& operation) const
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  return m_specifications.find(std::type_index(typeid(operation))) != m_specifications.end();
+}
+
+void SpecificationCache::clear()
+{
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_specifications.clear();
+}
+
+} // namespace operation
+} // namespace smtk
@@ -0,0 +1,69 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#ifndef smtk_operation_SpecificationCache_h
+#define smtk_operation_SpecificationCache_h
+
+#include "smtk/CoreExports.h"
+
+#include "smtk/operation/Operation.h"
+
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+namespace smtk
+{
+namespace operation
+{
+
+/// A cache of operation specifications, keyed by operation type, held by an
+/// operation manager.
+///
+/// Constructing a specification (typically by parsing an operation's XML
+/// description) is expensive relative to creating and running a simple
+/// operation. An operation manager shares a single specification among the
+/// operations it creates, in which each instance creates (and, upon
+/// destruction, removes) its own parameters and results. Operation types that
+/// opt in via Operation::hasSharedSpecification() are additionally parsed only
+/// once per manager, no matter how many times (or under how many names) they
+/// are registered.
+///
+/// Only operations whose specification is fully determined by their C++ type
+/// should opt in. Operations whose index() is assigned at runtime (e.g.,
+/// python operations) are never cached.
+class SMTKCORE_EXPORT SpecificationCache
+{
+public:
+  SpecificationCache() = default;
+  SpecificationCache(const SpecificationCache&) = delete;
+  SpecificationCache& operator=(const SpecificationCache&) = delete;
+
+  /// Return the specification shared by operations of \a operation's type,
+  /// constructing it with \a operation if it has not yet been cached.
+  /// Operations that have not opted into sharing receive a new specification.
+  Operation::Specification specification(Operation& operation);
+
+  /// Return true if a specification is cached for \a operation's type.
+  bool contains(const Operation& operation) const;
+
+  /// Discard all cached specifications. Operations holding a specification
+  /// continue to use it; subsequent registrations construct new ones.
+  void clear();
+
+private:
+  static bool cacheable(const Operation& operation);
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::type_index, Operation::Specification> m_specifications;
+};
+} // namespace operation
+} // namespace smtk
+
+#endif // smtk_operation_SpecificationCache_h
@@ -0,0 +1,123 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "smtk/operation/LockSet.h"
+
+#include "smtk/resource/Component.h"
+#include "smtk/resource/DerivedFrom.h"
+#include "smtk/resource/Lock.h"
+#include "smtk/resource/Resource.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+class MyResource : public smtk::resource::DerivedFrom<MyResource, smtk::resource::Resource>
+{
+public:
+  smtkTypeMacro(MyResource);
+  smtkCreateMacro(MyResource);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID& /*compId*/) const override
+  {
+    return smtk::resource::ComponentPtr();
+  }
+
+  std::function<bool(const smtk::resource::Component&)> queryOperation(
+    const std::string& /*unused*/) const override
+  {
+    return [](const smtk::resource::Component& /*unused*/) { return true; };
+  }
+
+  void visit(smtk::resource::Component::Visitor& /*v*/) const override {}
+
+protected:
+  MyResource()
+    : smtk::resource::DerivedFrom<MyResource, smtk::resource::Resource>()
+  {
+  }
+};
+} // namespace
+
+// Exercise all-or-nothing acquisition of resource locks and verify that lock
+// sets requesting overlapping resources in opposite orders do not deadlock.
+int TestLockSet(int /*unused*/, char** const /*unused*/)
+{
+  using smtk::resource::LockType;
+
+  auto resourceA = MyResource::create();
+  auto resourceB = MyResource::create();
+
+  smtk::operation::ResourceAccessMap writeA;
+  writeA[resourceA] = LockType::Write;
+
+  smtk::operation::ResourceAccessMap writeB;
+  writeB[resourceB] = LockType::Write;
+
+  smtk::operation::ResourceAccessMap readAwriteB;
+  readAwriteB[resourceA] = LockType::Read;
+  readAwriteB[resourceB] = LockType::Write;
+
+  {
+    smtk::operation::LockSet locksA(writeA);
+    locksA.lock();
+    smtkTest(resourceA->locked() == LockType::Write, "Resource A should be write-locked.");
+
+    // A lock set on a disjoint resource is not blocked by the first.
+    smtk::operation::LockSet locksB(writeB);
+    smtkTest(locksB.tryLock(), "Disjoint lock set should be acquired without waiting.");
+    locksB.unlock();
+    smtkTest(resourceB->locked() == LockType::Unlocked, "Resource B should be unlocked.");
+
+    // A lock set that overlaps the first must fail without holding any lock.
+    smtk::operation::LockSet locksAB(readAwriteB);
+    smtkTest(!locksAB.tryLock(), "Overlapping lock set should not be acquired.");
+    smtkTest(
+      resourceB->locked() == LockType::Unlocked,
+      "A failed lock set should release the locks it acquired.");
+  }
+  smtkTest(resourceA->locked() == LockType::Unlocked, "Destroying a lock set should unlock it.");
+
+  // Contend for both resources from several threads with opposing lock types.
+  smtk::operation::ResourceAccessMap writeAreadB;
+  writeAreadB[resourceA] = LockType::Write;
+  writeAreadB[resourceB] = LockType::Read;
+
+  std::atomic<int> counter(0);
+  std::vector<std::thread> threads;
+  for (int ii = 0; ii < 8; ++ii)
+  {
+    const auto& access = (ii % 2 == 0 ? readAwriteB : writeAreadB);
+    threads.emplace_back([&access, &counter]() {
+      for (int jj = 0; jj < 1000; ++jj)
+      {
+        smtk::operation::LockSet locks(access);
+        locks.lock();
+        ++counter;
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  smtkTest(counter == 8000, "Every lock set should have been acquired.");
+  smtkTest(
+    resourceA->locked() == LockType::Unlocked && resourceB->locked() == LockType::Unlocked,
+    "All resources should be unlocked.");
+
+  return 0;
+}
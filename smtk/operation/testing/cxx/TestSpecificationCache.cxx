@@ -0,0 +1,151 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/Definition.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Operation.h"
+#include "smtk/operation/SpecificationCache.h"
+
+namespace
+{
+// An operation whose specification is determined by its type, which it shares.
+class OperationA : public smtk::operation::Operation
+{
+public:
+  smtkTypeMacro(OperationA);
+  smtkCreateMacro(OperationA);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  Result operateInternal() override { return this->createResult(Outcome::SUCCEEDED); }
+
+  Specification createSpecification() override
+  {
+    ++s_numberOfSpecifications;
+    Specification spec = this->createBaseSpecification();
+    auto opDef = spec->createDefinition("operation a", "operation");
+    auto resultDef = spec->createDefinition("result(operation a)", "result");
+    return spec;
+  }
+
+  static int s_numberOfSpecifications;
+
+protected:
+  bool hasSharedSpecification() const override { return true; }
+};
+
+int OperationA::s_numberOfSpecifications = 0;
+
+class OperationB : public OperationA
+{
+public:
+  smtkTypeMacro(OperationB);
+  smtkCreateMacro(OperationB);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+};
+
+// An operation that does not opt into sharing its specification.
+class OperationC : public OperationA
+{
+public:
+  smtkTypeMacro(OperationC);
+  smtkCreateMacro(OperationC);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+protected:
+  bool hasSharedSpecification() const override { return false; }
+};
+} // namespace
+
+int TestSpecificationCache(int /*unused*/, char** const /*unused*/)
+{
+  auto manager = smtk::operation::Manager::create();
+  auto& cache = manager->specifications();
+
+  // Unmanaged operations construct their own specifications.
+  auto unmanaged = OperationA::create();
+  smtkTest(unmanaged->specification() != nullptr, "Unmanaged operation has no specification.");
+  smtkTest(!cache.contains(*unmanaged), "Unmanaged operations should not be cached.");
+
+  // Registering an operation type caches its specification, which is shared
+  // by the operations the manager creates...
+  OperationA::s_numberOfSpecifications = 0;
+  manager->registerOperation<OperationA>();
+  smtkTest(cache.contains(*unmanaged), "The specification should be cached.");
+  auto op1 = manager->create<OperationA>();
+  auto op2 = manager->create<OperationA>();
+  smtkTest(op1->specification() == op2->specification(), "Specifications should be shared.");
+
+  // ...and by later registrations of the same type.
+  manager->unregisterOperation<OperationA>();
+  manager->registerOperation<OperationA>();
+  smtkTest(
+    manager->create<OperationA>()->specification() == op1->specification(),
+    "Re-registered operations should share the cached specification.");
+  smtkTest(
+    OperationA::s_numberOfSpecifications == 1,
+    "The specification should be constructed once per manager.");
+
+  // Each operation has its own parameters and results.
+  smtkTest(op1->parameters() != op2->parameters(), "Parameters should not be shared.");
+  auto result1 = op1->operate();
+  auto result2 = op2->operate();
+  smtkTest(result1 && result2 && result1 != result2, "Results should not be shared.");
+  smtkTest(
+    result1->findInt("outcome")->value() ==
+      static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+    "Operation should succeed with a shared specification.");
+
+  // Parameters are removed from the shared specification with their operation.
+  auto parameters = op2->parameters();
+  auto specification = op2->specification();
+  op2.reset();
+  smtkTest(
+    !specification->findAttribute(parameters->name()),
+    "Parameters should be removed with their operation.");
+
+  // Operations of different types do not share a specification.
+  manager->registerOperation<OperationB>();
+  smtkTest(
+    manager->create<OperationB>()->specification() != op1->specification(),
+    "Specifications should not be shared across types.");
+
+  // Other managers construct their own specifications.
+  auto manager2 = smtk::operation::Manager::create();
+  manager2->registerOperation<OperationA>();
+  smtkTest(
+    manager2->create<OperationA>()->specification() != op1->specification(),
+    "Specifications should not be shared across managers.");
+
+  // Operations that do not opt in are not cached.
+  manager->registerOperation<OperationC>();
+  auto op3 = manager->create<OperationC>();
+  smtkTest(!cache.contains(*op3), "Operations that do not opt in should not be cached.");
+  manager->unregisterOperation<OperationC>();
+  manager->registerOperation<OperationC>();
+  smtkTest(
+    manager->create<OperationC>()->specification() != op3->specification(),
+    "Operations that do not opt in should construct new specifications.");
+
+  // Clearing the cache causes subsequent registrations to construct a new one.
+  cache.clear();
+  manager->unregisterOperation<OperationA>();
+  manager->registerOperation<OperationA>();
+  smtkTest(
+    manager->create<OperationA>()->specification() != op1->specification(),
+    "A cleared cache should construct new specifications.");
+
+  return 0;
+}
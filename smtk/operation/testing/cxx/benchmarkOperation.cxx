@@ -0,0 +1,113 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Resource.h"
+
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Operation.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+/// Measure the latency of creating and running a trivial operation, both
+/// unmanaged (with a freshly constructed specification per instance) and
+/// created by an operation manager (sharing the specification the manager
+/// constructed at registration), as well as the latency of registering the
+/// operation with new managers. The number of iterations defaults to 10000
+/// and may be passed as the first argument.
+
+namespace benchmark_operation
+{
+class TrivialOperation : public smtk::operation::Operation
+{
+public:
+  smtkTypeMacro(benchmark_operation::TrivialOperation);
+  smtkCreateMacro(TrivialOperation);
+  smtkSharedFromThisMacro(smtk::operation::Operation);
+
+  Result operateInternal() override { return this->createResult(Outcome::SUCCEEDED); }
+
+  Specification createSpecification() override
+  {
+    Specification spec = this->createBaseSpecification();
+    auto opDef = spec->createDefinition("trivial operation", "operation");
+    auto resultDef = spec->createDefinition("result(trivial operation)", "result");
+    return spec;
+  }
+
+protected:
+  bool hasSharedSpecification() const override { return true; }
+};
+
+double elapsed(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool run(smtk::operation::Operation::Ptr op)
+{
+  auto result = op->operate();
+  return result->findInt("outcome")->value() ==
+    static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED);
+}
+} // namespace benchmark_operation
+
+int main(int argc, char* argv[])
+{
+  using benchmark_operation::TrivialOperation;
+
+  int numIterations = argc > 1 ? std::atoi(argv[1]) : 10000;
+  int succeeded = 0;
+
+  // #### Unmanaged: every instance constructs its own specification.
+  auto start = std::chrono::steady_clock::now();
+  for (int ii = 0; ii < numIterations; ++ii)
+  {
+    succeeded += benchmark_operation::run(TrivialOperation::create()) ? 1 : 0;
+  }
+  double deltaT = benchmark_operation::elapsed(start);
+  std::cout << numIterations << " unmanaged create+operate " << deltaT << " seconds "
+            << (1.e6 * deltaT / numIterations) << " us/operation\n";
+
+  // #### Managed: instances share the specification held by their manager.
+  auto manager = smtk::operation::Manager::create();
+  manager->registerOperation<TrivialOperation>();
+  start = std::chrono::steady_clock::now();
+  for (int ii = 0; ii < numIterations; ++ii)
+  {
+    succeeded += benchmark_operation::run(manager->create<TrivialOperation>()) ? 1 : 0;
+  }
+  deltaT = benchmark_operation::elapsed(start);
+  std::cout << numIterations << " managed create+operate " << deltaT << " seconds "
+            << (1.e6 * deltaT / numIterations) << " us/operation\n";
+
+  // #### Re-registration: the manager parses the specification only once.
+  start = std::chrono::steady_clock::now();
+  for (int ii = 0; ii < numIterations; ++ii)
+  {
+    manager->unregisterOperation<TrivialOperation>();
+    manager->registerOperation<TrivialOperation>();
+    succeeded += benchmark_operation::run(manager->create<TrivialOperation>()) ? 1 : 0;
+  }
+  deltaT = benchmark_operation::elapsed(start);
+  std::cout << numIterations << " re-register+create+operate " << deltaT << " seconds "
+            << (1.e6 * deltaT / numIterations) << " us/operation\n";
+
+  if (succeeded != 3 * numIterations)
+  {
+    std::cerr << "Expected " << 3 * numIterations << " successful operations, got " << succeeded
+              << "\n";
+    return 1;
+  }
+
+  return 0;
+}
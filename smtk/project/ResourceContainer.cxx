@@ -14,6 +14,8 @@
 
 #include "smtk/resource/Manager.h"
 
+#include "smtk/io/Logger.h"
+
 namespace
 {
 class ResourceWrapper
@@ -172,7 +174,8 @@ smtk::resource::ResourcePtr ResourceContainer::get(const smtk::common::UUID& id)
     return *resourceIt;
   }
 
-  return smtk::resource::ResourcePtr();
+  // If the resource has not been loaded yet, load it now.
+  return this->load(id);
 }
 
 smtk::resource::ConstResourcePtr ResourceContainer::get(const smtk::common::UUID& id) const
@@ -202,6 +205,15 @@ smtk::resource::ResourcePtr ResourceContainer::get(const std::string& url)
     return *resourceIt;
   }
 
+  // If the resource has not been loaded yet, load it now.
+  for (const auto& entry : m_surrogates)
+  {
+    if (entry.second.m_surrogate.location() == url)
+    {
+      return this->load(entry.first);
+    }
+  }
+
   return smtk::resource::ResourcePtr();
 }
 
@@ -224,6 +236,20 @@ std::set<smtk::resource::ResourcePtr> ResourceContainer::findByRole(const std::s
 {
   std::set<smtk::resource::ResourcePtr> resource_set;
 
+  // Load any unloaded resources with this role.
+  std::vector<smtk::common::UUID> unloaded;
+  for (const auto& entry : m_surrogates)
+  {
+    if (entry.second.m_role == role)
+    {
+      unloaded.push_back(entry.first);
+    }
+  }
+  for (const auto& id : unloaded)
+  {
+    this->load(id);
+  }
+
   // Get the resources by role
   typedef Container::index<RoleTag>::type ResourcesByRole;
   ResourcesByRole& resources = m_resources.get<RoleTag>();
@@ -389,6 +415,9 @@ bool ResourceContainer::add(
     }
   }
 
+  // The resource no longer needs a surrogate if it was held as one.
+  m_surrogates.erase(resource->id());
+
   // Assign the resource's role.
   if (role.empty())
   {
@@ -427,6 +456,101 @@ bool ResourceContainer::add(
   return true;
 }
 
+bool ResourceContainer::add(
+  const smtk::resource::Surrogate& surrogate,
+  const std::string& role,
+  const nlohmann::json& record)
+{
+  // Filter out resources that are not allowed in the container (if a whitelist
+  // is provided).
+  if (!m_types.empty() && m_types.find(surrogate.typeName()) == m_types.end())
+  {
+    return false;
+  }
+
+  if (
+    m_resources.get<IdTag>().find(surrogate.id()) != m_resources.get<IdTag>().end() ||
+    m_surrogates.find(surrogate.id()) != m_surrogates.end())
+  {
+    return false;
+  }
+
+  m_surrogates.insert(std::make_pair(surrogate.id(), Unloaded{ surrogate, role, record }));
+  return true;
+}
+
+smtk::resource::ResourcePtr ResourceContainer::load(const smtk::common::UUID& id)
+{
+  auto it = m_surrogates.find(id);
+  if (it == m_surrogates.end())
+  {
+    typedef Container::index<IdTag>::type ResourcesById;
+    ResourcesById& resources = m_resources.get<IdTag>();
+    auto resourceIt = resources.find(id);
+    return resourceIt != resources.end() ? *resourceIt : smtk::resource::ResourcePtr();
+  }
+
+  // The surrogate reads the resource (unless the manager already holds it)
+  // and verifies that it is the resource that was expected.
+  auto manager = m_manager.lock();
+  if (!it->second.m_surrogate.fetch(manager))
+  {
+    smtkErrorMacro(
+      smtk::io::Logger::instance(),
+      "Could not load resource " << id << " from \"" << it->second.m_surrogate.location()
+                                 << "\".");
+    return smtk::resource::ResourcePtr();
+  }
+
+  smtk::resource::ResourcePtr resource = it->second.m_surrogate.resource();
+  std::string role = it->second.m_role;
+  m_surrogates.erase(it);
+  resource->setClean(true);
+  this->add(resource, role);
+  return this->get(id);
+}
+
+bool ResourceContainer::loadAll()
+{
+  std::vector<smtk::common::UUID> unloaded;
+  unloaded.reserve(m_surrogates.size());
+  for (const auto& entry : m_surrogates)
+  {
+    unloaded.push_back(entry.first);
+  }
+
+  bool loaded = true;
+  for (const auto& id : unloaded)
+  {
+    loaded &= (this->load(id) != nullptr);
+  }
+  return loaded;
+}
+
+std::vector<smtk::resource::Surrogate> ResourceContainer::surrogates() const
+{
+  std::vector<smtk::resource::Surrogate> result;
+  result.reserve(m_surrogates.size());
+  for (const auto& entry : m_surrogates)
+  {
+    result.push_back(entry.second.m_surrogate);
+  }
+  return result;
+}
+
+std::string ResourceContainer::surrogateRole(const smtk::common::UUID& id) const
+{
+  auto it = m_surrogates.find(id);
+  return it != m_surrogates.end() ? it->second.m_role : std::string();
+}
+
+const nlohmann::json& ResourceContainer::surrogateRecord(const smtk::common::UUID& id) const
+{
+  static const nlohmann::json none;
+  auto it = m_surrogates.find(id);
+  return it != m_surrogates.end() ? it->second.m_record : none;
+}
+
 bool ResourceContainer::remove(const smtk::resource::ResourcePtr& resource)
 {
   // Find the resource
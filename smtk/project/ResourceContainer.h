@@ -20,6 +20,13 @@
 #include "smtk/project/Tags.h"
 
 #include "smtk/resource/Container.h"
+#include "smtk/resource/Surrogate.h"
+
+#include "nlohmann/json.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
 
 namespace smtk
 {
@@ -79,6 +86,13 @@ public:
   using iterator = typename Container::iterator;
   using const_iterator = typename Container::const_iterator;
 
+  /// How the resources listed in a serialized project are loaded.
+  enum class LoadMode
+  {
+    Eager, //!< Read every resource when the project is read.
+    Lazy   //!< Hold a surrogate for each resource and read it on first access.
+  };
+
   /// A property key for accessing string-valued roles assigned to a resource
   /// held by a project.
   static constexpr const char* const role_name = "project_role";
@@ -104,6 +118,10 @@ public:
 
   /// Returns the resource that relates to the given uuid.  If no association
   /// exists this will return a null pointer.
+  ///
+  /// If the resource is held as an unloaded surrogate (see LoadMode::Lazy),
+  /// the non-const overloads read it first and so may perform file I/O.
+  /// The const overloads never load resources.
   smtk::resource::ResourcePtr get(const smtk::common::UUID& id);
   smtk::resource::ConstResourcePtr get(const smtk::common::UUID& id) const;
   template<typename ResourceType>
@@ -112,7 +130,8 @@ public:
   smtk::shared_ptr<const ResourceType> get(const smtk::common::UUID&) const;
 
   /// Returns the resource that relates to the given url.  If no association
-  /// exists this will return a null pointer
+  /// exists this will return a null pointer. As above, the non-const overloads
+  /// may read an unloaded resource from disk.
   smtk::resource::ResourcePtr get(const std::string&);
   smtk::resource::ConstResourcePtr get(const std::string&) const;
   template<typename ResourceType>
@@ -122,7 +141,9 @@ public:
 
   ///@{
   /// Returns the set of resources that relates to the given role.  If no association
-  /// exists this will return an empty set.
+  /// exists this will return an empty set. The non-const overloads first read
+  /// every unloaded resource with the role (which may perform file I/O); the
+  /// const overloads only return loaded resources.
   std::set<smtk::resource::ResourcePtr> findByRole(const std::string&);
   std::set<smtk::resource::ConstResourcePtr> findByRole(const std::string&) const;
   template<typename ResourceType>
@@ -148,6 +169,35 @@ public:
   template<typename ResourceType>
   bool add(const smtk::shared_ptr<ResourceType>&, const std::string& role = std::string());
 
+  /// Add a surrogate for a resource that has not been loaded, along with the
+  /// role the resource will be given once loaded. The resource is read by
+  /// the non-const get() and findByRole() methods when they would return it
+  /// (or by load()). If given, \a record is the resource's entry in the
+  /// serialized project; it is written back unchanged while the resource
+  /// remains unloaded. Returns false if a resource or surrogate with the same
+  /// id is already held.
+  bool add(
+    const smtk::resource::Surrogate&,
+    const std::string& role,
+    const nlohmann::json& record = nlohmann::json());
+
+  /// Read the resource held as a surrogate with the given id, add it to the
+  /// container and return it. If the resource is already loaded, it is returned.
+  smtk::resource::ResourcePtr load(const smtk::common::UUID& id);
+
+  /// Read all resources held as surrogates. Returns false if any failed to load.
+  bool loadAll();
+
+  /// Return the surrogates for resources that have not yet been loaded.
+  std::vector<smtk::resource::Surrogate> surrogates() const;
+
+  /// Return the role assigned to the unloaded resource with the given id.
+  std::string surrogateRole(const smtk::common::UUID& id) const;
+
+  /// Return the serialized record of the unloaded resource with the given id
+  /// (or null if none was provided).
+  const nlohmann::json& surrogateRecord(const smtk::common::UUID& id) const;
+
   /// Removes a resource from a given Project. This doesn't explicitly release
   /// the memory of the resource, it only stops the tracking of the resource
   /// by the Project.
@@ -158,6 +208,20 @@ public:
   const std::set<std::string>& types() const { return m_types; }
   std::set<std::string>& types() { return m_types; }
 
+  ///@{
+  /// Control how from_json() loads the resources listed in a serialized project.
+  ///
+  /// In LoadMode::Eager (the default), resources are read using up to
+  /// numberOfLoadThreads() threads (0 means one per hardware thread). Use more
+  /// than one thread only when the readers of every resource type involved
+  /// are safe to run concurrently. In LoadMode::Lazy, a surrogate is added for
+  /// each resource instead.
+  LoadMode loadMode() const { return m_loadMode; }
+  void setLoadMode(LoadMode mode) { m_loadMode = mode; }
+  unsigned int numberOfLoadThreads() const { return m_numberOfLoadThreads; }
+  void setNumberOfLoadThreads(unsigned int threads) { m_numberOfLoadThreads = threads; }
+  ///@}
+
   std::shared_ptr<smtk::resource::Manager> manager() const { return m_manager.lock(); }
   void setManager(const std::weak_ptr<smtk::resource::Manager>& manager) { m_manager = manager; }
 
@@ -167,17 +231,33 @@ public:
   const_iterator end() const { return m_resources.end(); }
   iterator end() { return m_resources.end(); }
 
+  /// Note that empty(), size() and iteration only consider loaded resources.
   bool empty() const { return m_resources.empty(); }
   std::size_t size() const { return m_resources.size(); }
-  void clear() { m_resources.clear(); }
+  void clear()
+  {
+    m_resources.clear();
+    m_surrogates.clear();
+  }
 
 private:
   ResourceContainer(const smtk::project::Project*, const std::weak_ptr<smtk::resource::Manager>&);
 
+  /// A resource that has not yet been loaded.
+  struct Unloaded
+  {
+    smtk::resource::Surrogate m_surrogate;
+    std::string m_role;
+    nlohmann::json m_record;
+  };
+
   const smtk::project::Project* m_project;
   std::weak_ptr<smtk::resource::Manager> m_manager;
   std::set<std::string> m_types;
   Container m_resources;
+  std::map<smtk::common::UUID, Unloaded> m_surrogates;
+  LoadMode m_loadMode{ LoadMode::Eager };
+  unsigned int m_numberOfLoadThreads{ 1 };
   int m_undefinedRoleCounter;
 };
 
@@ -13,6 +13,35 @@
 
 #include "smtk/resource/Manager.h"
 
+#include "smtk/common/ThreadPool.h"
+#include "smtk/common/TypeName.h"
+
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Return the project role recorded in the serialized properties of a resource.
+std::string role(const nlohmann::json& jresource)
+{
+  auto jproperties = jresource.find("properties");
+  if (jproperties == jresource.end())
+  {
+    return std::string();
+  }
+  auto jstrings = jproperties->find(smtk::common::typeName<std::string>());
+  if (jstrings == jproperties->end())
+  {
+    return std::string();
+  }
+  auto jrole = jstrings->find(smtk::project::ResourceContainer::role_name);
+  return jrole != jstrings->end() && jrole->is_string() ? jrole->get<std::string>()
+                                                        : std::string();
+}
+} // namespace
+
 namespace smtk
 {
 namespace project
@@ -25,6 +54,23 @@ void to_json(json& j, const ResourceContainer& resourceContainer)
   {
     j["resources"].push_back(resource);
   }
+
+  // Resources that were never loaded are written as they were listed.
+  for (const auto& surrogate : resourceContainer.surrogates())
+  {
+    const json& record = resourceContainer.surrogateRecord(surrogate.id());
+    if (!record.is_null())
+    {
+      j["resources"].push_back(record);
+      continue;
+    }
+    json jsurrogate = { { "id", surrogate.id().toString() },
+                        { "type", surrogate.typeName() },
+                        { "location", surrogate.location() } };
+    jsurrogate["properties"][smtk::common::typeName<std::string>()][ResourceContainer::role_name] =
+      resourceContainer.surrogateRole(surrogate.id());
+    j["resources"].push_back(jsurrogate);
+  }
 }
 
 void from_json(const json& j, ResourceContainer& resourceContainer)
@@ -36,10 +82,95 @@ void from_json(const json& j, ResourceContainer& resourceContainer)
     return;
   }
 
-  for (json::const_iterator it = j["resources"].begin(); it != j["resources"].end(); ++it)
+  const json& jresources = j["resources"];
+  std::vector<smtk::resource::ResourcePtr> resources(jresources.size());
+  // Entries that have been read (or given a surrogate) before the loop below.
+  std::vector<bool> handled(jresources.size(), false);
+
+  // Resources with a registered reader can be read without the manager (and
+  // so on other threads, or later when a surrogate is used).
+  std::vector<std::function<smtk::resource::ResourcePtr(const std::string&)>> readers(
+    jresources.size());
+  std::vector<smtk::resource::Resource::Index> indices(jresources.size());
+  for (std::size_t i = 0; i < jresources.size(); ++i)
   {
-    smtk::resource::ResourcePtr resource =
-      manager->read(it->at("type").get<std::string>(), it->at("location").get<std::string>());
+    auto metadata = manager->metadata().get<smtk::resource::NameTag>().find(
+      jresources[i].at("type").get<std::string>());
+    if (metadata != manager->metadata().get<smtk::resource::NameTag>().end())
+    {
+      readers[i] = metadata->read;
+      indices[i] = metadata->index();
+    }
+  }
+
+  if (resourceContainer.loadMode() == ResourceContainer::LoadMode::Lazy)
+  {
+    for (std::size_t i = 0; i < jresources.size(); ++i)
+    {
+      const json& jresource = jresources[i];
+      if (readers[i] && jresource.find("id") != jresource.end())
+      {
+        smtk::resource::Surrogate surrogate(
+          indices[i],
+          jresource.at("type").get<std::string>(),
+          smtk::common::UUID(jresource.at("id").get<std::string>()),
+          jresource.at("location").get<std::string>());
+        resourceContainer.add(surrogate, role(jresource), jresource);
+        handled[i] = true;
+      }
+    }
+  }
+  else
+  {
+    unsigned int numberOfThreads = resourceContainer.numberOfLoadThreads();
+    if (numberOfThreads == 0)
+    {
+      numberOfThreads = smtk::common::Executor::instance().numberOfThreads();
+    }
+    numberOfThreads =
+      static_cast<unsigned int>(std::min<std::size_t>(numberOfThreads, jresources.size()));
+    if (numberOfThreads > 1)
+    {
+      // Run the readers concurrently. Resources are added to the manager and
+      // container afterward (below) on this thread and in their listed order.
+      smtk::common::ThreadPool<smtk::resource::ResourcePtr> pool(numberOfThreads);
+      std::vector<std::future<smtk::resource::ResourcePtr>> futures(jresources.size());
+      for (std::size_t i = 0; i < jresources.size(); ++i)
+      {
+        if (readers[i])
+        {
+          const auto& read = readers[i];
+          std::string location = jresources[i].at("location").get<std::string>();
+          futures[i] = pool([&read, location]() { return read(location); });
+        }
+      }
+      for (std::size_t i = 0; i < jresources.size(); ++i)
+      {
+        if (futures[i].valid())
+        {
+          smtk::common::Executor::instance().wait(futures[i]);
+          resources[i] = futures[i].get();
+          handled[i] = true;
+        }
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < jresources.size(); ++i)
+  {
+    const json& jresource = jresources[i];
+    smtk::resource::ResourcePtr resource = resources[i];
+    std::string location = jresource.at("location").get<std::string>();
+    if (resource)
+    {
+      // This mirrors what resource::Manager::read() does after reading.
+      manager->add(indices[i], resource);
+      resource->setLocation(location);
+    }
+    else if (!handled[i])
+    {
+      resource = manager->read(jresource.at("type").get<std::string>(), location);
+    }
     if (!resource)
     {
       continue;
@@ -20,6 +20,7 @@
 #include "smtk/attribute/ResourceItemDefinition.h"
 #include "smtk/attribute/StringItem.h"
 #include "smtk/attribute/StringItemDefinition.h"
+#include "smtk/attribute/VoidItem.h"
 
 #include "smtk/io/Logger.h"
 
@@ -101,6 +102,17 @@ Read::Result Read::operateInternal()
   // Get folder path - might be needed to load resources
   boost::filesystem::path projectPath = projectFilePath.parent_path();
 
+  // Choose how the project's resources are loaded.
+  if (this->parameters()->findVoid("load on demand")->isEnabled())
+  {
+    project->resources().setLoadMode(ResourceContainer::LoadMode::Lazy);
+  }
+  auto threadsItem = this->parameters()->findInt("threads");
+  if (threadsItem->isEnabled())
+  {
+    project->resources().setNumberOfLoadThreads(static_cast<unsigned int>(threadsItem->value()));
+  }
+
   // Transcribe project data into the project
   smtk::project::from_json(j, project);
 
@@ -0,0 +1,218 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/FileItem.h"
+#include "smtk/attribute/IntItem.h"
+#include "smtk/attribute/Registrar.h"
+#include "smtk/attribute/Resource.h"
+#include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/VoidItem.h"
+#include "smtk/attribute/operators/Import.h"
+
+#include "smtk/resource/Manager.h"
+
+#include "smtk/operation/Manager.h"
+#include "smtk/operation/Registrar.h"
+#include "smtk/operation/operators/WriteResource.h"
+
+#include "smtk/plugin/Registry.h"
+
+#include "smtk/project/Manager.h"
+#include "smtk/project/Project.h"
+#include "smtk/project/Registrar.h"
+#include "smtk/project/json/jsonResourceContainer.h"
+#include "smtk/project/operators/Read.h"
+
+#include "smtk/common/testing/cxx/helpers.h"
+
+//force to use filesystem version 3
+#define BOOST_FILESYSTEM_VERSION 3
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+// This test verifies that a project's resources can be read on demand
+// (through surrogates) and concurrently when the project is read.
+
+namespace
+{
+
+//SMTK_DATA_DIR is a define setup by cmake
+std::string data_root = SMTK_DATA_DIR;
+std::string write_root = SMTK_SCRATCH_DIR;
+
+void cleanup(const std::string& location)
+{
+  ::boost::filesystem::path path(location);
+  if (::boost::filesystem::exists(path))
+  {
+    ::boost::filesystem::remove_all(path);
+  }
+}
+
+bool writeProject(
+  const smtk::operation::Manager::Ptr& operationManager,
+  const smtk::project::Project::Ptr& project,
+  const std::string& location)
+{
+  auto writeOp = operationManager->create<smtk::operation::WriteResource>();
+  writeOp->parameters()->associate(project);
+  writeOp->parameters()->findFile("filename")->setIsEnabled(true);
+  writeOp->parameters()->findFile("filename")->setValue(location);
+  auto result = writeOp->operate();
+  return result->findInt("outcome")->value() ==
+    static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED);
+}
+
+smtk::project::Project::Ptr readProject(
+  const smtk::operation::Manager::Ptr& operationManager,
+  const std::string& location,
+  bool onDemand,
+  int threads)
+{
+  auto readOp = operationManager->create<smtk::project::Read>();
+  readOp->parameters()->findFile("filename")->setValue(location);
+  readOp->parameters()->findVoid("load on demand")->setIsEnabled(onDemand);
+  readOp->parameters()->findInt("threads")->setIsEnabled(true);
+  readOp->parameters()->findInt("threads")->setValue(threads);
+  auto result = readOp->operate();
+  if (
+    result->findInt("outcome")->value() !=
+    static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED))
+  {
+    std::cerr << readOp->log().convertToString();
+    return smtk::project::Project::Ptr();
+  }
+  return result->findResource("resource")->valueAs<smtk::project::Project>();
+}
+} // namespace
+
+int TestProjectReadLazy(int /*unused*/, char** const /*unused*/)
+{
+  std::string projectDirectory = write_root + "/TestProjectReadLazy";
+  cleanup(projectDirectory);
+  std::string projectFileLocation = projectDirectory + "/foo.smtk";
+
+  smtk::resource::Manager::Ptr resourceManager = smtk::resource::Manager::create();
+  smtk::operation::Manager::Ptr operationManager = smtk::operation::Manager::create();
+  operationManager->registerResourceManager(resourceManager);
+  smtk::project::ManagerPtr projectManager =
+    smtk::project::Manager::create(resourceManager, operationManager);
+
+  auto attributeRegistry =
+    smtk::plugin::addToManagers<smtk::attribute::Registrar>(resourceManager, operationManager);
+  auto operationRegistry = smtk::plugin::addToManagers<smtk::project::Registrar>(operationManager);
+  auto projectRegistry =
+    smtk::plugin::addToManagers<smtk::project::Registrar>(resourceManager, projectManager);
+
+  projectManager->registerProject("foo");
+
+  // Create a project holding several attribute resources and write it.
+  const std::vector<std::string> roles = { "first", "second", "third" };
+  {
+    smtk::project::Project::Ptr project = projectManager->create("foo");
+    smtkTest(project != nullptr, "Failed to create a project");
+
+    auto importOp = operationManager->create<smtk::attribute::Import>();
+    for (const auto& role : roles)
+    {
+      importOp->parameters()->findFile("filename")->setValue(
+        data_root + "/attribute/attribute_collection/DoubleItemExample.sbt");
+      auto result = importOp->operate();
+      smtkTest(
+        result->findInt("outcome")->value() ==
+          static_cast<int>(smtk::operation::Operation::Outcome::SUCCEEDED),
+        "Import operation failed");
+      project->resources().add(result->findResource("resource")->value(), role);
+    }
+    smtkTest(project->resources().size() == roles.size(), "Failed to add resources");
+    smtkTest(
+      writeProject(operationManager, project, projectFileLocation), "Could not write project");
+    projectManager->remove(project);
+  }
+
+  // Read the project, deferring resource reads.
+  {
+    nlohmann::json original;
+    {
+      std::ifstream file(projectFileLocation);
+      original = nlohmann::json::parse(file);
+    }
+    auto project = readProject(operationManager, projectFileLocation, true, 1);
+    smtkTest(project != nullptr, "Could not read project on demand");
+    smtkTest(project->resources().empty(), "Resources were read eagerly");
+    smtkTest(
+      project->resources().surrogates().size() == roles.size(),
+      "Expected a surrogate per resource");
+
+    auto second = project->resources().findByRole<smtk::attribute::Resource>("second");
+    smtkTest(second.size() == 1, "Could not load a resource by role");
+    smtkTest((*second.begin())->clean(), "Loaded resource is marked modified");
+    std::vector<smtk::attribute::DefinitionPtr> defList;
+    (*second.begin())->definitions(defList);
+    smtkTest(defList.size() == 2, "Loaded resource is missing definitions");
+    smtkTest(
+      project->resources().size() == 1 &&
+        project->resources().surrogates().size() == roles.size() - 1,
+      "Only the requested resource should be loaded");
+
+    // Surrogates are written back out exactly as they were read.
+    nlohmann::json current;
+    smtk::project::to_json(current, project->resources());
+    std::size_t unchanged = 0;
+    for (const auto& record : current["resources"])
+    {
+      smtk::common::UUID id(record["id"].get<std::string>());
+      if (project->resources().surrogateRecord(id).is_null())
+      {
+        continue;
+      }
+      for (const auto& originalRecord : original["resources"]["resources"])
+      {
+        if (originalRecord["id"] == record["id"])
+        {
+          smtkTest(record == originalRecord, "Unloaded resource was not written unchanged");
+          ++unchanged;
+        }
+      }
+    }
+    smtkTest(unchanged == roles.size() - 1, "Unloaded resources were not written");
+    smtkTest(
+      writeProject(operationManager, project, projectFileLocation),
+      "Could not write partially-loaded project");
+
+    smtkTest(project->resources().loadAll(), "Could not load remaining resources");
+    smtkTest(project->resources().size() == roles.size(), "Not all resources were loaded");
+    smtkTest(project->resources().surrogates().empty(), "Surrogates remain after loading");
+    projectManager->remove(project);
+  }
+
+  // Read the project again, reading its resources concurrently.
+  {
+    auto project = readProject(operationManager, projectFileLocation, false, 2);
+    smtkTest(project != nullptr, "Could not read project concurrently");
+    smtkTest(project->resources().size() == roles.size(), "Not all resources were read");
+    for (const auto& role : roles)
+    {
+      auto resources = project->resources().findByRole<smtk::attribute::Resource>(role);
+      smtkTest(resources.size() == 1, "Missing resource with role " << role);
+      smtkTest(
+        resourceManager->get((*resources.begin())->id()) != nullptr,
+        "Resource read concurrently is not managed");
+    }
+    projectManager->remove(project);
+  }
+
+#ifdef NDEBUG
+  cleanup(projectDirectory);
+#endif
+
+  return 0;
+}
@@ -278,8 +278,11 @@ PersistentObjectSet Links::linkedFrom(
 
   // Access the Resource Link data that connects this component's resource to
   // the input resource. If it doesn't exist, then there is no link.
+  // Read through a const resource so that the manager's link index is not
+  // told that lhs1's links may have changed.
   typedef Resource::Links::ResourceLinkData ResourceLinkData;
-  const auto& resourceLinks = lhs1->links().data().get<ResourceLinkData::Right>();
+  const Resource& lhs = *lhs1;
+  const auto& resourceLinks = lhs.links().data().get<ResourceLinkData::Right>();
 
   // All resource links held by a resource have a lhs = the containing resource.
   // We therefore only need to find the resource link with a rhs = the input
@@ -336,7 +339,8 @@ Links::linkedFrom(const Resource* rhs1, const smtk::common::UUID& rhs2, const Ro
     return objectSet;
   }
 
-  manager->visit([this, &rhs1, &rhs2, &role, &objectSet](Resource& lhs1) {
+  // Only resources that hold links to rhs1 need to be probed.
+  manager->visitLinkSources(rhs1->id(), [this, &rhs1, &rhs2, &role, &objectSet](Resource& lhs1) {
     PersistentObjectSet objectSetForResource =
       this->linkedFrom(lhs1.shared_from_this(), rhs1, rhs2, role);
     objectSet.insert(objectSetForResource.begin(), objectSetForResource.end());
@@ -101,6 +101,39 @@ void Lock::unlock(LockType lockType)
   }
 }
 
+bool Lock::tryLock(LockType lockType)
+{
+  if (lockType == LockType::Read)
+  {
+    std::unique_lock<std::mutex> lk(m_mutex);
+
+    // Readers yield to waiting writers, just as in lock().
+    if (m_waitingWriters != 0)
+    {
+      return false;
+    }
+
+    ++m_activeReaders;
+    return true;
+  }
+  else if (lockType == LockType::Write)
+  {
+    std::unique_lock<std::mutex> lk(m_mutex);
+
+    if (m_activeReaders != 0 || m_activeWriters != 0)
+    {
+      return false;
+    }
+
+    // Account for ourselves the same way a blocking writer does, so that
+    // unlock() can be used to release the lock.
+    ++m_waitingWriters;
+    ++m_activeWriters;
+    return true;
+  }
+  return true;
+}
+
 smtk::resource::LockType Lock::state() const
 {
   return (
@@ -45,6 +45,10 @@ public:
   SMTKCORE_EXPORT void lock(LockType);
   SMTKCORE_EXPORT void unlock(LockType);
 
+  /// Acquire the lock only if it can be obtained without waiting. Returns
+  /// true if the lock is now held with the requested type.
+  SMTKCORE_EXPORT bool tryLock(LockType);
+
   SMTKCORE_EXPORT LockType state() const;
 
 private:
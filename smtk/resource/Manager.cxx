@@ -15,6 +15,8 @@
 
 #include "smtk/common/UUIDGenerator.h"
 
+#include <vector>
+
 namespace smtk
 {
 namespace resource
@@ -97,6 +99,10 @@ void Manager::clear()
 
     m_observers(*resource, smtk::resource::EventType::REMOVED);
   }
+
+  std::lock_guard<std::mutex> indexGuard(m_linkSourcesMutex);
+  m_linkSources.clear();
+  m_unindexedLinkSources.clear();
 }
 
 smtk::resource::ResourcePtr Manager::create(const std::string& typeName)
@@ -473,6 +479,9 @@ bool Manager::add(const Resource::Index& index, const smtk::resource::ResourcePt
       resource->links().resolve(rsrc);
       rsrc->links().resolve(resource);
     }
+
+    // Index links the resource held before it was managed.
+    this->indexLinks(*resource);
   }
 
   // Tell observers we just added a resource:
@@ -496,6 +505,7 @@ bool Manager::remove(const smtk::resource::ResourcePtr& resource)
 
       // Remove it from the manager's set of resources
       m_resources.erase(resourceIt);
+      this->unindexLinks(*rsrc);
 
       // Clear the resource's manager
       rsrc->m_manager = Ptr();
@@ -537,6 +547,31 @@ void Manager::reviseId(const Resource::SetId& source, const Resource::SetId& des
 
   // try to modify the id, restore it in case of collisions
   resources.modify(resourceIt, destination, source);
+
+  // Re-key the link index if the id was changed.
+  if (resourceIt == resources.end() || (*resourceIt)->id() != destination.id())
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> indexGuard(m_linkSourcesMutex);
+  auto entry = m_linkSources.find(source.id());
+  if (entry != m_linkSources.end())
+  {
+    auto sources = std::move(entry->second);
+    m_linkSources.erase(entry);
+    m_linkSources[destination.id()].insert(sources.begin(), sources.end());
+  }
+  for (auto& linked : m_linkSources)
+  {
+    if (linked.second.erase(source.id()) > 0)
+    {
+      linked.second.insert(destination.id());
+    }
+  }
+  if (m_unindexedLinkSources.erase(source.id()) > 0)
+  {
+    m_unindexedLinkSources.insert(destination.id());
+  }
 }
 
 void Manager::reviseLocation(
@@ -561,6 +596,92 @@ void Manager::reviseLocation(
   }
 }
 
+void Manager::indexLinks(const Resource& lhs)
+{
+  std::lock_guard<std::mutex> indexGuard(m_linkSourcesMutex);
+  m_unindexedLinkSources.erase(lhs.id());
+  this->insertLinkSources(lhs);
+}
+
+void Manager::insertLinkSources(const Resource& lhs) const
+{
+  // Clear the flag before reading the links so that a concurrent mutable
+  // access re-queues the resource rather than being lost.
+  lhs.links().m_unindexed = false;
+  for (const auto& resourceLink : lhs.links().data())
+  {
+    m_linkSources[resourceLink.right].insert(lhs.id());
+  }
+}
+
+void Manager::unindexLinks(const Resource& lhs)
+{
+  std::lock_guard<std::mutex> indexGuard(m_linkSourcesMutex);
+  m_unindexedLinkSources.erase(lhs.id());
+  for (const auto& resourceLink : lhs.links().data())
+  {
+    auto entry = m_linkSources.find(resourceLink.right);
+    if (entry != m_linkSources.end())
+    {
+      entry->second.erase(lhs.id());
+      if (entry->second.empty())
+      {
+        m_linkSources.erase(entry);
+      }
+    }
+  }
+}
+
+void Manager::invalidateLinkIndex(const smtk::common::UUID& lhs)
+{
+  std::lock_guard<std::mutex> indexGuard(m_linkSourcesMutex);
+  m_unindexedLinkSources.insert(lhs);
+}
+
+smtk::common::Termination Manager::visitLinkSources(
+  const smtk::common::UUID& rhs,
+  const ResourceVisitor& visitor) const
+{
+  ScopedLockGuard guard(m_lock, LockType::Read);
+  const auto& resourcesById = m_resources.get<IdTag>();
+
+  // Copy the sources so the index is not locked while visiting.
+  std::vector<smtk::common::UUID> sources;
+  {
+    std::lock_guard<std::mutex> indexGuard(m_linkSourcesMutex);
+
+    // Refresh resources whose links may have changed since they were indexed.
+    for (const auto& unindexed : m_unindexedLinkSources)
+    {
+      auto resourceIt = resourcesById.find(unindexed);
+      if (resourceIt != resourcesById.end())
+      {
+        this->insertLinkSources(**resourceIt);
+      }
+    }
+    m_unindexedLinkSources.clear();
+
+    auto entry = m_linkSources.find(rhs);
+    if (entry == m_linkSources.end())
+    {
+      return smtk::common::Termination::NORMAL;
+    }
+    sources.assign(entry->second.begin(), entry->second.end());
+  }
+
+  for (const auto& source : sources)
+  {
+    auto resourceIt = resourcesById.find(source);
+    if (
+      resourceIt != resourcesById.end() &&
+      visitor(**resourceIt) == smtk::common::Processing::STOP)
+    {
+      return smtk::common::Termination::EARLY;
+    }
+  }
+  return smtk::common::Termination::NORMAL;
+}
+
 smtk::common::Termination Manager::visit(const ResourceVisitor& visitor) const
 {
   ScopedLockGuard guard(m_lock, LockType::Read);
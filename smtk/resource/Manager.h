@@ -28,9 +28,11 @@
 #include "smtk/resource/Resource.h"
 
 #include <functional>
+#include <mutex>
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace smtk
 {
@@ -218,6 +220,20 @@ public:
   /// and Termination::EARLY when a visitor halted iteration.
   smtk::common::Termination visit(const ResourceVisitor& visitor) const;
 
+  /// Visit managed resources that hold links to the resource with id \a rhs.
+  ///
+  /// The manager keeps a reverse index of resource links so that
+  /// Links::linkedFrom() can probe only resources that may link to an object
+  /// instead of every managed resource. Resources are indexed when they are
+  /// added; a resource whose link data has since been accessed mutably is
+  /// re-indexed here before the index is consulted, so no link is missed
+  /// however it was added. Resources visited may no longer hold any links to
+  /// \a rhs (links are not unindexed as they are removed), so visitors must
+  /// still check. Like visit(), visitors may not add or remove resources.
+  smtk::common::Termination visitLinkSources(
+    const smtk::common::UUID& rhs,
+    const ResourceVisitor& visitor) const;
+
   /// Does the manager hold any resources?
   bool empty() const
   {
@@ -253,6 +269,8 @@ public:
   GarbageCollectorPtr garbageCollector() { return m_garbageCollector; }
 
 private:
+  friend class detail::ResourceLinks;
+
   Manager();
 
   /// All resources are tracked using a map between the resource's UUID and a
@@ -276,6 +294,30 @@ private:
 
   /// A read/write-lock for controlling access to m_resources.
   mutable Lock m_lock;
+
+  /// Index every link held by \a lhs (see visitLinkSources()).
+  void indexLinks(const Resource& lhs);
+
+  /// Index every link held by \a lhs; m_linkSourcesMutex must be held.
+  void insertLinkSources(const Resource& lhs) const;
+
+  /// Remove \a lhs from the link index (when it is removed from the manager).
+  void unindexLinks(const Resource& lhs);
+
+  /// Record that the links of the resource with id \a lhs may have changed
+  /// since it was indexed (called by ResourceLinks::data()).
+  void invalidateLinkIndex(const smtk::common::UUID& lhs);
+
+  /// A reverse index of resource links: the ids of resources holding links
+  /// to a resource, keyed by the id of the linked resource.
+  mutable std::unordered_map<smtk::common::UUID, std::unordered_set<smtk::common::UUID>>
+    m_linkSources;
+
+  /// The ids of resources to re-index before m_linkSources is next used.
+  mutable std::unordered_set<smtk::common::UUID> m_unindexedLinkSources;
+
+  /// A mutex controlling access to m_linkSources and m_unindexedLinkSources.
+  mutable std::mutex m_linkSourcesMutex;
 };
 
 template<typename ResourceType>
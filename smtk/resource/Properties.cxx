@@ -19,6 +19,55 @@ namespace resource
 {
 namespace detail
 {
+constexpr std::size_t PropertyOrdinals::invalid;
+
+std::size_t PropertyOrdinals::insert(const smtk::common::UUID& id)
+{
+  auto it = m_ordinals.find(id);
+  if (it != m_ordinals.end())
+  {
+    return it->second;
+  }
+
+  std::size_t ordinal;
+  if (!m_released.empty())
+  {
+    ordinal = m_released.back();
+    m_released.pop_back();
+    m_ids[ordinal] = id;
+  }
+  else
+  {
+    ordinal = m_ids.size();
+    m_ids.push_back(id);
+    m_counts.push_back(0);
+  }
+  m_ordinals[id] = ordinal;
+  return ordinal;
+}
+
+void PropertyOrdinals::release(std::size_t ordinal)
+{
+  if (m_counts[ordinal] > 0 && --m_counts[ordinal] == 0)
+  {
+    smtk::common::UUID id = m_ids[ordinal];
+    this->erase(id);
+  }
+}
+
+void PropertyOrdinals::erase(const smtk::common::UUID& id)
+{
+  auto it = m_ordinals.find(id);
+  if (it == m_ordinals.end())
+  {
+    return;
+  }
+  m_ids[it->second] = smtk::common::UUID::null();
+  m_counts[it->second] = 0;
+  m_released.push_back(it->second);
+  m_ordinals.erase(it);
+}
+
 ResourceProperties::ResourceProperties(Resource* resource)
   : m_resource(resource)
   , m_data(identity<PropertyTypes>())
@@ -18,6 +18,13 @@
 #include "smtk/common/json/jsonUUID.h"
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace smtk
 {
@@ -73,6 +80,278 @@ public:
   }
 };
 
+/// Columnar property storage assigns a dense ordinal to each object that holds
+/// a columnar property. Ordinals are shared by all columnar property types of
+/// a resource. Each ordinal counts the columnar values its object holds and is
+/// recycled once the last of them is erased.
+class SMTKCORE_EXPORT PropertyOrdinals
+{
+public:
+  static constexpr std::size_t invalid = std::numeric_limits<std::size_t>::max();
+
+  /// Return the ordinal assigned to \a id, or invalid if none is assigned.
+  std::size_t find(const smtk::common::UUID& id) const
+  {
+    auto it = m_ordinals.find(id);
+    return it == m_ordinals.end() ? invalid : it->second;
+  }
+
+  /// Return the ordinal assigned to \a id, assigning one if necessary.
+  std::size_t insert(const smtk::common::UUID& id);
+
+  /// Release the ordinal assigned to \a id so that it may be reassigned.
+  void erase(const smtk::common::UUID& id);
+
+  /// Record that the object assigned \a ordinal holds another value.
+  void retain(std::size_t ordinal) { ++m_counts[ordinal]; }
+
+  /// Record that the object assigned \a ordinal holds one fewer value,
+  /// releasing the ordinal if it holds none.
+  void release(std::size_t ordinal);
+
+  /// Return the id assigned to \a ordinal (a null id if it is unassigned).
+  const smtk::common::UUID& id(std::size_t ordinal) const { return m_ids[ordinal]; }
+
+  /// Return the number of ordinals, including those available for reuse.
+  std::size_t size() const { return m_ids.size(); }
+
+private:
+  std::unordered_map<smtk::common::UUID, std::size_t> m_ordinals;
+  std::vector<smtk::common::UUID> m_ids;
+  std::vector<std::size_t> m_counts;
+  std::vector<std::size_t> m_released;
+};
+
+/// Columnar storage for properties of a single type. Each property key maps to
+/// a dense column of values indexed by the ordinal of the object that holds
+/// the value (see PropertyOrdinals), so that a property may be read for every
+/// object in a resource without hashing a UUID per object.
+template<typename Type>
+class ColumnarPropertiesOfType
+  : public smtk::common::TypeMapEntryBase
+  , public PropertiesBase
+{
+  friend class Properties;
+  ColumnarPropertiesOfType(PropertyOrdinals& ordinals)
+    : m_ordinals(ordinals)
+  {
+  }
+
+public:
+  /// A column holds the values of a single property key. Only the values whose
+  /// presence flag is set are meaningful.
+  struct Column
+  {
+    std::vector<Type> values;
+    std::vector<unsigned char> present;
+    std::size_t count = 0;
+
+    bool contains(std::size_t ordinal) const
+    {
+      return ordinal < present.size() && present[ordinal] != 0;
+    }
+  };
+
+  /// The name used to register columnar properties of this type.
+  static std::string typeName()
+  {
+    return "columnar<" + smtk::common::typeName<Type>() + ">";
+  }
+
+  const PropertyOrdinals& ordinals() const { return m_ordinals; }
+
+  /// Access the column for \a key, or nullptr if no object holds \a key.
+  const Column* column(const std::string& key) const
+  {
+    auto it = m_columns.find(key);
+    return it == m_columns.end() ? nullptr : &it->second;
+  }
+
+  bool contains(const std::string& key, const smtk::common::UUID& id) const
+  {
+    const Column* col = this->column(key);
+    return col && col->contains(m_ordinals.find(id));
+  }
+
+  bool insert(const std::string& key, const smtk::common::UUID& id, const Type& value)
+  {
+    Column& col = m_columns[key];
+    std::size_t ordinal = this->reserve(col, id);
+    if (col.present[ordinal])
+    {
+      return false;
+    }
+    col.values[ordinal] = value;
+    col.present[ordinal] = 1;
+    ++col.count;
+    m_ordinals.retain(ordinal);
+    return true;
+  }
+
+  /// Access the value of \a key for \a id, default-constructing it if absent.
+  Type& operator()(const std::string& key, const smtk::common::UUID& id)
+  {
+    Column& col = m_columns[key];
+    std::size_t ordinal = this->reserve(col, id);
+    if (!col.present[ordinal])
+    {
+      col.values[ordinal] = Type();
+      col.present[ordinal] = 1;
+      ++col.count;
+      m_ordinals.retain(ordinal);
+    }
+    return col.values[ordinal];
+  }
+
+  Type& at(const std::string& key, const smtk::common::UUID& id)
+  {
+    return const_cast<Type&>(
+      static_cast<const ColumnarPropertiesOfType*>(this)->at(key, id)); // NOLINT
+  }
+
+  const Type& at(const std::string& key, const smtk::common::UUID& id) const
+  {
+    const Column* col = this->column(key);
+    std::size_t ordinal = m_ordinals.find(id);
+    if (!col || !col->contains(ordinal))
+    {
+      throw std::out_of_range("No columnar property with given key for this object");
+    }
+    return col->values[ordinal];
+  }
+
+  void erase(const std::string& key, const smtk::common::UUID& id)
+  {
+    auto it = m_columns.find(key);
+    if (it == m_columns.end())
+    {
+      return;
+    }
+    this->erase(it->second, m_ordinals.find(id));
+    if (it->second.count == 0)
+    {
+      m_columns.erase(it);
+    }
+  }
+
+  void eraseId(const smtk::common::UUID& id) override
+  {
+    std::size_t ordinal = m_ordinals.find(id);
+    for (auto it = m_columns.begin(); it != m_columns.end();)
+    {
+      this->erase(it->second, ordinal);
+      it = (it->second.count == 0 ? m_columns.erase(it) : std::next(it));
+    }
+  }
+
+  /// Return the keys of the properties held by \a id.
+  std::set<std::string> keys(const smtk::common::UUID& id) const
+  {
+    std::set<std::string> keys;
+    std::size_t ordinal = m_ordinals.find(id);
+    for (const auto& entry : m_columns)
+    {
+      if (entry.second.contains(ordinal))
+      {
+        keys.insert(entry.first);
+      }
+    }
+    return keys;
+  }
+
+  /// Return true if \a id holds no properties of this type.
+  bool empty(const smtk::common::UUID& id) const
+  {
+    std::size_t ordinal = m_ordinals.find(id);
+    return std::none_of(
+      m_columns.begin(), m_columns.end(), [ordinal](const typename ColumnMap::value_type& entry) {
+        return entry.second.contains(ordinal);
+      });
+  }
+
+  using ColumnMap = std::unordered_map<std::string, Column>;
+
+  /// Access the columns of every property key.
+  const ColumnMap& columns() const { return m_columns; }
+
+  // Columnar properties are serialized as maps from keys to maps from UUIDs to
+  // values, the same form used by row-oriented properties.
+  void to_json(nlohmann::json& j) const override { return to_json<Type>(j); }
+
+  void from_json(const nlohmann::json& j) override { return from_json<Type>(j); }
+
+private:
+  std::size_t reserve(Column& col, const smtk::common::UUID& id)
+  {
+    std::size_t ordinal = m_ordinals.insert(id);
+    if (ordinal >= col.values.size())
+    {
+      col.values.resize(m_ordinals.size());
+      col.present.resize(m_ordinals.size(), 0);
+    }
+    return ordinal;
+  }
+
+  void erase(Column& col, std::size_t ordinal)
+  {
+    if (col.contains(ordinal))
+    {
+      col.values[ordinal] = Type();
+      col.present[ordinal] = 0;
+      --col.count;
+      m_ordinals.release(ordinal);
+    }
+  }
+
+  template<typename T>
+  typename std::enable_if<nlohmann::detail::is_compatible_type<nlohmann::json, T>::value>::type
+  to_json(nlohmann::json& j) const
+  {
+    std::unordered_map<std::string, std::unordered_map<smtk::common::UUID, Type>> data;
+    for (const auto& entry : m_columns)
+    {
+      auto& values = data[entry.first];
+      for (std::size_t ordinal = 0; ordinal < entry.second.present.size(); ++ordinal)
+      {
+        if (entry.second.present[ordinal])
+        {
+          values[m_ordinals.id(ordinal)] = entry.second.values[ordinal];
+        }
+      }
+    }
+    j = data;
+  }
+
+  template<typename T>
+  typename std::enable_if<!nlohmann::detail::is_compatible_type<nlohmann::json, T>::value>::type
+  to_json(nlohmann::json&) const
+  {
+  }
+
+  template<typename T>
+  typename std::enable_if<nlohmann::detail::is_compatible_type<nlohmann::json, T>::value>::type
+  from_json(const nlohmann::json& j)
+  {
+    auto data = j.get<std::unordered_map<std::string, std::unordered_map<smtk::common::UUID, Type>>>();
+    for (const auto& entry : data)
+    {
+      for (const auto& value : entry.second)
+      {
+        (*this)(entry.first, value.first) = value.second;
+      }
+    }
+  }
+
+  template<typename T>
+  typename std::enable_if<!nlohmann::detail::is_compatible_type<nlohmann::json, T>::value>::type
+  from_json(const nlohmann::json&)
+  {
+  }
+
+  PropertyOrdinals& m_ordinals;
+  ColumnMap m_columns;
+};
+
 /// Properties is a generalized container for storing and accessing data using a
 /// std::string key. This Properties differs from smtk::common::TypeMapBase
 /// by constructing custom TypeMapEntries<> that are tailored for use with
@@ -103,6 +382,7 @@ public:
     {
       dynamic_cast<PropertiesBase*>(pair.second)->eraseId(id);
     }
+    m_ordinals.erase(id);
   }
 
   template<typename Type>
@@ -131,6 +411,46 @@ public:
     Properties::insertPropertyTypes<0, Tuple>();
   }
 
+  /// Register columnar storage for properties of type \a Type.
+  template<typename Type>
+  void insertColumnarPropertyType()
+  {
+    std::string key = ColumnarPropertiesOfType<Type>::typeName();
+    if (data().find(key) == data().end())
+    {
+      data().emplace(std::make_pair(key, new ColumnarPropertiesOfType<Type>(m_ordinals)));
+    }
+  }
+
+  /// Access columnar storage for properties of type \a Type.
+  template<typename Type>
+  ColumnarPropertiesOfType<Type>& columnar()
+  {
+    return const_cast<ColumnarPropertiesOfType<Type>&>(
+      static_cast<const Properties*>(this)->columnar<Type>()); // NOLINT
+  }
+
+  /// Access columnar storage for properties of type \a Type.
+  template<typename Type>
+  const ColumnarPropertiesOfType<Type>& columnar() const
+  {
+    auto it = data().find(ColumnarPropertiesOfType<Type>::typeName());
+    if (it == data().end())
+    {
+      throw std::domain_error("No columnar entry with given type");
+    }
+    return static_cast<const ColumnarPropertiesOfType<Type>&>(*it->second);
+  }
+
+  /// Check whether columnar storage for type \a Type is registered.
+  template<typename Type>
+  bool containsColumnarType() const
+  {
+    return data().find(ColumnarPropertiesOfType<Type>::typeName()) != data().end();
+  }
+
+  const PropertyOrdinals& ordinals() const { return m_ordinals; }
+
 private:
   template<std::size_t I, typename Tuple>
   inline typename std::enable_if<I != std::tuple_size<Tuple>::value>::type insertPropertyTypes()
@@ -143,6 +463,8 @@ private:
   inline typename std::enable_if<I == std::tuple_size<Tuple>::value>::type insertPropertyTypes()
   {
   }
+
+  PropertyOrdinals m_ordinals;
 };
 } // namespace detail
 
@@ -319,6 +641,140 @@ private:
   detail::PropertiesOfType<IndexedType>& m_properties;
 };
 
+/// A specialization of the Properties container for a single type held in
+/// columnar storage. ConstColumnarPropertiesOfType provides the same API as
+/// ConstPropertiesOfType.
+template<typename Type>
+class ConstColumnarPropertiesOfType
+{
+  friend class Properties;
+  ConstColumnarPropertiesOfType(
+    const smtk::common::UUID& id,
+    const detail::ColumnarPropertiesOfType<Type>& properties)
+    : m_id(id)
+    , m_properties(properties)
+  {
+  }
+
+public:
+  /// Check whether a property associated with \a key is present.
+  bool contains(const std::string& key) const { return m_properties.contains(key, m_id); }
+
+  /// Access property indexed by \a key.
+  const Type& at(const std::string& key) const { return m_properties.at(key, m_id); }
+
+  /// Check if any properties of this type are associated with m_id.
+  bool empty() const { return m_properties.empty(m_id); }
+
+  std::set<std::string> keys() const { return m_properties.keys(m_id); }
+
+private:
+  const smtk::common::UUID& m_id;
+  const detail::ColumnarPropertiesOfType<Type>& m_properties;
+};
+
+/// A specialization of the Properties container for a single type held in
+/// columnar storage. ColumnarPropertiesOfType provides the same API as
+/// PropertiesOfType.
+template<typename Type>
+class ColumnarPropertiesOfType
+{
+  friend class Properties;
+  ColumnarPropertiesOfType(
+    const smtk::common::UUID& id,
+    detail::ColumnarPropertiesOfType<Type>& properties)
+    : m_id(id)
+    , m_properties(properties)
+  {
+  }
+
+public:
+  /// Check whether a property associated with \a key is present.
+  bool contains(const std::string& key) const { return m_properties.contains(key, m_id); }
+
+  /// Insert (\a key, \a value ) into the container.
+  bool insert(const std::string& key, const Type& value)
+  {
+    return m_properties.insert(key, m_id, value);
+  }
+
+  /// Emplace (\a key, \a value ) into the container.
+  bool emplace(const std::string& key, Type&& value)
+  {
+    if (m_properties.contains(key, m_id))
+    {
+      return false;
+    }
+    m_properties(key, m_id) = std::move(value);
+    return true;
+  }
+
+  /// Erase property indexed by \a key from the container.
+  void erase(const std::string& key) { m_properties.erase(key, m_id); }
+
+  /// Access property indexed by \a key.
+  Type& operator[](const std::string& key) { return m_properties(key, m_id); }
+
+  /// Access property indexed by \a key.
+  Type& at(const std::string& key) { return m_properties.at(key, m_id); }
+
+  /// Access property indexed by \a key.
+  const Type& at(const std::string& key) const { return m_properties.at(key, m_id); }
+
+  /// Check if any properties of this type are associated with m_id.
+  bool empty() const { return m_properties.empty(m_id); }
+
+  std::set<std::string> keys() const { return m_properties.keys(m_id); }
+
+private:
+  const smtk::common::UUID& m_id;
+  detail::ColumnarPropertiesOfType<Type>& m_properties;
+};
+
+/// A read-only view of every value of a single columnar property in a
+/// resource. Values are contiguous and indexed by object ordinal; only those
+/// ordinals for which contains() returns true hold a value.
+template<typename Type>
+class PropertyColumn
+{
+  using Column = typename detail::ColumnarPropertiesOfType<Type>::Column;
+
+public:
+  using const_iterator = typename std::vector<Type>::const_iterator;
+
+  PropertyColumn(const detail::PropertyOrdinals& ordinals, const Column* column)
+    : m_ordinals(ordinals)
+    , m_column(column)
+  {
+  }
+
+  /// The number of ordinals spanned by the column.
+  std::size_t size() const { return m_column ? m_column->values.size() : 0; }
+
+  /// The number of objects that hold a value in the column.
+  std::size_t count() const { return m_column ? m_column->count : 0; }
+
+  bool empty() const { return this->count() == 0; }
+
+  /// Check whether the object assigned \a ordinal holds a value.
+  bool contains(std::size_t ordinal) const { return m_column && m_column->contains(ordinal); }
+
+  const Type& operator[](std::size_t ordinal) const { return m_column->values[ordinal]; }
+
+  const_iterator begin() const { return m_column ? m_column->values.begin() : const_iterator(); }
+  const_iterator end() const { return m_column ? m_column->values.end() : const_iterator(); }
+
+  /// The id of the object assigned \a ordinal.
+  const smtk::common::UUID& id(std::size_t ordinal) const { return m_ordinals.id(ordinal); }
+
+  /// The ordinal assigned to \a id (or detail::PropertyOrdinals::invalid).
+  std::size_t ordinal(const smtk::common::UUID& id) const { return m_ordinals.find(id); }
+
+private:
+  const detail::PropertyOrdinals& m_ordinals;
+  const Column* m_column;
+};
+
 /// Resource/Component properties store data as maps from UUIDs to values and
 /// present data as key/value pairs on Resources/Components themselves. This
 /// misdirection is necessary to avoid the construction and storage of a map for
@@ -392,6 +848,31 @@ public:
         properties().get<Indexed<Type>>()));
   }
 
+  /// Access properties of type \a Type held in columnar storage. The resource
+  /// must have registered columnar storage for \a Type (see
+  /// smtk::resource::detail::ResourceProperties::insertColumnarPropertyType()).
+  template<typename Type>
+  ColumnarPropertiesOfType<Type> columnar()
+  {
+    return ColumnarPropertiesOfType<Type>(
+      id(), static_cast<detail::Properties&>(properties()).columnar<Type>());
+  }
+
+  /// Access properties of type \a Type held in columnar storage.
+  template<typename Type>
+  const ConstColumnarPropertiesOfType<Type> columnar() const
+  {
+    return ConstColumnarPropertiesOfType<Type>(
+      id(), static_cast<const detail::Properties&>(properties()).columnar<Type>());
+  }
+
+  /// Check whether the resource holds columnar storage for type \a Type.
+  template<typename Type>
+  bool containsColumnar() const
+  {
+    return static_cast<const detail::Properties&>(properties()).containsColumnarType<Type>();
+  }
+
 private:
   virtual const smtk::common::UUID& id() const = 0;
   virtual smtk::common::TypeMapBase<std::string>& properties() = 0;
@@ -437,6 +918,22 @@ public:
     m_data.insertPropertyType<Indexed<Type>>();
   }
 
+  /// Register columnar storage for properties of type \a Type. Columnar
+  /// properties are accessed via columnar() rather than get(), and all of the
+  /// values for a key can be read in bulk via column().
+  template<typename Type>
+  void insertColumnarPropertyType()
+  {
+    m_data.insertColumnarPropertyType<Type>();
+  }
+
+  /// Access the values of columnar property \a key for all objects.
+  template<typename Type>
+  PropertyColumn<Type> column(const std::string& key) const
+  {
+    return PropertyColumn<Type>(m_data.ordinals(), m_data.columnar<Type>().column(key));
+  }
+
 private:
   ResourceProperties(Resource* resource);
 
@@ -67,25 +67,63 @@ std::function<bool(const Component&)> Resource::queryOperation(
   return smtk::resource::filter::Filter<>(filterString);
 }
 
+const smtk::resource::filter::Rules* Resource::queryRules(
+  const std::function<bool(const Component&)>& queryOp) const
+{
+  // The default query operation is a filter over the default grammar.
+  const auto* filter = queryOp.target<smtk::resource::filter::Filter<>>();
+  return filter ? &filter->rules() : nullptr;
+}
+
 ComponentSet Resource::filter(const std::string& queryString) const
+{
+  // Construct a component set to fill
+  ComponentSet componentSet;
+
+  // Visit each component that satisfies the query and add it to the set
+  smtk::resource::Component::Visitor visitor = [&](const ComponentPtr& component) {
+    componentSet.insert(component);
+  };
+
+  this->visitFiltered(queryString, visitor);
+
+  return componentSet;
+}
+
+void Resource::visitFiltered(
+  const std::string& queryString,
+  std::function<void(const ComponentPtr&)>& v) const
 {
   // Construct a query operation from the query string
   auto queryOp = this->queryOperation(queryString);
 
-  // Construct a component set to fill
-  ComponentSet componentSet;
+  // If the query is composed of rules, let the most selective rule that can
+  // be answered from the resource's indices enumerate candidate components.
+  const auto* rules = this->queryRules(queryOp);
+  if (rules)
+  {
+    bool planned = rules->visitCandidates(*this, [&](const smtk::common::UUID& id) {
+      auto component = this->find(id);
+      if (component && (*rules)(*component))
+      {
+        v(component);
+      }
+    });
+    if (planned)
+    {
+      return;
+    }
+  }
 
-  // Visit each component and add it to the set if it satisfies the query
+  // Otherwise, visit each component and test whether it satisfies the query
   smtk::resource::Component::Visitor visitor = [&](const ComponentPtr& component) {
     if (queryOp(*component))
     {
-      componentSet.insert(component);
+      v(component);
     }
   };
 
   this->visit(visitor);
-
-  return componentSet;
 }
 
 bool Resource::isOfType(const Resource::Index& index) const
@@ -32,6 +32,7 @@ namespace smtk
 {
 namespace operation
 {
+class LockSet;
 class Operation;
 }
 namespace resource
@@ -41,6 +42,7 @@ namespace resource
 /// Operation access to a resource's lock.
 class Key
 {
+  friend class operation::LockSet;
   friend class operation::Operation;
   Key() = default;
 };
@@ -48,6 +50,11 @@ class Key
 template<typename Self, typename Parent>
 class DerivedFrom;
 
+namespace filter
+{
+class Rules;
+}
+
 class Manager;
 class Metadata;
 
@@ -153,6 +160,14 @@ public:
   ComponentSet find(const std::string& queryString) const { return this->filter(queryString); }
   ComponentSet filter(const std::string& queryString) const;
 
+  /// Given a std::string describing a query, visit the components that satisfy
+  /// the query criteria. If the query is rule-based, indexable rules (e.g.,
+  /// those naming a property) enumerate candidate components from the
+  /// resource's indices so that only the candidates are tested; otherwise,
+  /// every component is tested. filter() and filterAs() use this method.
+  void visitFiltered(const std::string& queryString, std::function<void(const ComponentPtr&)>& v)
+    const;
+
   /// given a a std::string describing a query and a type of container, return a
   /// set of components that satisfy both.  Note that since this uses a dynamic
   /// pointer cast this can be slower than other find methods.
@@ -190,6 +205,13 @@ protected:
   Resource(const smtk::common::UUID&, ManagerPtr manager = nullptr);
   Resource(ManagerPtr manager = nullptr);
 
+  /// Given a functor returned by queryOperation(), return the filter rules it
+  /// evaluates or nullptr if it is not a rule-based filter. Resources whose
+  /// queryOperation() returns an smtk::resource::filter::Filter with a custom
+  /// grammar should override this method so their queries may be planned.
+  virtual const filter::Rules* queryRules(
+    const std::function<bool(const Component&)>& queryOp) const;
+
   WeakManagerPtr m_manager;
 
 private:
@@ -245,26 +267,20 @@ private:
 template<typename Collection>
 Collection Resource::filterAs(const std::string& queryString) const
 {
-  // Construct a query operation from the query string
-  auto queryOp = this->queryOperation(queryString);
-
   // Construct a component set to fill
   Collection col;
 
-  // Visit each component and add it to the set if it satisfies the query
+  // Visit each component that satisfies the query and add it to the set
   smtk::resource::Component::Visitor visitor = [&](const ComponentPtr& component) {
-    if (queryOp(*component))
+    auto entry =
+      std::dynamic_pointer_cast<typename Collection::value_type::element_type>(component);
+    if (entry)
     {
-      auto entry =
-        std::dynamic_pointer_cast<typename Collection::value_type::element_type>(component);
-      if (entry)
-      {
-        col.insert(col.end(), entry);
-      }
+      col.insert(col.end(), entry);
     }
   };
 
-  this->visit(visitor);
+  this->visitFiltered(queryString, visitor);
 
   return col;
 }
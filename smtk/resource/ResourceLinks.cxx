@@ -12,6 +12,7 @@
 
 #include "smtk/common/UUID.h"
 
+#include "smtk/resource/Manager.h"
 #include "smtk/resource/Resource.h"
 
 #include <algorithm>
@@ -24,14 +25,36 @@ namespace detail
 {
 ResourceLinks::ResourceLinks(Resource* resource)
   : m_resource(resource)
+  , m_unindexed(true)
 {
   // NOTE: When modifying this constructor, do not use the resource parameter
   // or m_resource field! The parent Resouce is still in construction and is in
   // an indeterminate state.
 }
 
+ResourceLinks::ResourceLinks(ResourceLinks&& rhs) noexcept
+  : m_resource(rhs.m_resource)
+  , m_data(std::move(rhs.m_data))
+  , m_unindexed(true)
+{
+}
+
 ResourceLinks::~ResourceLinks() = default;
 
+ResourceLinks::ResourceLinkData& ResourceLinks::data()
+{
+  // Only the first mutable access after the links were indexed needs to
+  // notify the manager; later ones are covered by the same re-indexing.
+  if (!m_unindexed.load() && !m_unindexed.exchange(true))
+  {
+    if (auto manager = m_resource->manager())
+    {
+      manager->invalidateLinkIndex(m_resource->id());
+    }
+  }
+  return m_data;
+}
+
 Resource* ResourceLinks::leftHandSideResource()
 {
   return m_resource;
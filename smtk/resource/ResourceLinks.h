@@ -22,12 +22,14 @@
 
 #include "smtk/resource/Links.h"
 
+#include <atomic>
 #include <set>
 
 namespace smtk
 {
 namespace resource
 {
+class Manager;
 class Resource;
 
 namespace detail
@@ -74,6 +76,7 @@ class SMTKCORE_EXPORT ResourceLinks : public Links
   typedef detail::ResourceLinkBase ResourceLinkBase;
 
 public:
+  friend class smtk::resource::Manager;
   friend class smtk::resource::Resource;
 
   typedef smtk::common::
@@ -82,10 +85,17 @@ public:
 
   typedef ResourceLinkData::Link Link;
 
+  ResourceLinks(ResourceLinks&&) noexcept;
+
   ~ResourceLinks();
 
   /// Access the underlying link data.
-  ResourceLinkData& data() { return m_data; }
+  ///
+  /// Mutable access tells the manager of the resource (if any) that its
+  /// reverse link index must be refreshed for this resource before it is next
+  /// used, so links may be added or removed through any path. Use the const
+  /// overload when only reading.
+  ResourceLinkData& data();
   const ResourceLinkData& data() const { return m_data; }
 
   /// Resolve any surrogates with the given resource. Returns true if a surrogate
@@ -104,6 +114,9 @@ private:
 
   Resource* m_resource;
   ResourceLinkData m_data;
+
+  /// Set when m_data may have changed since the manager last indexed it.
+  mutable std::atomic<bool> m_unindexed;
 };
 } // namespace detail
 } // namespace resource
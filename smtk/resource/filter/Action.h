@@ -71,10 +71,12 @@ struct NameAction
   {
     std::unique_ptr<Rule>& rule = rules.data().back();
     std::string name = input.string();
+    static_cast<RuleFor<Type>*>(rule.get())->keyKind = RuleFor<Type>::KeyKind::Exact;
+    static_cast<RuleFor<Type>*>(rule.get())->keyPattern = name;
     static_cast<RuleFor<Type>*>(rule.get())->acceptableKeys =
       [name](const PersistentObject& object) -> std::vector<std::string> {
       std::vector<std::string> returnValue;
-      if (object.properties().contains<Type>(name))
+      if (containsProperty<Type>(object, name))
       {
         returnValue.push_back(name);
       }
@@ -93,10 +95,12 @@ struct RegexAction
   {
     std::unique_ptr<Rule>& rule = rules.data().back();
     std::regex regex(input.string());
+    static_cast<RuleFor<Type>*>(rule.get())->keyKind = RuleFor<Type>::KeyKind::Regex;
+    static_cast<RuleFor<Type>*>(rule.get())->keyPattern = input.string();
     static_cast<RuleFor<Type>*>(rule.get())->acceptableKeys =
       [regex](const PersistentObject& object) -> std::vector<std::string> {
       std::vector<std::string> returnValue;
-      for (const auto& key : object.properties().get<Type>().keys())
+      for (const auto& key : propertyKeys<Type>(object))
       {
         if (std::regex_match(key, regex))
         {
@@ -20,7 +20,11 @@
 #include "smtk/resource/filter/Grammar.h"
 #include "smtk/resource/filter/Rules.h"
 
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace smtk
 {
@@ -39,50 +43,74 @@ class Filter
 public:
   Filter(const std::string& str)
     : m_filterString(str)
-    , m_rules(std::move(constructRules(str)))
+    , m_rules(compiledRules(str))
   {
   }
   virtual ~Filter() = default;
 
   // Specific filter rules are composed by parsing string inputs, and are
   // therefore inherently runtime-constructed objects (and, thus, are allocated
-  // on the heap). To accommodate their memory management, these objects are
-  // stored using a std::unique_ptr, which has move-only semantics.
-  // smtk:::resource::filter::Filter must satisfy the API for
+  // on the heap). Once parsed, rules are immutable; they are cached for each
+  // grammar by filter string and shared among all filters constructed from the
+  // same string. smtk:::resource::filter::Filter must satisfy the API for
   // smtk::resource::Resource::queryOperation, which returns a std::function by
-  // value. As a result, this class Defines copy construction and assignment by
-  // reconstructing the internal rule when necessary.
+  // value; copying a filter therefore only copies a reference to its rules.
 
-  Filter(const Filter& other)
-    : m_filterString(other.m_filterString)
-    , m_rules(std::move(constructRules(other.m_filterString)))
-  {
-  }
+  Filter(const Filter&) = default;
+  Filter(Filter&&) noexcept = default;
 
-  Filter(Filter&& other) noexcept
-    : m_filterString(std::move(other.m_filterString))
-    , m_rules(std::move(other.m_rules))
-  {
-  }
+  Filter& operator=(const Filter&) = default;
+  Filter& operator=(Filter&&) noexcept = default;
 
-  Filter& operator=(const Filter& other)
-  {
-    m_filterString = other.m_filterString;
-    m_rules = constructRules(other.m_filterString);
-    return *this;
-  }
+  bool operator()(const Component& component) const { return (*m_rules)(component); }
 
-  Filter& operator=(Filter&& other) noexcept
-  {
-    m_filterString = other.m_filterString;
-    m_rules = std::move(other.m_rules);
-    return *this;
-  }
+  /// Access the rules parsed from the filter string.
+  const smtk::resource::filter::Rules& rules() const { return *m_rules; }
 
-  bool operator()(const Component& component) const { return m_rules(component); }
+  /// Access the filter string.
+  const std::string& filterString() const { return m_filterString; }
 
 private:
-  smtk::resource::filter::Rules constructRules(const std::string& filterString)
+  // The maximum number of compiled filter strings retained per grammar before
+  // rules that are no longer referenced by any filter are discarded.
+  static constexpr std::size_t s_cacheLimit = 256;
+
+  // Return the rules for a filter string, parsing the string only if no rules
+  // for it are cached. The cache is shared by all threads.
+  static std::shared_ptr<const smtk::resource::filter::Rules> compiledRules(
+    const std::string& filterString)
+  {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const smtk::resource::filter::Rules>>
+      cache;
+
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      auto it = cache.find(filterString);
+      if (it != cache.end())
+      {
+        return it->second;
+      }
+    }
+
+    // Parse outside of the lock so that distinct strings may be compiled
+    // concurrently. If another thread compiles the same string first, its
+    // rules are used instead.
+    std::shared_ptr<const smtk::resource::filter::Rules> rules =
+      std::make_shared<smtk::resource::filter::Rules>(constructRules(filterString));
+
+    std::lock_guard<std::mutex> guard(mutex);
+    if (cache.size() >= s_cacheLimit)
+    {
+      for (auto it = cache.begin(); it != cache.end();)
+      {
+        it = (it->second.use_count() == 1 ? cache.erase(it) : std::next(it));
+      }
+    }
+    return cache.emplace(filterString, rules).first->second;
+  }
+
+  static smtk::resource::filter::Rules constructRules(const std::string& filterString)
   {
     smtk::resource::filter::Rules rules;
 
@@ -105,8 +133,11 @@ private:
   }
 
   std::string m_filterString;
-  smtk::resource::filter::Rules m_rules;
+  std::shared_ptr<const smtk::resource::filter::Rules> m_rules;
 };
+
+template<typename GrammarType>
+constexpr std::size_t Filter<GrammarType>::s_cacheLimit;
 } // namespace filter
 } // namespace resource
 } // namespace smtk
@@ -11,8 +11,15 @@
 #define smtk_resource_filter_Rule_h
 
 #include "smtk/resource/PersistentObject.h"
+#include "smtk/resource/Resource.h"
 
 #include <algorithm>
+#include <functional>
+#include <regex>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace smtk
 {
@@ -21,6 +28,45 @@ namespace resource
 namespace filter
 {
 
+/// Return true if \a object holds a property of type \a Type named \a key,
+/// either in row-oriented storage or (if its resource has registered it) in
+/// columnar storage.
+template<typename Type>
+bool containsProperty(const PersistentObject& object, const std::string& key)
+{
+  const auto& properties = object.properties();
+  return properties.contains<Type>(key) ||
+    (properties.containsColumnar<Type>() && properties.columnar<Type>().contains(key));
+}
+
+/// Return the value of \a object's property of type \a Type named \a key
+/// (see containsProperty()).
+template<typename Type>
+const Type& propertyValue(const PersistentObject& object, const std::string& key)
+{
+  const auto& properties = object.properties();
+  if (properties.contains<Type>(key))
+  {
+    return properties.at<Type>(key);
+  }
+  return properties.columnar<Type>().at(key);
+}
+
+/// Return the names of \a object's properties of type \a Type (see
+/// containsProperty()).
+template<typename Type>
+std::set<std::string> propertyKeys(const PersistentObject& object)
+{
+  const auto& properties = object.properties();
+  std::set<std::string> keys = properties.get<Type>().keys();
+  if (properties.containsColumnar<Type>())
+  {
+    std::set<std::string> columnarKeys = properties.columnar<Type>().keys();
+    keys.insert(columnarKeys.begin(), columnarKeys.end());
+  }
+  return keys;
+}
+
 /// A base class for filter rules.
 class Rule
 {
@@ -28,6 +74,25 @@ public:
   virtual ~Rule() = default;
 
   virtual bool operator()(const PersistentObject&) const = 0;
+
+  /// Query planning: if the objects accepted by this rule can be enumerated
+  /// from \a resource's indices, set \a count to an upper bound on the number
+  /// of candidates visitCandidates() would produce and return true. Rules that
+  /// cannot be answered from an index return false and are only evaluated on
+  /// the candidates enumerated by another rule (or on every component).
+  virtual bool estimateCandidates(const Resource& /*resource*/, std::size_t& /*count*/) const
+  {
+    return false;
+  }
+
+  /// Query planning: visit the ids of (a superset of) the objects in \a
+  /// resource accepted by this rule. Each id is visited at most once. This
+  /// method is only called if estimateCandidates() returned true.
+  virtual void visitCandidates(
+    const Resource& /*resource*/,
+    const std::function<void(const smtk::common::UUID&)>& /*visitor*/) const
+  {
+  }
 };
 
 /// A class template for rules dealing with a specific property type.
@@ -48,8 +113,85 @@ public:
     auto acceptable = acceptableKeys(object);
     return std::any_of(
       acceptable.begin(), acceptable.end(), [this, &object](const std::string& key) {
-        return acceptableValue(object.properties().at<Type>(key));
+        return acceptableValue(propertyValue<Type>(object, key));
+      });
+  }
+
+  bool estimateCandidates(const Resource& resource, std::size_t& count) const override
+  {
+    const auto* rows = this->rows(resource);
+    const auto* columns = this->columns(resource);
+    if ((!rows && !columns) || keyKind == KeyKind::None)
+    {
+      return false;
+    }
+
+    count = 0;
+    if (rows)
+    {
+      this->visitAcceptableKeys(rows->data(), [&count](const Properties::Indexed<Type>& values) {
+        count += values.size();
       });
+    }
+    if (columns)
+    {
+      this->visitAcceptableKeys(
+        columns->columns(),
+        [&count](const typename Columns::Column& column) { count += column.count; });
+    }
+    return true;
+  }
+
+  void visitCandidates(
+    const Resource& resource,
+    const std::function<void(const smtk::common::UUID&)>& visitor) const override
+  {
+    // Property values are stored by the resource as a map from property key to
+    // a map from object id to value (or, for columnar storage, a column of
+    // values), so the objects holding a named property (and their values) are
+    // available without visiting every component.
+    const auto* rows = this->rows(resource);
+    const auto* columns = this->columns(resource);
+    if ((!rows && !columns) || keyKind == KeyKind::None)
+    {
+      return;
+    }
+
+    // An object may hold several keys matching a regex, or the same key in
+    // both row-oriented and columnar storage; visit it once.
+    bool unique = keyKind == KeyKind::Exact && !(rows && columns);
+    std::unordered_set<smtk::common::UUID> visited;
+    auto visit = [&](const smtk::common::UUID& id) {
+      if (unique || visited.insert(id).second)
+      {
+        visitor(id);
+      }
+    };
+
+    if (rows)
+    {
+      this->visitAcceptableKeys(rows->data(), [&](const Properties::Indexed<Type>& values) {
+        for (const auto& entry : values)
+        {
+          if (acceptableValue(entry.second))
+          {
+            visit(entry.first);
+          }
+        }
+      });
+    }
+    if (columns)
+    {
+      this->visitAcceptableKeys(columns->columns(), [&](const typename Columns::Column& column) {
+        for (std::size_t ordinal = 0; ordinal < column.present.size(); ++ordinal)
+        {
+          if (column.present[ordinal] && acceptableValue(column.values[ordinal]))
+          {
+            visit(columns->ordinals().id(ordinal));
+          }
+        }
+      });
+    }
   }
 
   // Given a persistent object, return a vector of keys that match the
@@ -58,6 +200,70 @@ public:
 
   // Given a value, determine whether this passes the filter.
   std::function<bool(const Type&)> acceptableValue;
+
+  // How property keys are selected by the filter (if at all), and the key or
+  // key regex. These are recorded alongside acceptableKeys for query planning.
+  enum class KeyKind
+  {
+    None,
+    Exact,
+    Regex
+  };
+  KeyKind keyKind = KeyKind::None;
+  std::string keyPattern;
+
+private:
+  using Rows = smtk::common::TypeMapEntry<std::string, Properties::Indexed<Type>>;
+  using Columns = detail::ColumnarPropertiesOfType<Type>;
+
+  // Invoke \a visitor on the value of each entry of \a map (keyed by property
+  // name) whose key is accepted by this rule.
+  template<typename Map, typename Visitor>
+  void visitAcceptableKeys(const Map& map, const Visitor& visitor) const
+  {
+    if (keyKind == KeyKind::Exact)
+    {
+      auto it = map.find(keyPattern);
+      if (it != map.end())
+      {
+        visitor(it->second);
+      }
+      return;
+    }
+
+    std::regex regex(keyPattern);
+    for (const auto& entry : map)
+    {
+      if (std::regex_match(entry.first, regex))
+      {
+        visitor(entry.second);
+      }
+    }
+  }
+
+  // Return the resource's row-oriented storage for properties of this type,
+  // or nullptr if the resource does not hold properties of this type.
+  static const Rows* rows(const Resource& resource)
+  {
+    const auto& data = resource.properties().data();
+    if (!data.template containsType<Properties::Indexed<Type>>())
+    {
+      return nullptr;
+    }
+    return &data.template get<Properties::Indexed<Type>>();
+  }
+
+  // Return the resource's columnar storage for properties of this type, or
+  // nullptr if the resource has not registered it.
+  static const Columns* columns(const Resource& resource)
+  {
+    const auto& data = resource.properties().data();
+    if (!data.template containsColumnarType<Type>())
+    {
+      return nullptr;
+    }
+    return &data.template columnar<Type>();
+  }
 };
 } // namespace filter
 } // namespace resource
@@ -43,6 +43,36 @@ public:
     });
   }
 
+  /// Visit the ids of candidate objects in \a resource that may satisfy these
+  /// rules, enumerated from the index of the most selective indexable rule.
+  /// Every candidate must still be tested against these rules. Return false
+  /// (without visiting anything) if no rule can be answered from an index, in
+  /// which case every component must be tested.
+  bool visitCandidates(
+    const Resource& resource,
+    const std::function<void(const smtk::common::UUID&)>& visitor) const
+  {
+    const Rule* best = nullptr;
+    std::size_t bestCount = 0;
+    for (const auto& rule : m_data)
+    {
+      std::size_t count;
+      if (rule->estimateCandidates(resource, count) && (!best || count < bestCount))
+      {
+        best = rule.get();
+        bestCount = count;
+      }
+    }
+
+    if (!best)
+    {
+      return false;
+    }
+
+    best->visitCandidates(resource, visitor);
+    return true;
+  }
+
   template<typename... Args>
   void emplace_back(Args&&... args)
   {
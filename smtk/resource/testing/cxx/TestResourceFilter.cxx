@@ -195,5 +195,73 @@ int TestResourceFilter(int /*unused*/, char** const /*unused*/)
     }
   }
 
+  // Resource::filter() enumerates candidates for indexable rules from the
+  // resource's property storage; its results must match those obtained by
+  // testing every component. Properties on the resource itself share that
+  // storage and must not be reported as components.
+  resource->properties().emplace<long>("foo", 2);
+  resource->newComponent();
+
+  std::array<std::string, 8> queries = { "[ integer { 'foo' }]",
+                                         "[ integer { 'foo' = 2 }]",
+                                         "[ integer { 'bar' }]",
+                                         "[ string { /f.o/ = /b.r/ } ]",
+                                         "[ floating-point { /f.o/ }]",
+                                         "[ vector<int> { 'foo' = (0, 1, 2)}]",
+                                         "[ string { 'foo' }]",
+                                         "[ vector<string> { /f.*/ }]" };
+
+  for (const auto& query : queries)
+  {
+    auto queryOp = resource->queryOperation(query);
+    smtk::resource::ComponentSet scanned;
+    smtk::resource::Component::Visitor visitor = [&](const smtk::resource::ComponentPtr& c) {
+      if (queryOp(*c))
+      {
+        scanned.insert(c);
+      }
+    };
+    resource->visit(visitor);
+
+    smtkTest(
+      resource->filter(query) == scanned,
+      "Planned filter \"" << query << "\" differs from a full scan.");
+  }
+
+  // Columnar properties are visible to filters and to the query planner.
+  {
+    Resource::Ptr columnarResource = Resource::create();
+    columnarResource->properties().insertColumnarPropertyType<long>();
+    Component::Ptr alpha = columnarResource->newComponent();
+    alpha->properties().columnar<long>()["alpha"] = 1;
+    Component::Ptr beta = columnarResource->newComponent();
+    beta->properties().emplace<long>("alpha", 2);
+    beta->properties().columnar<long>()["alpha"] = 3;
+    columnarResource->newComponent();
+
+    auto queryOp = columnarResource->queryOperation("[ integer { 'alpha' }]");
+    smtkTest(queryOp(*alpha) && queryOp(*beta), "Columnar properties should pass filters.");
+    smtkTest(
+      columnarResource->filter("[ integer { 'alpha' }]") ==
+        smtk::resource::ComponentSet({ alpha, beta }),
+      "Planned filter should find columnar properties.");
+    smtkTest(
+      columnarResource->filter("[ integer { /alph./ = 1 }]") ==
+        smtk::resource::ComponentSet({ alpha }),
+      "Planned filter should match columnar values.");
+  }
+
+  // Compiled rules are cached by filter string and shared among filters.
+  {
+    smtk::resource::filter::Filter<> filter1("[ integer { 'foo' = 2 }]");
+    smtk::resource::filter::Filter<> filter2("[ integer { 'foo' = 2 }]");
+    smtk::resource::filter::Filter<> filter3 = filter1;
+    smtk::resource::filter::Filter<> filter4("[ integer { 'foo' = 3 }]");
+    smtkTest(&filter1.rules() == &filter2.rules(), "Identical filters should share rules.");
+    smtkTest(&filter1.rules() == &filter3.rules(), "Copied filters should share rules.");
+    smtkTest(&filter1.rules() != &filter4.rules(), "Distinct filters should not share rules.");
+    smtkTest(filter3(*component1) && !filter4(*component1), "Shared rules should be evaluated.");
+  }
+
   return 0;
 }
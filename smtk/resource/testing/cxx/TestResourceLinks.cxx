@@ -394,5 +394,72 @@ int TestResourceLinks(int /*unused*/, char** const /*unused*/)
     }
   }
 
+  // Test that reverse lookups find links held by resources before they were
+  // managed and track resources as they are renamed and removed.
+  {
+    smtk::resource::Links::RoleType role3 = 3;
+
+    ResourceB::Ptr resourceC = ResourceB::create();
+    ComponentB::Ptr componentC = resourceC->newComponent();
+    resourceManager->add(resourceC);
+
+    ResourceA::Ptr resourceD = ResourceA::create();
+    ComponentA::Ptr componentD = resourceD->newComponent();
+    componentD->links().addLinkTo(componentC, role3);
+
+    smtkTest(
+      componentC->links().linkedFrom(role3).empty(),
+      "Links from unmanaged resources should not be found.");
+
+    resourceManager->add(resourceD);
+    std::set<smtk::resource::PersistentObject::Ptr> linkedFrom =
+      componentC->links().linkedFrom(role3);
+    smtkTest(
+      linkedFrom.size() == 1 && *linkedFrom.begin() == componentD,
+      "Links held before a resource was managed should be found.");
+
+    resourceD->setId(smtk::common::UUID::random());
+    linkedFrom = componentC->links().linkedFrom(role3);
+    smtkTest(
+      linkedFrom.size() == 1 && *linkedFrom.begin() == componentD,
+      "Links should be found after the linking resource's id changes.");
+
+    resourceManager->remove(resourceD);
+    smtkTest(
+      componentC->links().linkedFrom(role3).empty(),
+      "Links from removed resources should not be found.");
+  }
+
+  // Test that reverse lookups find links written directly into the link data
+  // of a managed resource (as readers do) rather than through addLinkTo().
+  {
+    typedef smtk::resource::Resource::Links::ResourceLinkData ResourceLinkData;
+    smtk::resource::Links::RoleType role4 = 4;
+
+    ResourceB::Ptr resourceE = ResourceB::create();
+    ComponentB::Ptr componentE = resourceE->newComponent();
+    resourceManager->add(resourceE);
+
+    ResourceA::Ptr resourceF = ResourceA::create();
+    ComponentA::Ptr componentF = resourceF->newComponent();
+    resourceManager->add(resourceF);
+
+    smtkTest(
+      componentE->links().linkedFrom(role4).empty(), "No links to the component should exist.");
+
+    ResourceLinkData& resourceLinkData = resourceF->links().data();
+    smtk::common::UUID resourceLinkId = smtk::common::UUID::random();
+    resourceLinkData.insert(
+      ResourceLinkData::LinkBase(resourceE), resourceLinkId, resourceF->id(), resourceE->id());
+    resourceLinkData.value(resourceLinkId)
+      .insert(smtk::common::UUID::random(), componentF->id(), componentE->id(), role4);
+
+    std::set<smtk::resource::PersistentObject::Ptr> linkedFrom =
+      componentE->links().linkedFrom(role4);
+    smtkTest(
+      linkedFrom.size() == 1 && *linkedFrom.begin() == componentF,
+      "Links inserted directly into a managed resource's link data should be found.");
+  }
+
   return 0;
 }
@@ -147,6 +147,77 @@ int TestResourceProperties(int /*unused*/, char** const /*unused*/)
       !resource->properties().contains<double>("foo"), "Previously erased value still accessible.");
   }
 
+  {
+    // Test columnar storage.
+    Resource::Ptr resource = Resource::create();
+    resource->properties().insertColumnarPropertyType<double>();
+
+    std::vector<Component::Ptr> components;
+    for (int i = 0; i < 10; ++i)
+    {
+      components.push_back(resource->newComponent());
+      if (i % 2 == 0)
+      {
+        components.back()->properties().columnar<double>()["weight"] = i;
+      }
+    }
+    components[1]->properties().columnar<double>().insert("height", 1.5);
+
+    test(
+      components[2]->properties().columnar<double>().contains("weight"),
+      "Columnar value incorrectly assigned");
+    test(
+      !components[1]->properties().columnar<double>().contains("weight"),
+      "Columnar value incorrectly assigned");
+    test(
+      !components[1]->properties().contains<double>("height"),
+      "Columnar values should not be visible to row-oriented storage");
+    test(
+      components[1]->properties().columnar<double>().keys() == std::set<std::string>{ "height" },
+      "Columnar keys incorrectly reported");
+
+    // Read a property for every component in bulk.
+    auto column = resource->properties().column<double>("weight");
+    test(column.count() == 5, "Columnar property has an incorrect number of values");
+    double sum = 0.;
+    for (std::size_t ordinal = 0; ordinal < column.size(); ++ordinal)
+    {
+      if (column.contains(ordinal))
+      {
+        sum += column[ordinal];
+        test(
+          fabs(resource->find(column.id(ordinal))->properties().columnar<double>().at("weight") -
+               column[ordinal]) < double_epsilon,
+          "Column ordinal does not map to the object holding its value");
+      }
+    }
+    test(fabs(sum - 20.) < double_epsilon, "Columnar values incorrectly summed");
+    test(
+      resource->properties().column<double>("missing").empty(),
+      "Missing columns should be empty");
+
+    // Erasing all of an object's properties recycles its ordinal.
+    std::size_t ordinal = column.ordinal(components[4]->id());
+    resource->properties().data().eraseId(components[4]->id());
+    test(
+      !components[4]->properties().columnar<double>().contains("weight"),
+      "Erased columnar value still accessible");
+    test(column.count() == 4, "Erased columnar value still counted");
+    components[3]->properties().columnar<double>()["weight"] = 3.;
+    test(
+      column.ordinal(components[3]->id()) == ordinal && column[ordinal] == 3.,
+      "Released ordinal was not reused");
+
+    // Erasing an object's last columnar value also recycles its ordinal.
+    ordinal = column.ordinal(components[1]->id());
+    components[1]->properties().columnar<double>().erase("height");
+    test(
+      column.ordinal(components[1]->id()) == smtk::resource::detail::PropertyOrdinals::invalid,
+      "Ordinal of an object without columnar values was not released");
+    components[5]->properties().columnar<double>()["weight"] = 5.;
+    test(column.ordinal(components[5]->id()) == ordinal, "Released ordinal was not reused");
+  }
+
   std::cout << "destructor works" << std::endl;
 
   return 0;
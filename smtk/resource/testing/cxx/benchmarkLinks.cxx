@@ -0,0 +1,171 @@
+//=========================================================================
+//  Copyright (c) Kitware, Inc.
+//  All rights reserved.
+//  See LICENSE.txt for details.
+//
+//  This software is distributed WITHOUT ANY WARRANTY; without even
+//  the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+//  PURPOSE.  See the above copyright notice for more information.
+//=========================================================================
+#include "smtk/resource/Component.h"
+#include "smtk/resource/DerivedFrom.h"
+#include "smtk/resource/Manager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <unordered_set>
+#include <vector>
+
+// Compare the cost of Links::linkedFrom(), which probes only the resources the
+// manager's reverse link index reports as linking to an object, with that of
+// visiting every managed resource as linkedFrom() did before the index
+// existed. Each of many managed resources holds one component linked to the
+// component of the next resource, so every lookup has exactly one answer. The
+// number of resources may be passed as an argument.
+
+namespace
+{
+class Resource;
+
+class Component : public smtk::resource::Component
+{
+  friend class Resource;
+
+public:
+  smtkTypeMacro(Component);
+  smtkSuperclassMacro(smtk::resource::Component);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  const smtk::resource::ResourcePtr resource() const override { return m_resource; }
+
+  const smtk::common::UUID& id() const override { return m_id; }
+  bool setId(const smtk::common::UUID& id) override
+  {
+    m_id = id;
+    return true;
+  }
+
+private:
+  Component(const smtk::resource::ResourcePtr& resource)
+    : m_resource(resource)
+  {
+  }
+
+  const smtk::resource::ResourcePtr m_resource;
+  smtk::common::UUID m_id;
+};
+
+class Resource : public smtk::resource::DerivedFrom<Resource, smtk::resource::Resource>
+{
+public:
+  smtkTypeMacro(Resource);
+  smtkCreateMacro(Resource);
+  smtkSharedFromThisMacro(smtk::resource::PersistentObject);
+
+  Component::Ptr newComponent()
+  {
+    Component::Ptr shared(new Component(shared_from_this()));
+    shared->setId(smtk::common::UUID::random());
+    m_components.insert(shared);
+    return shared;
+  }
+
+  smtk::resource::ComponentPtr find(const smtk::common::UUID& id) const override
+  {
+    auto it = std::find_if(m_components.begin(), m_components.end(), [&](const Component::Ptr& c) {
+      return c->id() == id;
+    });
+    return (it != m_components.end() ? *it : smtk::resource::ComponentPtr());
+  }
+
+  std::function<bool(const smtk::resource::Component&)> queryOperation(
+    const std::string& /*unused*/) const override
+  {
+    return [](const smtk::resource::Component& /*unused*/) { return true; };
+  }
+
+  void visit(smtk::resource::Component::Visitor& visitor) const override
+  {
+    std::for_each(m_components.begin(), m_components.end(), visitor);
+  }
+
+protected:
+  Resource() = default;
+
+private:
+  std::unordered_set<Component::Ptr> m_components;
+};
+
+const smtk::resource::Links::RoleType role = 1;
+
+template<typename LinkedFrom>
+double timeLookups(const std::vector<Component::Ptr>& components, LinkedFrom linkedFrom)
+{
+  std::size_t found = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (const auto& component : components)
+  {
+    found += linkedFrom(component).size();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if (found != components.size())
+  {
+    std::cerr << "Found " << found << " links, expected " << components.size() << "\n";
+  }
+  return seconds;
+}
+
+void report(const char* label, double seconds, std::size_t numberOfLookups)
+{
+  std::cout << "  " << label << ": " << seconds << " s, "
+            << 1e6 * seconds / static_cast<double>(numberOfLookups) << " us/lookup\n";
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  std::size_t numberOfResources = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+  std::cout << numberOfResources << " managed resources\n";
+
+  smtk::resource::ManagerPtr manager = smtk::resource::Manager::create();
+  manager->registerResource<Resource>();
+
+  std::vector<Resource::Ptr> resources;
+  std::vector<Component::Ptr> components;
+  for (std::size_t i = 0; i < numberOfResources; ++i)
+  {
+    resources.push_back(Resource::create());
+    components.push_back(resources.back()->newComponent());
+    manager->add(resources.back());
+  }
+  for (std::size_t i = 0; i < numberOfResources; ++i)
+  {
+    components[i]->links().addLinkTo(components[(i + 1) % numberOfResources], role);
+  }
+
+  report(
+    "indexed linkedFrom",
+    timeLookups(
+      components,
+      [](const Component::Ptr& component) { return component->links().linkedFrom(role); }),
+    components.size());
+
+  report(
+    "visit every resource",
+    timeLookups(
+      components,
+      [&manager](const Component::Ptr& component) {
+        smtk::resource::PersistentObjectSet objects;
+        manager->visit([&component, &objects](smtk::resource::Resource& resource) {
+          auto linked = component->links().linkedFrom(resource.shared_from_this(), role);
+          objects.insert(linked.begin(), linked.end());
+          return smtk::common::Processing::CONTINUE;
+        });
+        return objects;
+      }),
+    components.size());
+
+  return 0;
+}
@@ -18,6 +18,10 @@
 #include "smtk/session/polygon/Resource.h"
 #include "smtk/session/polygon/SessionIOJSON.h"
 
+#include "smtk/common/Paths.h"
+
+#include "smtk/model/TessellationArchive.h"
+
 #include "smtk/operation/MarkGeometry.h"
 
 #include "smtk/session/polygon/Read_xml.h"
@@ -44,9 +48,26 @@ Read::Result Read::operateInternal()
     return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
+  // Tessellations may be held in a binary sidecar file rather than inline.
+  smtk::model::TessellationArchive archive;
+  auto jarchive = j.find("tessellation archive");
+  if (jarchive != j.end())
+  {
+    std::string archiveName =
+      smtk::common::Paths::replaceFilename(filename, jarchive->get<std::string>());
+    if (!archive.open(archiveName))
+    {
+      smtkErrorMacro(log(), "Cannot open tessellation archive \"" << archiveName << "\".");
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+    }
+  }
+
   // Deserialize parsed JSON into a model resource:
   auto rsrc = smtk::session::polygon::Resource::create();
-  smtk::session::polygon::SessionIOJSON::loadModelRecords(j, rsrc);
+  {
+    smtk::model::TessellationArchive::Scope scope(archive);
+    smtk::session::polygon::SessionIOJSON::loadModelRecords(j, rsrc);
+  }
   rsrc->setLocation(filename);
 
   operation::MarkGeometry markGeometry(rsrc);
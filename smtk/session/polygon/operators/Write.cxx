@@ -13,6 +13,11 @@
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/IntItem.h"
 #include "smtk/attribute/ResourceItem.h"
+#include "smtk/attribute/VoidItem.h"
+
+#include "smtk/common/Paths.h"
+
+#include "smtk/model/TessellationArchive.h"
 
 #include "smtk/session/polygon/Resource.h"
 #include "smtk/session/polygon/SessionIOJSON.h"
@@ -51,15 +56,40 @@ Write::Result Write::operateInternal()
   smtk::session::polygon::Resource::Ptr rsrc =
     std::dynamic_pointer_cast<smtk::session::polygon::Resource>(resourceItem->value());
 
+  // Tessellations may be written to a binary sidecar file rather than inline.
+  smtk::model::TessellationArchive archive;
+  std::string archiveName = rsrc->location() + ".tess";
+  if (
+    this->parameters()->findVoid("binary tessellations")->isEnabled() &&
+    !archive.create(archiveName))
+  {
+    smtkErrorMacro(this->log(), "Could not create \"" << archiveName << "\".");
+    return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+  }
+
   // Serialize resource into a set of JSON records:
-  smtk::session::polygon::SessionIOJSON::json j =
-    smtk::session::polygon::SessionIOJSON::saveJSON(rsrc);
+  smtk::session::polygon::SessionIOJSON::json j;
+  {
+    smtk::model::TessellationArchive::Scope scope(archive);
+    j = smtk::session::polygon::SessionIOJSON::saveJSON(rsrc);
+  }
 
   if (j.is_null())
   {
     return this->createResult(smtk::operation::Operation::Outcome::FAILED);
   }
 
+  if (archive.isWritable())
+  {
+    // Reference the archive relative to the resource so the pair may be moved together.
+    j["tessellation archive"] = smtk::common::Paths::filename(archiveName);
+    if (!archive.close())
+    {
+      smtkErrorMacro(this->log(), "Could not write \"" << archiveName << "\".");
+      return this->createResult(smtk::operation::Operation::Outcome::FAILED);
+    }
+  }
+
   // Write JSON records to the specified URL:
   bool ok = smtk::session::polygon::SessionIOJSON::saveModelRecords(j, rsrc->location());
 
@@ -31,7 +31,7 @@
 #include "smtk/model/Model.h"
 
 #include "smtk/common/Paths.h"
-#include "smtk/common/ThreadPool.h"
+#include "smtk/common/Executor.h"
 #include "smtk/common/UUID.h"
 
 #include "vtkContourFilter.h"
@@ -441,19 +441,17 @@ Import::Result Import::importExodus(const smtk::session::vtk::Resource::Ptr& res
   std::vector<vtkSmartPointer<vtkMultiBlockDataSet>> modelsOut(filenameItem->numberOfValues());
   if (filenameItem->numberOfValues() > 1)
   {
-    smtk::common::ThreadPool<vtkSmartPointer<vtkMultiBlockDataSet>> threadPool;
-    std::vector<std::future<vtkSmartPointer<vtkMultiBlockDataSet>>> futures;
+    // Read the files concurrently on the process-wide executor.
+    smtk::common::Executor::instance().parallelFor(
+      0, modelsOut.size(), 1, [&modelsOut, &filenameItem](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          modelsOut[i] = importExodusInternal(filenameItem->value(i));
+        }
+      });
 
     for (std::size_t i = 0; i < modelsOut.size(); ++i)
     {
-      std::string filename = filenameItem->value();
-      futures.push_back(threadPool(std::bind(importExodusInternal, filename)));
-    }
-
-    for (std::size_t i = 0; i < modelsOut.size(); ++i)
-    {
-      modelsOut[i] = futures[i].get();
-
       if (modelsOut[i] == nullptr)
       {
         smtkErrorMacro(
@@ -18,16 +18,114 @@
 #include "smtk/operation/SpecificationOps.h"
 
 #include "smtk/attribute/Attribute.h"
+#include "smtk/attribute/ComponentItem.h"
+#include "smtk/attribute/Definition.h"
 #include "smtk/attribute/Resource.h"
 
 #include "smtk/resource/Manager.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace smtk
 {
 namespace task
 {
+namespace
+{
+// Return true if the validity of \a attribute may change without the
+// attribute itself being modified.
+bool isDependent(const smtk::attribute::Attribute& attribute)
+{
+  auto definition = attribute.definition();
+  return !definition || definition->validityDependsOnReferences() || attribute.canEvaluate();
+}
+
+// Return true if \a entry's attributes were all classified under the
+// definitions and active categories currently in effect for \a resource.
+bool isCurrent(
+  const smtk::attribute::Resource& resource,
+  const FillOutAttributes::ResourceAttributes& entry)
+{
+  return entry.m_classified &&
+    entry.m_structureVersion == resource.definitionStructureVersion() &&
+    entry.m_activeCategoriesEnabled == resource.activeCategoriesEnabled() &&
+    (!entry.m_activeCategoriesEnabled || entry.m_activeCategories == resource.activeCategories());
+}
+
+// Place \a attribute in the valid or invalid set of \a entry, returning true
+// if its classification changed.
+bool classify(
+  const smtk::attribute::Attribute& attribute,
+  FillOutAttributes::ResourceAttributes& entry)
+{
+  auto uid = attribute.id();
+  bool changed;
+  if (attribute.isValid()) // TODO: accept predicate override for categories?
+  {
+    changed = entry.m_valid.insert(uid).second;
+    entry.m_invalid.erase(uid);
+  }
+  else
+  {
+    changed = entry.m_invalid.insert(uid).second;
+    entry.m_valid.erase(uid);
+  }
+  if (isDependent(attribute))
+  {
+    entry.m_dependent.insert(uid);
+  }
+  else
+  {
+    entry.m_dependent.erase(uid);
+  }
+  return changed;
+}
+
+// Remove \a uid from \a entry, returning true if it was tracked.
+bool forget(const smtk::common::UUID& uid, FillOutAttributes::ResourceAttributes& entry)
+{
+  entry.m_dependent.erase(uid);
+  return (entry.m_valid.erase(uid) + entry.m_invalid.erase(uid)) > 0;
+}
+
+// Collect the attributes an operation reports as created or modified (by
+// the id of their resource) along with the ids of those it reports as
+// expunged.
+void changedAttributes(
+  const smtk::operation::Operation::Result& result,
+  std::map<smtk::common::UUID, std::set<smtk::attribute::AttributePtr>>& changed,
+  std::set<smtk::common::UUID>& expunged)
+{
+  for (const auto& name : { "created", "modified", "expunged" })
+  {
+    auto item = result->findComponent(name);
+    if (!item)
+    {
+      continue;
+    }
+    bool isExpunged = (item->name() == "expunged");
+    for (std::size_t i = 0; i < item->numberOfValues(); ++i)
+    {
+      auto attribute = std::dynamic_pointer_cast<smtk::attribute::Attribute>(item->value(i));
+      auto resource = attribute ? attribute->attributeResource() : nullptr;
+      if (!resource)
+      {
+        continue;
+      }
+      auto& resourceChanges = changed[resource->id()];
+      if (isExpunged)
+      {
+        expunged.insert(attribute->id());
+      }
+      else
+      {
+        resourceChanges.insert(attribute);
+      }
+    }
+  }
+}
+} // namespace
 
 constexpr const char* const FillOutAttributes::type_name;
 
@@ -189,7 +287,8 @@ bool FillOutAttributes::initializeResources()
           if (attributeSet.m_autoconfigure)
           {
             foundResource = true;
-            auto it = attributeSet.m_resources.insert({ resource->id(), { {}, {} } }).first;
+            auto it =
+              attributeSet.m_resources.insert({ resource->id(), ResourceAttributes() }).first;
             this->updateResourceEntry(*resource, attributeSet, it->second);
           }
         }
@@ -249,7 +348,7 @@ bool FillOutAttributes::updateResourceEntry(
   }
   for (const auto& id : expunged)
   {
-    entry.m_invalid.erase(id);
+    forget(id, entry);
   }
   for (const auto& id : invalidated)
   {
@@ -258,6 +357,7 @@ bool FillOutAttributes::updateResourceEntry(
   }
   // II. Check for newly-created attributes
   std::vector<smtk::attribute::AttributePtr> attributes;
+  std::set<smtk::common::UUID> dependent;
   for (const auto& definition : predicate.m_definitions)
   {
     resource.findAttributes(definition, attributes);
@@ -269,18 +369,84 @@ bool FillOutAttributes::updateResourceEntry(
         (entry.m_valid.find(uid) == entry.m_valid.end()))
       {
         // We've found a new attribute. Classify it.
-        changesMade = true;
-        if (attribute->isValid()) // TODO: accept predicate override for categories?
-        {
-          entry.m_valid.insert(uid);
-        }
-        else
-        {
-          entry.m_invalid.insert(uid);
-        }
+        changesMade |= classify(*attribute, entry);
+      }
+      if (isDependent(*attribute))
+      {
+        dependent.insert(uid);
       }
     }
   }
+  // III. Record the state the attributes were classified under so that
+  //      later operations can update the entry incrementally.
+  entry.m_dependent.swap(dependent);
+  entry.m_classified = true;
+  entry.m_structureVersion = resource.definitionStructureVersion();
+  entry.m_activeCategoriesEnabled = resource.activeCategoriesEnabled();
+  entry.m_activeCategories = resource.activeCategories();
+  return changesMade;
+}
+
+bool FillOutAttributes::updateChangedAttributes(
+  smtk::attribute::Resource& resource,
+  const AttributeSet& predicate,
+  ResourceAttributes& entry,
+  const std::set<smtk::attribute::AttributePtr>& changed,
+  const std::set<smtk::common::UUID>& expunged)
+{
+  if (!isCurrent(resource, entry))
+  {
+    return this->updateResourceEntry(resource, predicate, entry);
+  }
+
+  bool changesMade = false;
+  // I. Forget expunged attributes.
+  for (const auto& id : expunged)
+  {
+    changesMade |= forget(id, entry);
+  }
+  // II. Classify created or modified attributes that match a definition.
+  std::vector<smtk::attribute::DefinitionPtr> definitions;
+  for (const auto& type : predicate.m_definitions)
+  {
+    if (auto definition = resource.findDefinition(type))
+    {
+      definitions.push_back(definition);
+    }
+  }
+  for (const auto& attribute : changed)
+  {
+    if (
+      attribute->attributeResource().get() != &resource ||
+      expunged.find(attribute->id()) != expunged.end())
+    {
+      continue;
+    }
+    if (std::any_of(
+          definitions.begin(),
+          definitions.end(),
+          [&attribute](const smtk::attribute::DefinitionPtr& definition) {
+            return attribute->isA(definition);
+          }))
+    {
+      changesMade |= classify(*attribute, entry);
+    }
+  }
+  // III. Recheck attributes whose validity depends on other objects, since
+  //      the operation may have changed them without reporting it.
+  std::vector<smtk::common::UUID> dependent(entry.m_dependent.begin(), entry.m_dependent.end());
+  for (const auto& id : dependent)
+  {
+    auto attribute = resource.findAttribute(id);
+    if (!attribute)
+    {
+      changesMade |= forget(id, entry);
+    }
+    else if (changed.find(attribute) == changed.end())
+    {
+      changesMade |= classify(*attribute, entry);
+    }
+  }
   return changesMade;
 }
 
@@ -296,6 +462,9 @@ int FillOutAttributes::update(
     case smtk::operation::EventType::DID_OPERATE:
     {
       auto mentionedResources = smtk::operation::extractResources(result);
+      std::map<smtk::common::UUID, std::set<smtk::attribute::AttributePtr>> changed;
+      std::set<smtk::common::UUID> expunged;
+      changedAttributes(result, changed, expunged);
 
       for (const auto& weakResource : mentionedResources)
       {
@@ -317,13 +486,25 @@ int FillOutAttributes::update(
             {
               if (predicate.m_autoconfigure)
               {
-                it = predicate.m_resources.insert({ resource->id(), { {}, {} } }).first;
+                it = predicate.m_resources.insert({ resource->id(), ResourceAttributes() }).first;
                 doUpdate = true;
               }
             }
             if (doUpdate)
             {
-              predicatesUpdated |= this->updateResourceEntry(*resource, predicate, it->second);
+              // Only the attributes the operation reports as changed (and
+              // those that depend on other objects) need to be revalidated
+              // when the resource was mentioned through its attributes.
+              auto changes = changed.find(resource->id());
+              if (changes != changed.end())
+              {
+                predicatesUpdated |= this->updateChangedAttributes(
+                  *resource, predicate, it->second, changes->second, expunged);
+              }
+              else
+              {
+                predicatesUpdated |= this->updateResourceEntry(*resource, predicate, it->second);
+              }
             }
           }
         }
@@ -54,6 +54,18 @@ public:
     std::set<smtk::common::UUID> m_valid;
     /// Attributes matching a definition that need attention.
     std::set<smtk::common::UUID> m_invalid;
+    /// Attributes (valid or not) whose validity depends on other objects
+    /// (associations, references or expressions). These are rechecked after
+    /// every operation on the resource, not just ones reporting them changed.
+    std::set<smtk::common::UUID> m_dependent;
+    /// True once every attribute in the resource has been classified.
+    bool m_classified = false;
+    /// The definition structure and active categories in effect when every
+    /// attribute was last classified. If either changes, all attributes must
+    /// be reclassified.
+    std::size_t m_structureVersion = 0;
+    bool m_activeCategoriesEnabled = false;
+    std::set<std::string> m_activeCategories;
   };
   /// A predicate used to collect resources that fit a given role.
   struct AttributeSet
@@ -106,6 +118,15 @@ protected:
     smtk::attribute::Resource& resource,
     const AttributeSet& predicate,
     ResourceAttributes& entry);
+  /// Update a single resource in a predicate given the attributes an
+  /// operation reports as created or modified and the ids of those it
+  /// reports as expunged.
+  bool updateChangedAttributes(
+    smtk::attribute::Resource& resource,
+    const AttributeSet& predicate,
+    ResourceAttributes& entry,
+    const std::set<smtk::attribute::AttributePtr>& changed,
+    const std::set<smtk::common::UUID>& expunged);
   /// Respond to operations that may change task state.
   int update(
     const smtk::operation::Operation& op,
@@ -67,7 +67,9 @@ bool ResourceAndRole::reconfigureTask()
           else
           {
             didChange = true;
-            asit = attributeSet.m_resources.insert({ resource->id(), { {}, {} } }).first;
+            asit = attributeSet.m_resources
+                     .insert({ resource->id(), FillOutAttributes::ResourceAttributes() })
+                     .first;
             fill->updateResourceEntry(
               *(dynamic_cast<smtk::attribute::Resource*>(resource.get())),
               attributeSet,
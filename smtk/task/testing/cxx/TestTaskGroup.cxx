@@ -10,6 +10,8 @@
 #include "smtk/attribute/Attribute.h"
 #include "smtk/attribute/ComponentItem.h"
 #include "smtk/attribute/Definition.h"
+#include "smtk/attribute/DoubleItem.h"
+#include "smtk/attribute/DoubleItemDefinition.h"
 #include "smtk/attribute/ReferenceItem.h"
 #include "smtk/attribute/ReferenceItemDefinition.h"
 #include "smtk/attribute/Registrar.h"
@@ -209,15 +211,23 @@ int TestTaskGroup(int, char*[])
 
   smtk::task::GatherResources::Ptr gatherResources;
   smtk::task::FillOutAttributes::Ptr fillOutAttributes;
+  smtk::task::FillOutAttributes::Ptr fillOutParameters;
   taskManager->taskInstances().visit(
-    [&gatherResources, &fillOutAttributes](const smtk::task::Task::Ptr& task) {
+    [&gatherResources, &fillOutAttributes, &fillOutParameters](const smtk::task::Task::Ptr& task) {
       if (!gatherResources)
       {
         gatherResources = std::dynamic_pointer_cast<smtk::task::GatherResources>(task);
       }
-      if (!fillOutAttributes)
+      if (auto fill = std::dynamic_pointer_cast<smtk::task::FillOutAttributes>(task))
       {
-        fillOutAttributes = std::dynamic_pointer_cast<smtk::task::FillOutAttributes>(task);
+        if (fill->title() == "Set simulation parameters")
+        {
+          fillOutParameters = fill;
+        }
+        else
+        {
+          fillOutAttributes = fill;
+        }
       }
       return smtk::common::Visit::Continue;
     });
@@ -251,6 +261,44 @@ int TestTaskGroup(int, char*[])
   result = signal->operate();
   // Finally, the FillOutAttributes task is completable
   printTaskStates(taskManager, "Associated material to model.");
+  test(fillOutAttributes->state() == State::Completable, "Expected materials to be completable.");
+
+  // Attributes that do not reference other objects are only revalidated
+  // when an operation reports them changed.
+  auto parametersDef = attrib->createDefinition("SimulationParameters");
+  parametersDef->addItemDefinition<smtk::attribute::DoubleItemDefinition>("timestep");
+  auto parameters = attrib->createAttribute("parameters", "SimulationParameters");
+  signal->parameters()->findComponent("modified")->setNumberOfValues(0);
+  signal->parameters()->findComponent("created")->appendValue(parameters);
+  result = signal->operate();
+  printTaskStates(taskManager, "Added simulation parameters.");
+  test(fillOutParameters->state() == State::Incomplete, "Expected unset parameters.");
+
+  parameters->findDouble("timestep")->setValue(0.1);
+  signal->parameters()->findComponent("created")->setNumberOfValues(0);
+  signal->parameters()->findComponent("modified")->appendValue(parameters);
+  result = signal->operate();
+  printTaskStates(taskManager, "Set simulation parameters.");
+  test(fillOutParameters->state() == State::Completable, "Expected set parameters.");
+
+  // Attributes that reference other objects are revalidated after every
+  // operation on their resource.
+  material1->disassociate(volume1.component());
+  signal->parameters()->findComponent("modified")->setValue(parameters);
+  result = signal->operate();
+  printTaskStates(taskManager, "Disassociated material from model.");
+  test(fillOutAttributes->state() == State::Incomplete, "Expected unassociated material.");
+  material1->associate(volume1.component());
+  result = signal->operate();
+  test(fillOutAttributes->state() == State::Completable, "Expected reassociated material.");
+
+  attrib->removeAttribute(parameters);
+  signal->parameters()->findComponent("modified")->setNumberOfValues(0);
+  signal->parameters()->findComponent("expunged")->appendValue(parameters);
+  result = signal->operate();
+  printTaskStates(taskManager, "Removed simulation parameters.");
+  test(fillOutParameters->state() == State::Irrelevant, "Expected no parameters.");
+  signal->parameters()->findComponent("expunged")->setNumberOfValues(0);
 
   std::string configString2;
   {